@@ -26,23 +26,33 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <string>
 #include <sstream>
 #include <type_traits>
+#include <vector>
+
+#include <tbb/parallel_for.h>
 
 #include "mtkahypartypes.h"
+#include "lib_generic_impls.h"
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/conversion.h"
 #include "mt-kahypar/partition/partitioner_facade.h"
+#include "mt-kahypar/partition/incremental_update.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/registries/registry.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
 #include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/io/command_line_options.h"
 #include "mt-kahypar/io/presets.h"
 
@@ -134,7 +144,7 @@ bool is_compatible(mt_kahypar_partitioned_hypergraph_t partitioned_hg, mt_kahypa
   return false;
 }
 
-void check_if_all_relevant_parameters_are_set(Context& context) {
+void check_if_all_relevant_parameters_are_set(const Context& context) {
   bool success = true;
   auto check_parameter = [&](bool is_uninitialized, const char* warning_msg) {
     if (is_uninitialized) {
@@ -167,10 +177,10 @@ Context context_from_preset(PresetType preset) {
   return context;
 }
 
-void prepare_context(Context& context) {
+void prepare_context(Context& context, const size_t utility_id) {
   context.shared_memory.original_num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
   context.shared_memory.num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
-  context.utility_id = mt_kahypar::utils::Utilities::instance().registerNewUtilityObjects();
+  context.utility_id = utility_id;
 
   context.partition.perfect_balance_part_weights.clear();
   if ( !context.partition.use_individual_part_weights ) {
@@ -178,6 +188,10 @@ void prepare_context(Context& context) {
   }
 }
 
+void prepare_context(Context& context) {
+  prepare_context(context, mt_kahypar::utils::Utilities::instance().registerNewUtilityObjects());
+}
+
 InstanceType get_instance_type(mt_kahypar_hypergraph_t hypergraph) {
   switch ( hypergraph.type ) {
     case STATIC_GRAPH:
@@ -454,6 +468,168 @@ mt_kahypar_partitioned_hypergraph_t map(mt_kahypar_hypergraph_t hg, TargetGraph&
 }
 
 
+// ####################### Batch Partitioning #######################
+
+// ! Instances with fewer nodes per thread than this are partitioned with fewer
+// ! threads. An instance with less nodes is partitioned sequentially.
+static constexpr HypernodeID MIN_NODES_PER_THREAD_IN_BATCH = 10000;
+
+/**
+ * Each instance of a batch gets a share of the threads proportional to its number
+ * of pins, but at most one thread per MIN_NODES_PER_THREAD_IN_BATCH nodes. Small
+ * instances therefore run with one thread, which means that the pool initial partitioner
+ * executes its flat bipartitioning algorithms one after another and FM performs its
+ * localized searches sequentially.
+ */
+size_t batch_thread_budget(const HypernodeID num_nodes,
+                           const HypernodeID num_pins,
+                           const size_t total_num_pins,
+                           const size_t num_threads) {
+  const size_t share = total_num_pins > 0 ? static_cast<size_t>(std::ceil(
+    static_cast<double>(num_threads) * num_pins / total_num_pins)) : 1;
+  const size_t max_threads = std::max(UL(1), static_cast<size_t>(num_nodes / MIN_NODES_PER_THREAD_IN_BATCH));
+  return std::max(UL(1), std::min({ share, max_threads, num_threads }));
+}
+
+/**
+ * Partitions all hypergraphs concurrently and returns the partitioned hypergraphs in
+ * input order. All instances run in the same task arena, each with a reduced thread
+ * budget (similar to the parallel recursions of the deep multilevel scheme). Idle threads
+ * steal work from other instances. We sort the instances by decreasing size for a
+ * better load balance.
+ */
+std::vector<mt_kahypar_partitioned_hypergraph_t> partition_batch(const std::vector<mt_kahypar_hypergraph_t>& hypergraphs,
+                                                                 const std::vector<const Context*>& contexts) {
+  if ( hypergraphs.size() != contexts.size() ) {
+    std::stringstream ss;
+    ss << "Mismatched batch size: " << hypergraphs.size() << " hypergraphs, but "
+       << contexts.size() << " contexts";
+    throw InvalidInputException(ss.str());
+  }
+
+  const size_t num_instances = hypergraphs.size();
+  // Partitioning modifies the input hypergraph (e.g., community IDs)
+  std::vector<const mt_kahypar_hypergraph_s*> hypergraph_ptrs;
+  for ( const mt_kahypar_hypergraph_t& hg : hypergraphs ) {
+    hypergraph_ptrs.push_back(hg.hypergraph);
+  }
+  std::sort(hypergraph_ptrs.begin(), hypergraph_ptrs.end());
+  if ( std::adjacent_find(hypergraph_ptrs.begin(), hypergraph_ptrs.end()) != hypergraph_ptrs.end() ) {
+    throw InvalidInputException("A hypergraph occurs multiple times in the batch");
+  }
+
+  const size_t num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
+  size_t total_num_pins = 0;
+  std::vector<Context> batch_contexts;
+  batch_contexts.reserve(num_instances);
+  for ( size_t i = 0; i < num_instances; ++i ) {
+    const mt_kahypar_hypergraph_t hg = hypergraphs[i];
+    batch_contexts.emplace_back(*contexts[i]);
+    Context& context = batch_contexts.back();
+    check_compatibility(hg, get_preset_c_type(context.partition.preset_type));
+    check_if_all_relevant_parameters_are_set(context);
+    context.partition.instance_type = get_instance_type(hg);
+    context.partition.partition_type = to_partition_c_type(
+      context.partition.preset_type, context.partition.instance_type);
+    context.partition.num_vcycles = 0;
+    total_num_pins += num_pins<true>(hg);
+  }
+
+  for ( size_t i = 0; i < num_instances; ++i ) {
+    Context& context = batch_contexts[i];
+    prepare_context(context);
+    const size_t budget = batch_thread_budget(num_nodes<true>(hypergraphs[i]),
+      num_pins<true>(hypergraphs[i]), total_num_pins, num_threads);
+    context.shared_memory.num_threads = budget;
+    context.shared_memory.original_num_threads = budget;
+    context.shared_memory.degree_of_parallelism *= static_cast<double>(budget) / num_threads;
+  }
+
+  std::vector<size_t> order(num_instances);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](const size_t lhs, const size_t rhs) {
+    return num_pins<true>(hypergraphs[lhs]) > num_pins<true>(hypergraphs[rhs]);
+  });
+
+  std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs(
+    num_instances, mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION });
+  try {
+    tbb::parallel_for(tbb::blocked_range<size_t>(UL(0), num_instances, UL(1)),
+      [&](const tbb::blocked_range<size_t>& range) {
+      for ( size_t pos = range.begin(); pos < range.end(); ++pos ) {
+        const size_t i = order[pos];
+        partitioned_hgs[i] = PartitionerFacade::partition(hypergraphs[i], batch_contexts[i], nullptr);
+      }
+    }, tbb::simple_partitioner());
+  } catch ( ... ) {
+    for ( const mt_kahypar_partitioned_hypergraph_t& phg : partitioned_hgs ) {
+      utils::delete_partitioned_hypergraph(phg);
+    }
+    throw;
+  }
+  return partitioned_hgs;
+}
+
+
+// ####################### Session #######################
+
+/**
+ * A session partitions many (hyper)graphs with the same context. In contrast to
+ * partition(...), it validates the context only once and reuses the same timer and
+ * statistic objects on each call instead of registering new ones. All other data
+ * structures (e.g., gain caches and FM data structures) are allocated from scratch
+ * on each call, and task arenas are already shared by all calls (see TBBInitializer).
+ * Sessions are independent of each other and of all other library calls.
+ */
+class Session {
+
+ public:
+  explicit Session(const Context& context) :
+    _context(context),
+    _utility_id(mt_kahypar::utils::Utilities::instance().registerNewUtilityObjects()),
+    _num_calls(0) {
+    check_if_all_relevant_parameters_are_set(_context);
+  }
+
+  Session(const Session&) = delete;
+  Session & operator= (const Session &) = delete;
+
+  Session(Session&&) = delete;
+  Session & operator= (Session &&) = delete;
+
+  // ! Partitions the hypergraph and writes the block ID of each node to partition
+  void partition(mt_kahypar_hypergraph_t hg, mt_kahypar_partition_id_t* partition) {
+    check_compatibility(hg, get_preset_c_type(_context.partition.preset_type));
+    Context context(_context);
+    context.partition.instance_type = get_instance_type(hg);
+    context.partition.partition_type = to_partition_c_type(
+      context.partition.preset_type, context.partition.instance_type);
+    prepare_context(context, _utility_id);
+    context.partition.num_vcycles = 0;
+    mt_kahypar::utils::Utilities::instance().getTimer(_utility_id).clear();
+    mt_kahypar::utils::Utilities::instance().getStats(_utility_id).clear();
+
+    mt_kahypar_partitioned_hypergraph_t phg = PartitionerFacade::partition(hg, context, nullptr);
+    get_partition<true>(phg, partition);
+    utils::delete_partitioned_hypergraph(phg);
+    ++_num_calls;
+  }
+
+  const Context& context() const {
+    return _context;
+  }
+
+  size_t numCalls() const {
+    return _num_calls;
+  }
+
+ private:
+  const Context _context;
+  const size_t _utility_id;
+  size_t _num_calls;
+};
+
+
 // ####################### V-Cycles #######################
 
 void improve_impl(mt_kahypar_partitioned_hypergraph_t phg,
@@ -483,4 +659,30 @@ void improve_mapping(mt_kahypar_partitioned_hypergraph_t phg,
   improve_impl(phg, partition_context, num_vcycles, &target_graph);
 }
 
+// ####################### Incremental Updates #######################
+
+void update_partition(mt_kahypar_hypergraph_t hg,
+                      mt_kahypar_partitioned_hypergraph_t phg,
+                      const HypergraphDelta& delta,
+                      const Context& context) {
+  Context partition_context(context);
+  check_compatibility(phg, get_preset_c_type(partition_context.partition.preset_type));
+  check_if_all_relevant_parameters_are_set(partition_context);
+  if ( get_instance_type(phg) != InstanceType::hypergraph ) {
+    throw UnsupportedOperationException("Incremental updates are only supported for hypergraphs");
+  }
+  const bool is_underlying_hypergraph = switch_phg<bool, true>(phg, [&](auto& partitioned_hg) {
+    return static_cast<const void*>(&partitioned_hg.hypergraph()) == static_cast<const void*>(hg.hypergraph);
+  });
+  if ( !is_underlying_hypergraph ) {
+    throw InvalidInputException("The hypergraph is not the underlying hypergraph of the partitioned hypergraph");
+  }
+  partition_context.partition.instance_type = get_instance_type(phg);
+  partition_context.partition.partition_type = to_partition_c_type(
+    partition_context.partition.preset_type, partition_context.partition.instance_type);
+  prepare_context(partition_context);
+  partition_context.partition.num_vcycles = 0;
+  PartitionerFacade::updatePartition(phg, delta, partition_context);
+}
+
 } // namespace lib
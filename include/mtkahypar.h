@@ -118,6 +118,37 @@ MT_KAHYPAR_API void mt_kahypar_set_individual_target_block_weights(mt_kahypar_co
                                                                    const mt_kahypar_partition_id_t num_blocks,
                                                                    const mt_kahypar_hypernode_weight_t* block_weights);
 
+/**
+ * Sets a callback that is invoked whenever the partitioner found a new best partition of the
+ * input (hyper)graph, i.e., after the first multilevel cycle and after each V-cycle that improves
+ * the partition. In combination with a time limit (TIME_LIMIT context parameter), this allows
+ * to use the best partition found so far before the partitioning call returns.
+ *
+ * Note that the partition array is only valid during the callback and that intermediate
+ * partitions are only reported if the preset uses the direct multilevel scheme (all presets
+ * except LARGE_K).
+ */
+MT_KAHYPAR_API void mt_kahypar_set_best_partition_callback(mt_kahypar_context_t* context,
+                                                           mt_kahypar_best_partition_callback_t callback,
+                                                           void* user_data);
+
+/**
+ * Sets a callback that is invoked with the progress of the partitioning call (current phase,
+ * level, number of nodes, objective, conductance, imbalance and elapsed time) after coarsening,
+ * after initial partitioning, after each uncoarsening level and after each V-cycle.
+ *
+ * If the callback returns true, the partitioning call is cancelled: the partitioner skips all
+ * remaining refinement and V-cycles and returns a valid partition as fast as possible.
+ * Afterwards, the callback is not invoked anymore during this partitioning call.
+ * Passing null removes the callback.
+ *
+ * Note that progress is only reported if the preset uses the direct multilevel scheme
+ * (all presets except LARGE_K).
+ */
+MT_KAHYPAR_API void mt_kahypar_set_progress_callback(mt_kahypar_context_t* context,
+                                                     mt_kahypar_progress_callback_t callback,
+                                                     void* user_data);
+
 
 // ####################### Thread Pool Initialization #######################
 
@@ -394,6 +425,48 @@ MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_map(mt_kahypar_hyp
                                                                   const mt_kahypar_context_t* context,
                                                                   mt_kahypar_error_t* error);
 
+/**
+ * Partitions a batch of (hyper)graphs concurrently. The i-th hypergraph is partitioned with the i-th context
+ * and the result is stored in partitioned_hgs[i]. Each instance gets a share of the threads proportional to
+ * its size, and small instances are partitioned sequentially. This is considerably faster than calling
+ * mt_kahypar_partition(...) for each instance if the batch consists of many small (hyper)graphs.
+ *
+ * \note Each hypergraph can occur only once in the batch, since partitioning modifies internal data of the input.
+ * \note If partitioning one of the instances fails, no partitioned hypergraph is returned.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                                              const mt_kahypar_context_t* const* contexts,
+                                                              const size_t num_instances,
+                                                              mt_kahypar_partitioned_hypergraph_t* partitioned_hgs,
+                                                              mt_kahypar_error_t* error);
+
+/**
+ * Creates a partitioning session that can be used to partition many (hyper)graphs with the same
+ * context. Compared to calling mt_kahypar_partition(...) repeatedly, a session validates the context
+ * only once and reuses its internal timer and statistic objects. All data structures of the
+ * partitioner are still allocated from scratch on each call.
+ *
+ * \note The number of blocks, imbalance parameter and objective function must be set in the
+ *       partitioning context before creating the session. Later changes to the context are not
+ *       visible to the session.
+ */
+MT_KAHYPAR_API mt_kahypar_session_t* mt_kahypar_create_session(const mt_kahypar_context_t* context,
+                                                               mt_kahypar_error_t* error);
+
+/**
+ * Partitions a (hyper)graph within the given session and writes the block ID of each node
+ * to the partition array (must have size equal to the number of nodes).
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_session_partition(mt_kahypar_session_t* session,
+                                                                mt_kahypar_hypergraph_t hypergraph,
+                                                                mt_kahypar_partition_id_t* partition,
+                                                                mt_kahypar_error_t* error);
+
+/**
+ * Deletes the session.
+ */
+MT_KAHYPAR_API void mt_kahypar_free_session(mt_kahypar_session_t* session);
+
 /**
  * Checks whether or not the given partitioned hypergraph can
  * be improved with the corresponding preset.
@@ -426,6 +499,24 @@ MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_improve_mapping(mt_kahypar_partiti
                                                               const size_t num_vcycles,
                                                               mt_kahypar_error_t* error);
 
+/**
+ * Applies the given changes to a hypergraph and its partition, and refines the partition
+ * around the changed region (instead of partitioning the changed hypergraph from scratch).
+ *
+ * Both handles are updated in place and stay valid. Nodes keep their block, added nodes are
+ * assigned to the block to which they are most strongly connected, and afterwards label
+ * propagation and FM searches are started from the nodes incident to the changes.
+ * See mt_kahypar_hypergraph_delta_t for how nodes and hyperedges are identified.
+ *
+ * \note The partitioned hypergraph must be a partition of the given hypergraph.
+ * \note Only supported for hypergraphs (not for graphs).
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_update_partition(mt_kahypar_hypergraph_t hypergraph,
+                                                               mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                               const mt_kahypar_hypergraph_delta_t* delta,
+                                                               const mt_kahypar_context_t* context,
+                                                               mt_kahypar_error_t* error);
+
 /**
  * Constructs a partitioned (hyper)graph out of the given partition.
  */
@@ -2,6 +2,7 @@
 #define MTKAHYPAR_TYPEDEFS_H
 
 #include <stddef.h>
+#include <stdbool.h>
 
 typedef enum {
   STATIC_GRAPH,
@@ -57,6 +58,8 @@ struct mt_kahypar_context_s;
 typedef struct mt_kahypar_context_s mt_kahypar_context_t;
 struct mt_kahypar_target_graph_s;
 typedef struct mt_kahypar_target_graph_s mt_kahypar_target_graph_t;
+struct mt_kahypar_session_s;
+typedef struct mt_kahypar_session_s mt_kahypar_session_t;
 
 typedef struct mt_kahypar_hypergraph_s mt_kahypar_hypergraph_s;
 typedef struct {
@@ -86,6 +89,94 @@ typedef int mt_kahypar_hypernode_weight_t;
 typedef int mt_kahypar_hyperedge_weight_t;
 typedef int mt_kahypar_partition_id_t;
 
+/**
+ * Receives a new best partition (one block ID per node), its objective and the elapsed
+ * time in seconds since the start of the partitioning call, together with the user data
+ * passed to mt_kahypar_set_best_partition_callback.
+ */
+typedef void (*mt_kahypar_best_partition_callback_t)(const mt_kahypar_partition_id_t* partition,
+                                                     mt_kahypar_hypernode_id_t num_nodes,
+                                                     mt_kahypar_hyperedge_weight_t objective,
+                                                     double elapsed_seconds,
+                                                     void* user_data);
+
+/**
+ * Phase of the partitioning call after which the progress callback is invoked.
+ */
+typedef enum {
+  // the coarsest hypergraph is computed (no partition available yet)
+  PROGRESS_COARSENING,
+  // the coarsest hypergraph is partitioned
+  PROGRESS_INITIAL_PARTITIONING,
+  // the partition is projected to the next level of the hierarchy and refined
+  PROGRESS_REFINEMENT,
+  // a V-cycle is finished
+  PROGRESS_VCYCLE
+} mt_kahypar_progress_phase_t;
+
+/**
+ * Progress of a partitioning call passed to the progress callback.
+ */
+typedef struct {
+  mt_kahypar_progress_phase_t phase;
+  // number of levels between the current and the input hypergraph (0 = input hypergraph)
+  size_t level;
+  // number of nodes of the hypergraph on the current level
+  mt_kahypar_hypernode_id_t num_nodes;
+  // objective and imbalance of the current partition (zero after coarsening)
+  mt_kahypar_hyperedge_weight_t objective;
+  double imbalance;
+  // conductance of the current partition, if the objective is a conductance objective (otherwise zero)
+  double conductance;
+  // elapsed time in seconds since the start of the partitioning call
+  double elapsed_seconds;
+} mt_kahypar_progress_t;
+
+/**
+ * Receives the progress of a partitioning call together with the user data passed to
+ * mt_kahypar_set_progress_callback. Returning true requests cancellation of the partitioning call.
+ */
+typedef bool (*mt_kahypar_progress_callback_t)(const mt_kahypar_progress_t* progress,
+                                               void* user_data);
+
+/**
+ * Describes the changes of a hypergraph between two partitioning runs (see mt_kahypar_update_partition).
+ *
+ * All IDs refer to the hypergraph before the update, except that the i-th added node gets ID n + i
+ * and the i-th added hyperedge gets ID m + i (n and m are the number of nodes and hyperedges before
+ * the update). Removed nodes and hyperedges are compacted afterwards, i.e., the remaining ones keep
+ * their relative order. Arrays of unused changes can be null if the corresponding count is zero.
+ */
+typedef struct {
+  // weights of the added nodes (null means unit weights)
+  const mt_kahypar_hypernode_weight_t* added_node_weights;
+  size_t num_added_nodes;
+  const mt_kahypar_hypernode_id_t* removed_nodes;
+  size_t num_removed_nodes;
+  // the pins of the i-th added hyperedge are stored in
+  // added_hyperedges[added_hyperedge_indices[i]:added_hyperedge_indices[i + 1]]
+  const size_t* added_hyperedge_indices;
+  const mt_kahypar_hypernode_id_t* added_hyperedges;
+  // weights of the added hyperedges (null means unit weights)
+  const mt_kahypar_hyperedge_weight_t* added_hyperedge_weights;
+  size_t num_added_hyperedges;
+  const mt_kahypar_hyperedge_id_t* removed_hyperedges;
+  size_t num_removed_hyperedges;
+  // the i-th added (removed) pin is node added_pin_nodes[i] in hyperedge added_pin_hyperedges[i]
+  const mt_kahypar_hyperedge_id_t* added_pin_hyperedges;
+  const mt_kahypar_hypernode_id_t* added_pin_nodes;
+  size_t num_added_pins;
+  const mt_kahypar_hyperedge_id_t* removed_pin_hyperedges;
+  const mt_kahypar_hypernode_id_t* removed_pin_nodes;
+  size_t num_removed_pins;
+  const mt_kahypar_hypernode_id_t* weight_changed_nodes;
+  const mt_kahypar_hypernode_weight_t* new_node_weights;
+  size_t num_node_weight_changes;
+  const mt_kahypar_hyperedge_id_t* weight_changed_hyperedges;
+  const mt_kahypar_hyperedge_weight_t* new_hyperedge_weights;
+  size_t num_hyperedge_weight_changes;
+} mt_kahypar_hypergraph_delta_t;
+
 /**
  * Configurable parameters of the partitioning context.
  */
@@ -99,7 +190,9 @@ typedef enum {
   // number of V-cycles (integer)
   NUM_VCYCLES,
   // enables logging (bool: 1/0)
-  VERBOSE
+  VERBOSE,
+  // wall-clock time limit in seconds (float, 0 = no limit)
+  TIME_LIMIT
 } mt_kahypar_context_parameter_type_t;
 
 /**
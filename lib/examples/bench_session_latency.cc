@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <mtkahypar.h>
+
+// Measures the latency of partitioning many small hypergraphs with
+// mt_kahypar_partition(...) and with a partitioning session, and the
+// throughput of partitioning all of them with mt_kahypar_partition_batch(...).
+
+// Install library interface via 'sudo make install.mtkahypar' in build folder
+// Compile with: g++ -std=c++14 -DNDEBUG -O3 bench_session_latency.cc -o bench_session_latency -lmtkahypar
+// Usage: ./bench_session_latency [number of hypergraphs (default 10000)] [number of threads]
+
+namespace {
+
+struct Instance {
+  mt_kahypar_hypernode_id_t num_nodes;
+  mt_kahypar_hyperedge_id_t num_edges;
+  std::vector<size_t> indices;
+  std::vector<mt_kahypar_hyperedge_id_t> pins;
+};
+
+// Random hypergraph with 100 to 1000 nodes and hyperedges of size 2 to 8
+Instance generate_instance(std::mt19937& rng) {
+  Instance instance;
+  instance.num_nodes = std::uniform_int_distribution<mt_kahypar_hypernode_id_t>(100, 1000)(rng);
+  instance.num_edges = 2 * instance.num_nodes;
+  std::uniform_int_distribution<size_t> edge_size(2, 8);
+  std::uniform_int_distribution<mt_kahypar_hypernode_id_t> node(0, instance.num_nodes - 1);
+  instance.indices.push_back(0);
+  for ( mt_kahypar_hyperedge_id_t e = 0; e < instance.num_edges; ++e ) {
+    const size_t size = edge_size(rng);
+    const size_t start = instance.pins.size();
+    while ( instance.pins.size() - start < size ) {
+      const mt_kahypar_hypernode_id_t pin = node(rng);
+      if ( std::find(instance.pins.begin() + start, instance.pins.end(), pin) == instance.pins.end() ) {
+        instance.pins.push_back(pin);
+      }
+    }
+    instance.indices.push_back(instance.pins.size());
+  }
+  return instance;
+}
+
+void print_latencies(const std::string& name, std::vector<double>& latencies) {
+  std::sort(latencies.begin(), latencies.end());
+  double sum = 0.0;
+  for ( const double latency : latencies ) {
+    sum += latency;
+  }
+  const auto percentile = [&](const double p) {
+    return latencies[std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()))];
+  };
+  std::cout << name << ": total = " << sum / 1000.0 << " s"
+            << ", mean = " << sum / latencies.size() << " ms"
+            << ", p50 = " << percentile(0.5) << " ms"
+            << ", p90 = " << percentile(0.9) << " ms"
+            << ", p99 = " << percentile(0.99) << " ms"
+            << ", max = " << latencies.back() << " ms" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  mt_kahypar_error_t error{};
+  const size_t num_instances = argc > 1 ? std::stoul(argv[1]) : 10000;
+  const size_t num_threads = argc > 2 ? std::stoul(argv[2]) : std::thread::hardware_concurrency();
+
+  mt_kahypar_initialize(num_threads, false /* no interleaved NUMA allocations */);
+  mt_kahypar_set_seed(42 /* seed */);
+
+  mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
+  mt_kahypar_set_partitioning_parameters(context,
+    4 /* number of blocks */, 0.03 /* imbalance parameter */,
+    KM1 /* objective function */);
+
+  std::mt19937 rng(42);
+  std::vector<mt_kahypar_hypergraph_t> hypergraphs;
+  for ( size_t i = 0; i < num_instances; ++i ) {
+    const Instance instance = generate_instance(rng);
+    hypergraphs.push_back(mt_kahypar_create_hypergraph(context, instance.num_nodes,
+      instance.num_edges, instance.indices.data(), instance.pins.data(), nullptr, nullptr, &error));
+    if (hypergraphs.back().hypergraph == nullptr) {
+      std::cout << error.msg << std::endl; std::exit(1);
+    }
+  }
+
+  using clock = std::chrono::high_resolution_clock;
+  const auto elapsed_ms = [](const clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(clock::now() - start).count();
+  };
+  std::vector<mt_kahypar_partition_id_t> partition;
+
+  // Partition each hypergraph with a separate call
+  std::vector<double> latencies;
+  for ( mt_kahypar_hypergraph_t hypergraph : hypergraphs ) {
+    partition.resize(mt_kahypar_num_hypernodes(hypergraph));
+    const auto start = clock::now();
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg =
+      mt_kahypar_partition(hypergraph, context, &error);
+    if (partitioned_hg.partitioned_hg == nullptr) {
+      std::cout << error.msg << std::endl; std::exit(1);
+    }
+    mt_kahypar_get_partition(partitioned_hg, partition.data());
+    mt_kahypar_free_partitioned_hypergraph(partitioned_hg);
+    latencies.push_back(elapsed_ms(start));
+  }
+  print_latencies("mt_kahypar_partition", latencies);
+
+  // Partition all hypergraphs within one session
+  latencies.clear();
+  const auto session_start = clock::now();
+  mt_kahypar_session_t* session = mt_kahypar_create_session(context, &error);
+  if (session == nullptr) {
+    std::cout << error.msg << std::endl; std::exit(1);
+  }
+  const double session_setup = elapsed_ms(session_start);
+  for ( mt_kahypar_hypergraph_t hypergraph : hypergraphs ) {
+    partition.resize(mt_kahypar_num_hypernodes(hypergraph));
+    const auto start = clock::now();
+    if (mt_kahypar_session_partition(session, hypergraph, partition.data(), &error) != SUCCESS) {
+      std::cout << error.msg << std::endl; std::exit(1);
+    }
+    latencies.push_back(elapsed_ms(start));
+  }
+  print_latencies("mt_kahypar_session_partition", latencies);
+  std::cout << "Session setup = " << session_setup << " ms" << std::endl;
+
+  mt_kahypar_free_session(session);
+
+  // Partition all hypergraphs concurrently
+  const std::vector<const mt_kahypar_context_t*> contexts(hypergraphs.size(), context);
+  std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs(hypergraphs.size());
+  const auto batch_start = clock::now();
+  if (mt_kahypar_partition_batch(hypergraphs.data(), contexts.data(), hypergraphs.size(),
+        partitioned_hgs.data(), &error) != SUCCESS) {
+    std::cout << error.msg << std::endl; std::exit(1);
+  }
+  const double batch_time = elapsed_ms(batch_start);
+  std::cout << "mt_kahypar_partition_batch: total = " << batch_time / 1000.0 << " s"
+            << ", mean = " << batch_time / hypergraphs.size() << " ms per hypergraph" << std::endl;
+  for ( mt_kahypar_partitioned_hypergraph_t partitioned_hg : partitioned_hgs ) {
+    mt_kahypar_free_partitioned_hypergraph(partitioned_hg);
+  }
+  for ( mt_kahypar_hypergraph_t hypergraph : hypergraphs ) {
+    mt_kahypar_free_hypergraph(hypergraph);
+  }
+  mt_kahypar_free_context(context);
+}
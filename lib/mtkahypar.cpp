@@ -114,6 +114,33 @@ namespace {
     }
     return to_error(mt_kahypar_status_t::OTHER_ERROR, ex.what());
   }
+
+  HypergraphDelta to_hypergraph_delta(const mt_kahypar_hypergraph_delta_t& delta) {
+    HypergraphDelta result;
+    for ( size_t i = 0; i < delta.num_added_nodes; ++i ) {
+      result.added_nodes.push_back(delta.added_node_weights ? delta.added_node_weights[i] : 1);
+    }
+    result.removed_nodes.assign(delta.removed_nodes, delta.removed_nodes + delta.num_removed_nodes);
+    for ( size_t i = 0; i < delta.num_added_hyperedges; ++i ) {
+      result.added_edges.emplace_back(delta.added_hyperedges + delta.added_hyperedge_indices[i],
+                                      delta.added_hyperedges + delta.added_hyperedge_indices[i + 1]);
+      result.added_edge_weights.push_back(delta.added_hyperedge_weights ? delta.added_hyperedge_weights[i] : 1);
+    }
+    result.removed_edges.assign(delta.removed_hyperedges, delta.removed_hyperedges + delta.num_removed_hyperedges);
+    for ( size_t i = 0; i < delta.num_added_pins; ++i ) {
+      result.added_pins.emplace_back(delta.added_pin_hyperedges[i], delta.added_pin_nodes[i]);
+    }
+    for ( size_t i = 0; i < delta.num_removed_pins; ++i ) {
+      result.removed_pins.emplace_back(delta.removed_pin_hyperedges[i], delta.removed_pin_nodes[i]);
+    }
+    for ( size_t i = 0; i < delta.num_node_weight_changes; ++i ) {
+      result.node_weight_changes.emplace_back(delta.weight_changed_nodes[i], delta.new_node_weights[i]);
+    }
+    for ( size_t i = 0; i < delta.num_hyperedge_weight_changes; ++i ) {
+      result.edge_weight_changes.emplace_back(delta.weight_changed_hyperedges[i], delta.new_hyperedge_weights[i]);
+    }
+    return result;
+  }
 }
 
 
@@ -163,6 +190,7 @@ mt_kahypar_status_t mt_kahypar_set_context_parameter(mt_kahypar_context_t* conte
     case NUM_BLOCKS: return parse_number(c.partition.k, "positive integer");
     case EPSILON: return parse_number(c.partition.epsilon, "floating point number");
     case NUM_VCYCLES: return parse_number(c.partition.num_vcycles, "positive integer");
+    case TIME_LIMIT: return parse_number(c.partition.time_limit, "floating point number");
     case OBJECTIVE: {
       std::string objective(value);
       if ( objective == "km1" ) {
@@ -261,6 +289,34 @@ void mt_kahypar_set_individual_target_block_weights(mt_kahypar_context_t* contex
   lib::set_individual_block_weights(reinterpret_cast<Context&>(*context), num_blocks, block_weights);
 }
 
+void mt_kahypar_set_best_partition_callback(mt_kahypar_context_t* context,
+                                            mt_kahypar_best_partition_callback_t callback,
+                                            void* user_data) {
+  Context& c = reinterpret_cast<Context&>(*context);
+  if ( callback == nullptr ) {
+    c.partition.best_partition_callback = nullptr;
+    return;
+  }
+  c.partition.best_partition_callback = [callback, user_data](const vec<PartitionID>& partition,
+                                                             const HyperedgeWeight objective,
+                                                             const double elapsed_seconds) {
+    callback(partition.data(), partition.size(), objective, elapsed_seconds, user_data);
+  };
+}
+
+void mt_kahypar_set_progress_callback(mt_kahypar_context_t* context,
+                                      mt_kahypar_progress_callback_t callback,
+                                      void* user_data) {
+  Context& c = reinterpret_cast<Context&>(*context);
+  if ( callback == nullptr ) {
+    c.partition.progress_callback = nullptr;
+    return;
+  }
+  c.partition.progress_callback = [callback, user_data](const mt_kahypar_progress_t& progress) {
+    return callback(&progress, user_data);
+  };
+}
+
 void mt_kahypar_initialize(const size_t num_threads, const bool interleaved_allocations) {
   lib::initialize(num_threads, interleaved_allocations, false);
 }
@@ -545,6 +601,57 @@ mt_kahypar_partitioned_hypergraph_t mt_kahypar_map(mt_kahypar_hypergraph_t hyper
   return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
 }
 
+mt_kahypar_status_t mt_kahypar_partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                               const mt_kahypar_context_t* const* contexts,
+                                               const size_t num_instances,
+                                               mt_kahypar_partitioned_hypergraph_t* partitioned_hgs,
+                                               mt_kahypar_error_t* error) {
+  try {
+    std::vector<mt_kahypar_hypergraph_t> batch(hypergraphs, hypergraphs + num_instances);
+    std::vector<const Context*> batch_contexts(num_instances);
+    for ( size_t i = 0; i < num_instances; ++i ) {
+      batch_contexts[i] = reinterpret_cast<const Context*>(contexts[i]);
+    }
+    std::vector<mt_kahypar_partitioned_hypergraph_t> result = lib::partition_batch(batch, batch_contexts);
+    std::copy(result.begin(), result.end(), partitioned_hgs);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+mt_kahypar_session_t* mt_kahypar_create_session(const mt_kahypar_context_t* context,
+                                                mt_kahypar_error_t* error) {
+  try {
+    return reinterpret_cast<mt_kahypar_session_t*>(
+      new lib::Session(reinterpret_cast<const Context&>(*context)));
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return nullptr;
+}
+
+mt_kahypar_status_t mt_kahypar_session_partition(mt_kahypar_session_t* session,
+                                                 mt_kahypar_hypergraph_t hypergraph,
+                                                 mt_kahypar_partition_id_t* partition,
+                                                 mt_kahypar_error_t* error) {
+  try {
+    reinterpret_cast<lib::Session*>(session)->partition(hypergraph, partition);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+void mt_kahypar_free_session(mt_kahypar_session_t* session) {
+  if (session == nullptr) {
+    return;
+  }
+  delete reinterpret_cast<lib::Session*>(session);
+}
+
 MT_KAHYPAR_API bool mt_kahypar_check_partition_compatibility(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                                              mt_kahypar_preset_type_t preset) {
   return lib::is_compatible(partitioned_hg, preset);
@@ -563,6 +670,21 @@ mt_kahypar_status_t mt_kahypar_improve_partition(mt_kahypar_partitioned_hypergra
   }
 }
 
+mt_kahypar_status_t mt_kahypar_update_partition(mt_kahypar_hypergraph_t hypergraph,
+                                                mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                const mt_kahypar_hypergraph_delta_t* delta,
+                                                const mt_kahypar_context_t* context,
+                                                mt_kahypar_error_t* error) {
+  try {
+    lib::update_partition(hypergraph, partitioned_hg, to_hypergraph_delta(*delta),
+                          reinterpret_cast<const Context&>(*context));
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
 mt_kahypar_status_t mt_kahypar_improve_mapping(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                                mt_kahypar_target_graph_t* target_graph,
                                                const mt_kahypar_context_t* context,
@@ -32,6 +32,9 @@
 #include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/io/presets.h"
+#include "mt-kahypar/parallel/memory_accounting.h"
+#include "mt-kahypar/parallel/numa_placement.h"
+#include "mt-kahypar/partition/memory_budget.h"
 #include "mt-kahypar/partition/partitioner_facade.h"
 #include "mt-kahypar/partition/registries/register_memory_pool.h"
 #include "mt-kahypar/partition/registries/registry.h"
@@ -42,6 +45,8 @@
 #include "mt-kahypar/utils/randomize.h"
 #include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/perf_counters.h"
+#include "mt-kahypar/utils/tracer.h"
 
 using namespace mt_kahypar;
 
@@ -68,6 +73,11 @@ int main(int argc, char* argv[]) {
     context.partition.preset_type, context.partition.instance_type);
 
 
+  if ( context.partition.memory_limit > 0 ) {
+    parallel::MemoryAccounting::instance().setMemoryLimit(
+      context.partition.memory_limit * UL(1000000));
+  }
+
   context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
   if (context.partition.verbose_output) {
     io::printBanner();
@@ -100,6 +110,10 @@ int main(int argc, char* argv[]) {
     hwloc_bitmap_free(cpuset);
   #endif
 
+  if ( context.shared_memory.numa_aware_placement ) {
+    parallel::NumaPlacement::instance().enable();
+  }
+
   // To set disable_single_pin_nets_removal
   // in the context, we need to know the Objective
   context.setupSinglePinNetsRemoval();
@@ -134,10 +148,23 @@ int main(int argc, char* argv[]) {
     timer.stop_timer("read_fixed_vertices");
   }
 
+  // Fall back to sparse connectivity information if the dense
+  // data structures would exceed the memory limit
+  adapt_connectivity_to_memory_limit(hypergraph, context);
+
   // Initialize Memory Pool and Algorithm/Policy Registries
   register_memory_pool(hypergraph, context);
   register_algorithms_and_policies();
 
+  if ( context.partition.trace_file != "" ) {
+    utils::Tracer::instance().enable(context.partition.trace_buffer_size,
+      context.partition.trace_moves ? utils::TraceLevel::fine : utils::TraceLevel::coarse);
+  }
+  if ( context.partition.show_perf_counters && !utils::PerfCounters::instance().enable() ) {
+    WARNING("Hardware performance counters are not available (perf_event_open failed)."
+      << "Partitioning continues without them.");
+  }
+
   // Partition Hypergraph
   HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
   mt_kahypar_partitioned_hypergraph_t partitioned_hypergraph =
@@ -164,6 +191,16 @@ int main(int argc, char* argv[]) {
       partitioned_hypergraph, context.partition.graph_partition_filename);
   }
 
+  if ( context.partition.trace_file != "" ) {
+    utils::Tracer::instance().disable();
+    utils::Tracer::instance().writeChromeTrace(context.partition.trace_file);
+    if ( utils::Tracer::instance().numDroppedEvents() > 0 ) {
+      WARNING(utils::Tracer::instance().numDroppedEvents() << "traced events were overwritten."
+        << "Increase --trace-buffer-size to keep all events.");
+    }
+  }
+
+  utils::PerfCounters::instance().disable();
   parallel::MemoryPool::instance().free_memory_chunks();
   TBBInitializer::instance().terminate();
 
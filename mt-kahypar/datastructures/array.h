@@ -341,6 +341,16 @@ class Array {
     }
   }
 
+  // ! Uses memory owned by someone else (e.g., a LevelArena). The array
+  // ! does not release the memory and can be rebound to another memory range.
+  void useExternalMemory(value_type* data, const size_type size) {
+    if ( _data || !_group.empty() ) {
+      throw SystemException("Memory of vector already allocated");
+    }
+    _underlying_data = data;
+    _size = size;
+  }
+
   // ! Replaces the contents of the container
   void assign(const size_type count,
               const value_type value,
@@ -30,15 +30,16 @@
 #include <vector>
 #include <cassert>
 
-#include <tbb/scalable_allocator.h>
 #include <tbb/enumerable_thread_specific.h>
 
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
 namespace mt_kahypar::ds {
 
 template<typename T>
 class BufferedVector {
 public:
-  using vec_t = std::vector<T, tbb::scalable_allocator<T>>;
+  using vec_t = parallel::scalable_vector<T>;
 
   BufferedVector(size_t max_size) :
     data(max_size, T()),
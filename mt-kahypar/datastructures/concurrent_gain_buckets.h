@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/streaming_vector.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/*!
+ * Concurrent data structure that distributes values into a small number
+ * of gain buckets. Bucket i > 0 contains values with an (approximate) gain
+ * in [2^(i-1), 2^i) and bucket 0 contains values with non-positive gain.
+ * The largest bucket also contains all larger gains. Each bucket is a
+ * streaming vector, which means that values can be inserted concurrently
+ * without locking (each thread inserts into its own buffer).
+ * The main use case is priority-ordered label propagation, where active
+ * nodes are processed bucket by bucket in decreasing order of their gain.
+ */
+template <typename Value>
+class ConcurrentGainBuckets {
+
+  using Bucket = StreamingVector<Value>;
+
+ public:
+  static constexpr size_t NUM_BUCKETS = 32;
+
+  ConcurrentGainBuckets() :
+    _buckets(NUM_BUCKETS) { }
+
+  ConcurrentGainBuckets(const ConcurrentGainBuckets&) = delete;
+  ConcurrentGainBuckets & operator= (const ConcurrentGainBuckets &) = delete;
+
+  ConcurrentGainBuckets(ConcurrentGainBuckets&&) = default;
+  ConcurrentGainBuckets & operator= (ConcurrentGainBuckets &&) = default;
+
+  // ! Returns the bucket of the corresponding gain
+  static size_t bucketOf(const Gain gain) {
+    if ( gain <= 0 ) {
+      return 0;
+    }
+    size_t bucket = 1;
+    for ( Gain g = gain; g > 1 && bucket < NUM_BUCKETS - 1; g >>= 1 ) {
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  // ! Inserts a value into the bucket that corresponds to its gain
+  void insert(const Gain gain, const Value& value) {
+    _buckets[bucketOf(gain)].stream(value);
+  }
+
+  // ! Inserts a value into the corresponding bucket
+  void insertIntoBucket(const size_t bucket, const Value& value) {
+    ASSERT(bucket < NUM_BUCKETS);
+    _buckets[bucket].stream(value);
+  }
+
+  // ! Returns whether the corresponding bucket is empty
+  bool empty(const size_t bucket) const {
+    ASSERT(bucket < NUM_BUCKETS);
+    return _buckets[bucket].size() == 0;
+  }
+
+  // ! Returns the total number of values in all buckets
+  size_t size() const {
+    size_t size = 0;
+    for ( const Bucket& bucket : _buckets ) {
+      size += bucket.size();
+    }
+    return size;
+  }
+
+  // ! Removes all values from the corresponding bucket and returns them.
+  // ! Note, values may be inserted into other buckets concurrently,
+  // ! but not into the bucket which is extracted.
+  parallel::scalable_vector<Value> extract(const size_t bucket, const bool parallel = true) {
+    ASSERT(bucket < NUM_BUCKETS);
+    parallel::scalable_vector<Value> values = parallel ?
+      _buckets[bucket].copy_parallel() : _buckets[bucket].copy_sequential();
+    _buckets[bucket].clear_sequential();
+    return values;
+  }
+
+  void clear() {
+    for ( Bucket& bucket : _buckets ) {
+      bucket.clear_sequential();
+    }
+  }
+
+ private:
+  parallel::scalable_vector<Bucket> _buckets;
+};
+
+}  // namespace ds
+}  // namespace mt_kahypar
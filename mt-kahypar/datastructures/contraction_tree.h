@@ -198,7 +198,9 @@ class ContractionTree {
       }
 
       inline void incrementPendingContractions() {
-        ++_pending_contractions;
+        // Several threads can register contractions on the same representative
+        // concurrently (see registerContractionOfRound(...) of the dynamic hypergraph)
+        __atomic_fetch_add(&_pending_contractions, 1, __ATOMIC_RELAXED);
       }
 
       inline void decrementPendingContractions() {
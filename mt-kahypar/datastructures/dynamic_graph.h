@@ -711,6 +711,19 @@ class DynamicGraph {
    */
   bool registerContraction(const HypernodeID u, const HypernodeID v);
 
+  /**!
+   * Registers a contraction of a round in which all contractions are known in advance.
+   * In contrast to registerContraction(u, v), the function does not acquire ownership of
+   * u and v and does not perform any cycle checks. Several threads can call this function
+   * in parallel, if (i) all involved vertices are roots of the contraction forest without
+   * pending contractions when the round starts, (ii) each vertex v is registered at most once
+   * as contraction partner and (iii) the contractions of the round do not induce a cycle.
+   */
+  void registerContractionOfRound(const HypernodeID u, const HypernodeID v) {
+    ASSERT(_contraction_tree.parent(v) == v, "Contraction already registered for hypernode" << v);
+    _contraction_tree.registerContraction(u, v, _version);
+  }
+
   /**!
    * Contracts a previously registered contraction. Representative u of vertex v is looked up
    * in the contraction tree and performed if there are no pending contractions in the subtree
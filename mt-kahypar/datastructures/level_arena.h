@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/parallel/stl/scalable_unique_ptr.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/*!
+ * Bump allocator for buffers whose lifetime is bounded by one level of the
+ * multilevel hierarchy. Each level opens a scope (see LevelArena::Level),
+ * bump-allocates its buffers and releases them all at once when the scope is
+ * closed. The underlying memory blocks are retained such that all consecutive
+ * levels are served without any further allocation.
+ *
+ * The first block is requested once from the memory pool (under the given
+ * group and key). If a level requires more memory than available, an
+ * additional block is allocated and kept for subsequent levels.
+ * Note, allocations are not thread-safe (buffers of a level are allocated
+ * sequentially before the level is processed in parallel).
+ */
+class LevelArena {
+
+  static constexpr size_t ALIGNMENT = 64;
+
+  struct Block {
+    char* data;
+    size_t size_in_bytes;
+  };
+
+  struct Marker {
+    size_t block;
+    size_t offset;
+    size_t used_bytes;
+  };
+
+ public:
+  struct Stats {
+    // ! Bytes reserved by the arena
+    size_t reserved_bytes = 0;
+    // ! Maximum number of bytes in use at the same time
+    size_t peak_used_bytes = 0;
+    // ! Bytes requested summed up over all levels
+    size_t requested_bytes = 0;
+    // ! Number of levels served by the arena
+    size_t num_levels = 0;
+
+    // ! Bytes that would have been allocated additionally,
+    // ! if each level allocates its own buffers
+    size_t savedBytes() const {
+      return requested_bytes > reserved_bytes ? requested_bytes - reserved_bytes : 0;
+    }
+  };
+
+  // ! Scope of one level. All buffers allocated within the
+  // ! scope are recycled when the scope is destroyed.
+  class Level {
+   public:
+    explicit Level(LevelArena& arena) :
+      _arena(arena),
+      _marker(arena.pushLevel()) { }
+
+    Level(const Level&) = delete;
+    Level & operator= (const Level &) = delete;
+    Level(Level&&) = delete;
+    Level & operator= (Level &&) = delete;
+
+    ~Level() {
+      _arena.popLevel(_marker);
+    }
+
+   private:
+    LevelArena& _arena;
+    const Marker _marker;
+  };
+
+  // ! Number of bytes that must be reserved to serve an allocation
+  // ! of the given number of elements without a further block
+  static constexpr size_t reservedBytes(const size_t num_elements, const size_t size) {
+    return num_elements * size + ALIGNMENT;
+  }
+
+  LevelArena(const std::string& group,
+             const std::string& key,
+             const size_t size_in_bytes) :
+    _pool_block(),
+    _additional_blocks(),
+    _blocks(),
+    _current({ 0, 0, 0 }),
+    _stats() {
+    if ( size_in_bytes > 0 ) {
+      _pool_block.resize(group, key, size_in_bytes);
+      _blocks.push_back(Block { _pool_block.data(), size_in_bytes });
+      _stats.reserved_bytes = size_in_bytes;
+    }
+  }
+
+  LevelArena(const LevelArena&) = delete;
+  LevelArena & operator= (const LevelArena &) = delete;
+  LevelArena(LevelArena&&) = delete;
+  LevelArena & operator= (LevelArena &&) = delete;
+
+  // ! Bump-allocates a buffer of the given number of elements in the current level
+  template<typename T>
+  T* allocate(const size_t num_elements) {
+    const size_t size_in_bytes = std::max(num_elements * sizeof(T), UL(1));
+    char* data = bump(size_in_bytes);
+    if ( !data ) {
+      // Current blocks are exhausted => add a block that is
+      // large enough to serve this and similar requests
+      addBlock(std::max(size_in_bytes + ALIGNMENT, _stats.reserved_bytes));
+      data = bump(size_in_bytes);
+      ASSERT(data);
+    }
+    _current.used_bytes += size_in_bytes;
+    _stats.requested_bytes += size_in_bytes;
+    _stats.peak_used_bytes = std::max(_stats.peak_used_bytes, _current.used_bytes);
+    return reinterpret_cast<T*>(data);
+  }
+
+  // ! Allocates a buffer in the current level and binds it to an array
+  template<typename T>
+  void allocate(Array<T>& array, const size_t num_elements) {
+    array.useExternalMemory(allocate<T>(num_elements), num_elements);
+  }
+
+  const Stats& stats() const {
+    return _stats;
+  }
+
+ private:
+  Marker pushLevel() {
+    ++_stats.num_levels;
+    return _current;
+  }
+
+  void popLevel(const Marker& marker) {
+    _current = marker;
+  }
+
+  char* bump(const size_t size_in_bytes) {
+    for ( ; _current.block < _blocks.size(); ++_current.block, _current.offset = 0 ) {
+      const Block& block = _blocks[_current.block];
+      const uintptr_t begin = reinterpret_cast<uintptr_t>(block.data) + _current.offset;
+      const uintptr_t aligned_begin = (begin + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+      const size_t aligned_offset = _current.offset + (aligned_begin - begin);
+      if ( aligned_offset + size_in_bytes <= block.size_in_bytes ) {
+        _current.offset = aligned_offset + size_in_bytes;
+        return block.data + aligned_offset;
+      }
+    }
+    return nullptr;
+  }
+
+  void addBlock(const size_t size_in_bytes) {
+    _additional_blocks.emplace_back(parallel::make_unique<char>(size_in_bytes));
+    _blocks.push_back(Block { _additional_blocks.back().get(), size_in_bytes });
+    _stats.reserved_bytes += size_in_bytes;
+  }
+
+  // ! Block requested from the memory pool
+  Array<char> _pool_block;
+  // ! Blocks allocated when the pool block was exhausted
+  parallel::scalable_vector<parallel::tbb_unique_ptr<char>> _additional_blocks;
+  parallel::scalable_vector<Block> _blocks;
+  // ! Bump pointer
+  Marker _current;
+  Stats _stats;
+};
+
+}  // namespace ds
+}  // namespace mt_kahypar
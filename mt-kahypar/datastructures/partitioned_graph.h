@@ -40,6 +40,7 @@
 #include "mt-kahypar/datastructures/connectivity_set.h"
 #include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/numa_placement.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/parallel/stl/thread_locals.h"
 #include "mt-kahypar/utils/range.h"
@@ -191,6 +192,7 @@ private:
     _edge_locks(
       "Refinement", "edge_locks", hypergraph.maxUniqueID(), false, false),
     _edge_markers(Hypergraph::is_static_hypergraph ? 0 : hypergraph.maxUniqueID()) {
+    parallel::NumaPlacement::instance().place(_part_ids.data(), _part_ids.size());
     _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition, false);
     _edge_sync.assign(hypergraph.maxUniqueID(), EdgeMove(), false);
     _edge_locks.assign(hypergraph.maxUniqueID(), SpinLock(), false);
@@ -214,6 +216,7 @@ private:
     tbb::parallel_invoke([&] {
       _part_ids.resize(
         "Refinement", "part_ids", hypergraph.initialNumNodes());
+      parallel::NumaPlacement::instance().place(_part_ids.data(), _part_ids.size());
       _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition);
     }, [&] {
       _edge_sync.resize(
@@ -41,6 +41,7 @@
 #include "mt-kahypar/datastructures/delta_val.h"
 #include "mt-kahypar/datastructures/conductance_pq.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/numa_placement.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/parallel/stl/thread_locals.h"
 #include "mt-kahypar/utils/range.h"
@@ -120,6 +121,7 @@ class PartitionedHypergraph {
     _pin_count_update_ownership(
         "Refinement", "pin_count_update_ownership", hypergraph.initialNumEdges(), true, false) {
     /// [debug] std::cerr << "PartitionedHypergraph::PartitionedHypergraph(k, hypergraph)" << std::endl;
+    parallel::NumaPlacement::instance().place(_part_ids.data(), _part_ids.size());
     _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition, false);
   }
 
@@ -143,6 +145,7 @@ class PartitionedHypergraph {
     tbb::parallel_invoke([&] {
       _part_ids.resize(
         "Refinement", "vertex_part_info", hypergraph.initialNumNodes());
+      parallel::NumaPlacement::instance().place(_part_ids.data(), _part_ids.size());
       _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition);
     }, [&] {
       _con_info = ConnectivityInformation(
@@ -36,6 +36,7 @@
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/pin_count_snapshot.h"
+#include "mt-kahypar/parallel/numa_placement.h"
 
 
 namespace mt_kahypar {
@@ -130,6 +131,8 @@ class PinCountInPart {
       _extraction_mask = std::pow(2UL, _bits_per_element) - UL(1);
       _pin_count_in_part.resize("Refinement", "pin_count_in_part",
         num_hyperedges * _values_per_hyperedge, true, assign_parallel);
+      parallel::NumaPlacement::instance().place(
+        _pin_count_in_part.data(), _pin_count_in_part.size());
     }
   }
 
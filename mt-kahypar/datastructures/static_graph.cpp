@@ -56,6 +56,9 @@ namespace mt_kahypar::ds {
     if ( !_tmp_contraction_buffer ) {
       allocateTmpContractionBuffer();
     }
+    // Buffers are recycled when the level scope is closed at the end of the contraction
+    LevelArena::Level level(_tmp_contraction_buffer->arena);
+    _tmp_contraction_buffer->allocate(_num_nodes, _num_edges);
 
     // AUXILIARY BUFFERS - Reused during multilevel hierarchy to prevent expensive allocations
     Array<HypernodeID>& mapping = _tmp_contraction_buffer->mapping;
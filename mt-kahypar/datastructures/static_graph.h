@@ -37,6 +37,7 @@
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/level_arena.h"
 #include "mt-kahypar/datastructures/fixed_vertex_support.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
@@ -404,26 +405,39 @@ class StaticGraph {
   // ! Contains buffers that are needed during multilevel contractions.
   // ! Struct is allocated on top level hypergraph and passed to each contracted
   // ! hypergraph such that memory can be reused in consecutive contractions.
+  // ! The buffers are bump-allocated from a level arena sized for the top level
+  // ! graph and recycled after each contraction.
   struct TmpContractionBuffer {
     explicit TmpContractionBuffer(const HypernodeID num_nodes,
-                                  const HyperedgeID num_edges) {
-      tbb::parallel_invoke([&] {
-        mapping.resize("Coarsening", "mapping", num_nodes);
-      }, [&] {
-        tmp_nodes.resize("Coarsening", "tmp_nodes", num_nodes);
-      }, [&] {
-        node_sizes.resize("Coarsening", "node_sizes", num_nodes);
-      }, [&] {
-        tmp_num_incident_edges.resize("Coarsening", "tmp_num_incident_edges", num_nodes);
-      }, [&] {
-        node_weights.resize("Coarsening", "node_weights", num_nodes);
-      }, [&] {
-        tmp_edges.resize("Coarsening", "tmp_edges", num_edges);
-      }, [&] {
-        edge_id_mapping.resize("Coarsening", "edge_id_mapping", num_edges / 2);
-      });
-    }
-
+                                  const HyperedgeID num_edges) :
+      arena("Coarsening", "contraction_buffer", sizeInBytes(num_nodes, num_edges)) { }
+
+    // ! Number of bytes required to contract a graph of the given size
+    static size_t sizeInBytes(const size_t num_nodes,
+                              const size_t num_edges) {
+      return LevelArena::reservedBytes(num_nodes, sizeof(HypernodeID)) +
+        LevelArena::reservedBytes(num_nodes, sizeof(Node)) +
+        LevelArena::reservedBytes(num_nodes, sizeof(HyperedgeID)) +
+        LevelArena::reservedBytes(num_nodes, sizeof(parallel::IntegralAtomicWrapper<HyperedgeID>)) +
+        LevelArena::reservedBytes(num_nodes, sizeof(parallel::IntegralAtomicWrapper<HypernodeWeight>)) +
+        LevelArena::reservedBytes(num_edges, sizeof(TmpEdgeInformation)) +
+        LevelArena::reservedBytes(num_edges / 2, sizeof(HyperedgeID));
+    }
+
+    // ! Bump-allocates all buffers for contracting a graph of the
+    // ! given size. Must be called within a level scope of the arena.
+    void allocate(const HypernodeID num_nodes,
+                  const HyperedgeID num_edges) {
+      arena.allocate(mapping, num_nodes);
+      arena.allocate(tmp_nodes, num_nodes);
+      arena.allocate(node_sizes, num_nodes);
+      arena.allocate(tmp_num_incident_edges, num_nodes);
+      arena.allocate(node_weights, num_nodes);
+      arena.allocate(tmp_edges, num_edges);
+      arena.allocate(edge_id_mapping, num_edges / 2);
+    }
+
+    LevelArena arena;
     Array<HypernodeID> mapping;
     Array<Node> tmp_nodes;
     Array<HyperedgeID> node_sizes;
@@ -774,6 +788,11 @@ class StaticGraph {
     return false;
   }
 
+  void registerContractionOfRound(const HypernodeID, const HypernodeID) {
+    throw UnsupportedOperationException(
+      "registerContractionOfRound(u, v) is not supported in static graph");
+  }
+
   size_t contract(const HypernodeID,
                   const HypernodeWeight max_node_weight = std::numeric_limits<HypernodeWeight>::max()) {
     unused(max_node_weight);
@@ -873,6 +892,11 @@ class StaticGraph {
     }
   }
 
+  // ! Statistics of the level arena that serves the contraction buffers
+  LevelArena::Stats tmpContractionBufferStats() const {
+    return _tmp_contraction_buffer ? _tmp_contraction_buffer->arena.stats() : LevelArena::Stats();
+  }
+
   void memoryConsumption(utils::MemoryTreeNode* parent) const;
 
     // ! Only for testing
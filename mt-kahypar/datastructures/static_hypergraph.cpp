@@ -27,6 +27,7 @@
 
 #include "static_hypergraph.h"
 
+#include "mt-kahypar/parallel/numa_placement.h"
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/datastructures/concurrent_bucket_map.h"
 #include "mt-kahypar/utils/timer.h"
@@ -66,6 +67,9 @@ namespace mt_kahypar::ds {
     if ( !_tmp_contraction_buffer ) {
       allocateTmpContractionBuffer();
     }
+    // Buffers are recycled when the level scope is closed at the end of the contraction
+    LevelArena::Level level(_tmp_contraction_buffer->arena);
+    _tmp_contraction_buffer->allocate(_num_hypernodes, _num_hyperedges, _num_pins);
 
     // Auxiliary buffers - reused during multilevel hierarchy to prevent expensive allocations
     Array<size_t>& mapping = _tmp_contraction_buffer->mapping;
@@ -417,6 +421,22 @@ namespace mt_kahypar::ds {
         const size_t num_pins = num_pins_prefix_sum.total_sum();
         hypergraph._num_pins = num_pins;
         hypergraph._incidence_array.resize(num_pins);
+        // The pins of a hyperedge are placed on the NUMA node that owns the hyperedge.
+        // The pins of coarse hyperedge he start at the first fine hyperedge mapped to he.
+        parallel::NumaPlacement::instance().placeGrouped(
+          hypergraph._incidence_array.data(), num_pins, num_hyperedges, [&](const size_t he) {
+            HyperedgeID first = 0;
+            HyperedgeID last = _num_hyperedges;
+            while ( first < last ) {
+              const HyperedgeID mid = first + (last - first) / 2;
+              if ( he_mapping[mid] < he ) {
+                first = mid + 1;
+              } else {
+                last = mid;
+              }
+            }
+            return first < _num_hyperedges ? num_pins_prefix_sum[first] : num_pins;
+          });
       }, [&] {
         hypergraph._hyperedges.resize(num_hyperedges);
       });
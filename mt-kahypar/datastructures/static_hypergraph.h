@@ -35,6 +35,7 @@
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/level_arena.h"
 #include "mt-kahypar/datastructures/fixed_vertex_support.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
@@ -346,31 +347,46 @@ class StaticHypergraph {
   // ! Contains buffers that are needed during multilevel contractions.
   // ! Struct is allocated on top level hypergraph and passed to each contracted
   // ! hypergraph such that memory can be reused in consecutive contractions.
+  // ! The buffers are bump-allocated from a level arena sized for the top level
+  // ! hypergraph and recycled after each contraction.
   struct TmpContractionBuffer {
     explicit TmpContractionBuffer(const HypernodeID num_hypernodes,
                                   const HyperedgeID num_hyperedges,
-                                  const HyperedgeID num_pins) {
-      tbb::parallel_invoke([&] {
-        mapping.resize("Coarsening", "mapping", num_hypernodes);
-      }, [&] {
-        tmp_hypernodes.resize("Coarsening", "tmp_hypernodes", num_hypernodes);
-      }, [&] {
-        tmp_incident_nets.resize("Coarsening", "tmp_incident_nets", num_pins);
-      }, [&] {
-        tmp_num_incident_nets.resize("Coarsening", "tmp_num_incident_nets", num_hypernodes);
-      }, [&] {
-        hn_weights.resize("Coarsening", "hn_weights", num_hypernodes);
-      }, [&] {
-        tmp_hyperedges.resize("Coarsening", "tmp_hyperedges", num_hyperedges);
-      }, [&] {
-        tmp_incidence_array.resize("Coarsening", "tmp_incidence_array", num_pins);
-      }, [&] {
-        he_sizes.resize("Coarsening", "he_sizes", num_hyperedges);
-      }, [&] {
-        valid_hyperedges.resize("Coarsening", "valid_hyperedges", num_hyperedges);
-      });
+                                  const HyperedgeID num_pins) :
+      arena("Coarsening", "contraction_buffer",
+        sizeInBytes(num_hypernodes, num_hyperedges, num_pins)) { }
+
+    // ! Number of bytes required to contract a hypergraph of the given size
+    static size_t sizeInBytes(const size_t num_hypernodes,
+                              const size_t num_hyperedges,
+                              const size_t num_pins) {
+      return LevelArena::reservedBytes(num_hypernodes, sizeof(size_t)) +
+        LevelArena::reservedBytes(num_hypernodes, sizeof(Hypernode)) +
+        LevelArena::reservedBytes(num_pins, sizeof(HyperedgeID)) +
+        LevelArena::reservedBytes(num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<size_t>)) +
+        LevelArena::reservedBytes(num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<HypernodeWeight>)) +
+        LevelArena::reservedBytes(num_hyperedges, sizeof(Hyperedge)) +
+        LevelArena::reservedBytes(num_pins, sizeof(HypernodeID)) +
+        2 * LevelArena::reservedBytes(num_hyperedges, sizeof(size_t));
     }
 
+    // ! Bump-allocates all buffers for contracting a hypergraph of the
+    // ! given size. Must be called within a level scope of the arena.
+    void allocate(const HypernodeID num_hypernodes,
+                  const HyperedgeID num_hyperedges,
+                  const HyperedgeID num_pins) {
+      arena.allocate(mapping, num_hypernodes);
+      arena.allocate(tmp_hypernodes, num_hypernodes);
+      arena.allocate(tmp_incident_nets, num_pins);
+      arena.allocate(tmp_num_incident_nets, num_hypernodes);
+      arena.allocate(hn_weights, num_hypernodes);
+      arena.allocate(tmp_hyperedges, num_hyperedges);
+      arena.allocate(tmp_incidence_array, num_pins);
+      arena.allocate(he_sizes, num_hyperedges);
+      arena.allocate(valid_hyperedges, num_hyperedges);
+    }
+
+    LevelArena arena;
     Array<size_t> mapping;
     Array<Hypernode> tmp_hypernodes;
     IncidentNets tmp_incident_nets;
@@ -955,6 +971,11 @@ class StaticHypergraph {
     }
   }
 
+  // ! Statistics of the level arena that serves the contraction buffers
+  LevelArena::Stats tmpContractionBufferStats() const {
+    return _tmp_contraction_buffer ? _tmp_contraction_buffer->arena.stats() : LevelArena::Stats();
+  }
+
   void memoryConsumption(utils::MemoryTreeNode* parent) const;
 
     // ! Only for testing
@@ -30,6 +30,7 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
+#include "mt-kahypar/parallel/numa_placement.h"
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/utils/timer.h"
 
@@ -120,6 +121,10 @@ namespace mt_kahypar::ds {
     hypergraph._total_degree = incident_net_prefix_sum.total_sum();
     hypergraph._incident_nets.resize(hypergraph._num_pins);
     hypergraph._incidence_array.resize(hypergraph._num_pins);
+    // The pins of a hyperedge are placed on the NUMA node that owns the hyperedge
+    parallel::NumaPlacement::instance().placeGrouped(
+      hypergraph._incidence_array.data(), hypergraph._incidence_array.size(),
+      num_hyperedges, [&](const size_t he) { return pin_prefix_sum[he]; });
 
     AtomicCounter incident_nets_position(num_hypernodes,
                                          parallel::IntegralAtomicWrapper<size_t>(0));
@@ -159,20 +159,42 @@ namespace mt_kahypar {
             ("show-memory-consumption",
              po::value<bool>(&context.partition.show_memory_consumption)->value_name("<bool>")->default_value(false),
              "If true, shows detailed information on how much memory was allocated and how memory was reused throughout partitioning.")
+            ("show-perf-counters",
+             po::value<bool>(&context.partition.show_perf_counters)->value_name("<bool>")->default_value(false),
+             "If true, measures hardware performance counters (IPC, L1d/LLC misses, branch misses) via perf_event_open "
+             "for each (sequential) timer phase, summed up over all threads. Ignored if perf events are not available.")
             ("show-advanced-cut-analysis",
              po::value<bool>(&context.partition.show_advanced_cut_analysis)->value_name("<bool>")->default_value(false),
              "If true, calculates cut matrix, potential positive gain move matrix and connected cut hyperedge components after partitioning.")
             ("enable-progress-bar",
              po::value<bool>(&context.partition.enable_progress_bar)->value_name("<bool>")->default_value(false),
              "If true, shows a progress bar during coarsening and refinement phase.")
-            ("time-limit", po::value<int>(&context.partition.time_limit)->value_name("<int>"),
-             "Time limit in seconds (currently not supported)")
+            ("time-limit", po::value<double>(&context.partition.time_limit)->value_name("<double>")->default_value(0.0),
+             "Wall-clock time limit in seconds (0 = no limit). Initial partitioning and refinement adapt their effort "
+             "to the remaining time, and V-cycles are performed as long as the time limit permits "
+             "(at most --num-vcycles, if set). Coarsening and initial partitioning are always completed "
+             "such that a valid partition can be returned.")
+            ("memory-limit", po::value<size_t>(&context.partition.memory_limit)->value_name("<size_t>")->default_value(0),
+             "Memory limit in MB (0 = no limit). If the projected memory usage of a phase exceeds the limit, "
+             "the partitioner falls back to variants with lower memory requirements "
+             "(sparse connectivity information, fewer parallel flow searches, smaller initial partitioning pools).")
             ("sp-process,s",
              po::value<bool>(&context.partition.sp_process_output)->value_name("<bool>")->default_value(false),
              "Summarize partitioning results in RESULT line compatible with sqlplottools "
              "(https://github.com/bingmann/sqlplottools)")
             ("csv", po::value<bool>(&context.partition.csv_output)->value_name("<bool>")->default_value(false),
              "Summarize results in CSV format")
+            ("trace-file",
+             po::value<std::string>(&context.partition.trace_file)->value_name("<string>"),
+             "If set, per-thread events (coarsening passes, LP rounds, localized FM searches, flow problems, ...) "
+             "are traced and written to this file in the Chrome trace event format (chrome://tracing or Perfetto)")
+            ("trace-buffer-size",
+             po::value<size_t>(&context.partition.trace_buffer_size)->value_name("<size_t>")->default_value(1UL << 18),
+             "Maximum number of traced events per thread (oldest events are overwritten)")
+            ("trace-moves",
+             po::value<bool>(&context.partition.trace_moves)->value_name("<bool>")->default_value(false),
+             "If true, per-move events (FM priority queue updates) are traced as well. Note that they can\n"
+             "overwrite all other events in the per-thread buffers unless --trace-buffer-size is increased.")
             ("algorithm-name",
              po::value<std::string>(&context.algorithm_name)->value_name("<std::string>")->default_value("MT-KaHyPar"),
              "An algorithm name to print into the summarized output (csv or sqlplottools). ")
@@ -199,6 +221,14 @@ namespace mt_kahypar {
             ("p-disable-community-detection-on-mesh-graphs",
              po::value<bool>(&context.preprocessing.disable_community_detection_for_mesh_graphs)->value_name("<bool>")->default_value(true),
              "If true, community detection is dynamically disabled for mesh graphs (as it is not effective for this type of graphs).")
+            ("p-use-communities-as-clustering",
+             po::value<bool>(&context.preprocessing.use_communities_as_clustering)->value_name("<bool>")->default_value(false),
+             "If true, the communities found in preprocessing are used directly as clustering (cluster preset only)\n"
+             "if their conductance is at most p-communities-as-clustering-max-conductance. The clustering is then\n"
+             "refined with label propagation on the input hypergraph and the multilevel hierarchy is skipped.")
+            ("p-communities-as-clustering-max-conductance",
+             po::value<double>(&context.preprocessing.communities_as_clustering_max_conductance)->value_name("<double>")->default_value(0.0),
+             "Maximum conductance of the community structure such that it is used directly as clustering.")
             ("p-louvain-edge-weight-function",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& type) {
@@ -310,7 +340,21 @@ namespace mt_kahypar {
             ("c-num-sub-rounds",
              po::value<size_t>(&context.coarsening.num_sub_rounds_deterministic)->value_name(
                      "<size_t>")->default_value(16),
-             "Number of sub-rounds used for deterministic coarsening.");
+             "Number of sub-rounds used for deterministic coarsening.")
+            ("c-nlevel-registration-sub-rounds",
+             po::value<size_t>(&context.coarsening.nlevel_registration_sub_rounds)->value_name(
+                     "<size_t>")->default_value(0),
+             "If greater than zero, the n-level coarsener collects contractions in thread-local buffers\n"
+             "and registers them without locks in the given number of sub-rounds per pass.\n"
+             "(0 = register each contraction with per-vertex locks)")
+            ("c-hierarchy-memory-budget",
+             po::value<size_t>()->value_name("<size_t>")->notifier(
+                     [&](const size_t budget_in_mb) {
+                       context.coarsening.hierarchy_memory_budget = budget_in_mb * 1024 * 1024;
+                     })->default_value(0),
+             "Memory budget in MB for the contracted hypergraphs of the multilevel hierarchy (0 = unlimited).\n"
+             "If the budget is exceeded, the finest levels are dropped and recomputed once from their communities\n"
+             "when uncoarsening reaches them, which lowers the memory during coarsening and initial partitioning.");
     return options;
   }
 
@@ -367,6 +411,11 @@ namespace mt_kahypar {
                                 &context.initial_partitioning.refinement.deterministic_refinement.use_active_node_set))->value_name(
                      "<bool>")->default_value(true),
              "Use active nodeset in synchronous label propagation")
+            ((initial_partitioning ? "i-r-sync-fm-sub-rounds" : "r-sync-fm-sub-rounds"),
+             po::value<size_t>((!initial_partitioning ? &context.refinement.deterministic_refinement.num_sub_rounds_fm :
+                                &context.initial_partitioning.refinement.deterministic_refinement.num_sub_rounds_fm))->value_name(
+                     "<size_t>")->default_value(4),
+             "Number of synchronous sub-rounds per round of deterministic FM")
             ((initial_partitioning ? "i-r-lp-rebalancing" : "r-lp-rebalancing"),
              po::value<bool>((!initial_partitioning ? &context.refinement.label_propagation.rebalancing :
                               &context.initial_partitioning.refinement.label_propagation.rebalancing))->value_name(
@@ -377,6 +426,12 @@ namespace mt_kahypar {
                               &context.initial_partitioning.refinement.label_propagation.unconstrained))->value_name(
                      "<bool>")->default_value(false),
              "If true, then unconstrained label propagation (including rebalancing) is used.")
+            ((initial_partitioning ? "i-r-lp-priority-ordered" : "r-lp-priority-ordered"),
+             po::value<bool>((!initial_partitioning ? &context.refinement.label_propagation.priority_ordered :
+                              &context.initial_partitioning.refinement.label_propagation.priority_ordered))->value_name(
+                     "<bool>")->default_value(false),
+             "If true, then active nodes are distributed into gain buckets and processed in decreasing order of their gain.\n"
+             "The gain of a node is revalidated when it is processed (only in label propagation)")
             ((initial_partitioning ? "i-r-lp-he-size-activation-threshold" : "r-lp-he-size-activation-threshold"),
              po::value<size_t>(
                      (!initial_partitioning ? &context.refinement.label_propagation.hyperedge_size_activation_threshold
@@ -401,6 +456,7 @@ namespace mt_kahypar {
              "FM Algorithm:\n"
              "- kway_fm\n"
              "- unconstrained_fm\n"
+             "- deterministic\n"
              "- do_nothing")
             ((initial_partitioning ? "i-r-fm-multitry-rounds" : "r-fm-multitry-rounds"),
              po::value<size_t>((initial_partitioning ? &context.initial_partitioning.refinement.fm.multitry_rounds :
@@ -486,6 +542,29 @@ namespace mt_kahypar {
              "If the FM time exceeds time_limit := k * factor * coarsening_time, than the FM config is switched into a light version."
              "If the FM refiner exceeds 2 * time_limit, than the current multitry FM run is aborted and the algorithm proceeds to"
              "the next finer level.")
+            ((initial_partitioning ? "i-r-fm-adaptive-round-budget" : "r-fm-adaptive-round-budget"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.fm.adaptive_round_budget :
+                              &context.refinement.fm.adaptive_round_budget))->value_name("<bool>")->default_value(false),
+             "If true, multitry FM records the improvement per second of each round and stops on a level "
+             "once a round falls below a fraction of the average rate of all previous rounds (including coarser levels).")
+            ((initial_partitioning ? "i-r-fm-round-budget-min-rate-fraction" : "r-fm-round-budget-min-rate-fraction"),
+             po::value<double>((initial_partitioning ? &context.initial_partitioning.refinement.fm.round_budget_min_rate_fraction :
+                                &context.refinement.fm.round_budget_min_rate_fraction))->value_name("<double>")->default_value(0.1),
+             "Minimum fraction of the average improvement per second a round must achieve such that "
+             "the adaptive round budget grants another round.")
+            ((initial_partitioning ? "i-r-fm-pipelined-lp" : "r-fm-pipelined-lp"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.fm.pipelined_label_propagation :
+                              &context.refinement.fm.pipelined_label_propagation))->value_name("<bool>")->default_value(false),
+             "If true, label propagation is not executed as a separate refinement phase. Instead, each FM round first "
+             "moves chunks of border nodes to their best block (label propagation) and the FM tasks continue with "
+             "localized searches as soon as no chunk is left. Node ownership is resolved via the FM node tracker. "
+             "Label propagation is pipelined within the first r-lp-maximum-iterations rounds. Only supported for "
+             "non-deterministic (constrained) label propagation in multilevel mode.")
+            ((initial_partitioning ? "i-r-fm-graph-specialized-delta-updates" : "r-fm-graph-specialized-delta-updates"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.fm.graph_specialized_delta_updates :
+                              &context.refinement.fm.graph_specialized_delta_updates))->value_name("<bool>")->default_value(true),
+             "If true, localized FM searches on graphs (cut metric) update their local gain deltas directly from the\n"
+             "incident edges of a moved node instead of using the generic synchronized edge updates.")
             ((initial_partitioning ? "i-r-use-global-fm" : "r-use-global-fm"),
              po::value<bool>((!initial_partitioning ? &context.refinement.global_fm.use_global_fm :
                               &context.initial_partitioning.refinement.global_fm.use_global_fm))->value_name(
@@ -568,6 +647,20 @@ namespace mt_kahypar {
              po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.pierce_in_bulk :
                               &context.refinement.flows.pierce_in_bulk))->value_name("<bool>"),
              "If true, then FlowCutter is accelerated by piercing multiple nodes at a time")
+            ((initial_partitioning ? "i-r-flow-cache-constructions" : "r-flow-cache-constructions"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.cache_constructions :
+                              &context.refinement.flows.cache_constructions))->value_name("<bool>"),
+             "If true, the region grown for a block pair is cached and reused in later rounds if only few of its nodes have moved since.")
+            ((initial_partitioning ? "i-r-flow-max-changed-cached-region-fraction" : "r-flow-max-changed-cached-region-fraction"),
+             po::value<double>((initial_partitioning ? &context.initial_partitioning.refinement.flows.max_changed_cached_region_fraction :
+                      &context.refinement.flows.max_changed_cached_region_fraction))->value_name("<double>"),
+             "A cached flow region is only reused if at most this fraction of its nodes changed their block since it was grown.")
+            ((initial_partitioning ? "i-r-flow-multiway-num-blocks" : "r-flow-multiway-num-blocks"),
+             po::value<size_t>((initial_partitioning ? &context.initial_partitioning.refinement.flows.multiway_num_blocks :
+                      &context.refinement.flows.multiway_num_blocks))->value_name("<size_t>"),
+             "If >= 3, then clusters of up to this many mutually adjacent blocks are refined after the two-way flow refinement\n"
+             "by solving two-way flow problems on the block pairs of a cluster one after another. Each flow problem\n"
+             "covers only two blocks, but sees the moves of the previous steps. (default: 0 = disabled)")
             ((initial_partitioning ? "i-r-flow-scaling" : "r-flow-scaling"),
              po::value<double>((initial_partitioning ? &context.initial_partitioning.refinement.flows.alpha :
                       &context.refinement.flows.alpha))->value_name("<double>"),
@@ -731,7 +824,13 @@ namespace mt_kahypar {
             ("s-shuffle-block-size",
              po::value<size_t>(&context.shared_memory.shuffle_block_size)->value_name("<size_t>"),
              "If we perform a localized random shuffle in parallel, we perform a parallel for over blocks of size"
-             "'shuffle_block_size' and shuffle them sequential.");
+             "'shuffle_block_size' and shuffle them sequential.")
+            ("s-numa-aware-placement",
+             po::value<bool>(&context.shared_memory.numa_aware_placement)->value_name("<bool>"),
+             "If true, node and edge ranges of large arrays (incidence array, part IDs, pin counts, gain cache) "
+             "are placed on the NUMA node whose threads process them in label propagation and coarsening. "
+             "Only has an effect if more than one NUMA node is used and thread pinning is enabled "
+             "(-DKAHYPAR_ENABLE_THREAD_PINNING=ON).");
 
     return shared_memory_options;
   }
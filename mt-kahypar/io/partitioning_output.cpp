@@ -36,12 +36,14 @@
 #include <tbb/enumerable_thread_specific.h>
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/memory_accounting.h"
 #include "mt-kahypar/parallel/memory_pool.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
 #include "mt-kahypar/utils/hypergraph_statistics.h"
 #include "mt-kahypar/utils/memory_tree.h"
+#include "mt-kahypar/utils/perf_counters.h"
 #include "mt-kahypar/utils/timer.h"
 
 #include "kahypar-resources/utils/math.h"
@@ -664,6 +666,25 @@ namespace mt_kahypar::io {
       timer.showDetailedTimings(context.partition.show_detailed_timings);
       timer.setMaximumOutputDepth(context.partition.timings_output_depth);
       LOG << timer;
+
+      if ( context.partition.show_memory_consumption ) {
+        const parallel::MemoryAccounting& accounting = parallel::MemoryAccounting::instance();
+        LOG << "\nPeak Memory Consumption (overall =" << static_cast<double>(accounting.peakBytes()) / 1000000.0 << "MB):";
+        timer.printPeakMemory(std::cout);
+      }
+
+      if ( context.partition.show_perf_counters && utils::PerfCounters::instance().isEnabled() ) {
+        LOG << "\nHardware Performance Counters:";
+        timer.printPerfCounters(std::cout);
+        LOG << "\nHardware Performance Counters Per Thread:";
+        const std::vector<utils::PerfCounterValues> counters =
+          utils::PerfCounters::instance().readPerThread();
+        for ( size_t i = 0; i < counters.size(); ++i ) {
+          LOG << " + Thread" << i << ": IPC =" << counters[i].ipc()
+              << ", cycles =" << counters[i][utils::PerfCounter::cycles]
+              << ", llc_misses =" << counters[i][utils::PerfCounter::llc_misses];
+        }
+      }
     }
   }
 
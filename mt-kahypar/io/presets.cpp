@@ -425,9 +425,27 @@ std::vector<option> load_deterministic_preset() {
     create_option("r-lp-he-size-activation-threshold", "100"),
     create_option("r-sync-lp-active-nodeset", "true"),
     // main -> refinement -> fm
-    create_option("r-fm-type", "do_nothing"),
+    create_option("r-fm-type", "deterministic"),
+    create_option("r-fm-multitry-rounds", "10"),
+    create_option("r-fm-rollback-parallel", "true"),
+    create_option("r-fm-rollback-balance-violation-factor", "1.0"),
+    create_option("r-fm-seed-nodes", "25"),
+    create_option("r-fm-min-improvement", "-1.0"),
+    create_option("r-sync-fm-sub-rounds", "4"),
     // main -> refinement -> flows
-    create_option("r-flow-algo", "do_nothing"),
+    create_option("r-flow-algo", "flow_cutter"),
+    create_option("r-flow-scaling", "16"),
+    create_option("r-flow-max-num-pins", "4294967295"),
+    create_option("r-flow-find-most-balanced-cut", "true"),
+    create_option("r-flow-determine-distance-from-cut", "true"),
+    create_option("r-flow-parallel-search-multiplier", "1.0"),
+    create_option("r-flow-max-bfs-distance", "2"),
+    create_option("r-flow-min-relative-improvement-per-round", "0.001"),
+    create_option("r-flow-time-limit-factor", "8"),
+    create_option("r-flow-skip-small-cuts", "true"),
+    create_option("r-flow-skip-unpromising-blocks", "true"),
+    create_option("r-flow-pierce-in-bulk", "true"),
+    create_option("r-flow-process-mapping-policy", "lower_bound"),
     // main -> mapping
     create_option("one-to-one-mapping-strategy", "greedy_mapping"),
     create_option("mapping-use-local-search", "true"),
@@ -532,6 +550,8 @@ std::vector<option> load_clustering_preset() {
     create_option("s-static-balancing-work-packages", "128"),
     // main -> preprocessing
     create_option("p-enable-community-detection", "true"),
+    create_option("p-use-communities-as-clustering", "true"),
+    create_option("p-communities-as-clustering-max-conductance", "0.25"),
     // main -> preprocessing -> community_detection
     create_option("p-louvain-edge-weight-function", "hybrid"),
     create_option("p-max-louvain-pass-iterations", "5"),
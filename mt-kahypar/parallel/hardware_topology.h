@@ -247,6 +247,13 @@ class HardwareTopology {
     hwloc_set_membind(_topology, cpuset, HWLOC_MEMBIND_INTERLEAVE, HWLOC_MEMBIND_MIGRATE);
   }
 
+  // ! Binds the memory area to a NUMA node. Pages that are already
+  // ! allocated are migrated, all other pages are allocated on first touch.
+  void bind_memory_to_numa_node(const void* addr, const size_t len, const int node) const {
+    hwloc_set_area_membind(_topology, addr, len,
+      get_cpuset_of_numa_node(node), HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_MIGRATE);
+  }
+
  private:
   HardwareTopology() :
     _num_cpus(0),
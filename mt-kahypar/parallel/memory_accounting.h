@@ -0,0 +1,206 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/bit_ops.h"
+
+namespace mt_kahypar {
+namespace parallel {
+
+/*!
+ * Global accounting of the memory allocated via the scalable allocators
+ * (parallel::scalable_vector, ds::Array and the memory pool).
+ * In order to keep the overhead on the allocation path low, each thread
+ * accumulates its allocations in a thread-local counter, which is only
+ * flushed to the global counter if it exceeds FLUSH_THRESHOLD bytes.
+ * Thus, the reported values are accurate up to FLUSH_THRESHOLD bytes per thread.
+ *
+ * The accounting additionally provides peak trackers, which record the high-water
+ * mark of a phase (startPeakTracking() / stopPeakTracking()). Each sequential timing
+ * of a utils::Timer owns a peak tracker. Furthermore, it stores the memory limit of the
+ * partitioner, which is used to decide whether or not the next phase has to
+ * fall back to a variant with lower memory requirements.
+ */
+class MemoryAccounting {
+
+  static constexpr int64_t FLUSH_THRESHOLD = 1 << 20; // 1 MB
+  static constexpr size_t MAX_PEAK_TRACKERS = 64;
+
+ public:
+  static constexpr size_t kNoMemoryLimit = std::numeric_limits<size_t>::max();
+  static constexpr size_t kNoPeakTracker = std::numeric_limits<size_t>::max();
+
+  MemoryAccounting(const MemoryAccounting&) = delete;
+  MemoryAccounting & operator= (const MemoryAccounting &) = delete;
+
+  MemoryAccounting(MemoryAccounting&&) = delete;
+  MemoryAccounting & operator= (MemoryAccounting &&) = delete;
+
+  static MemoryAccounting& instance() {
+    static MemoryAccounting instance;
+    return instance;
+  }
+
+  void allocate(const size_t size_in_bytes) {
+    update(static_cast<int64_t>(size_in_bytes));
+  }
+
+  void deallocate(const size_t size_in_bytes) {
+    update(-static_cast<int64_t>(size_in_bytes));
+  }
+
+  // ! Number of bytes that are currently allocated
+  size_t currentBytes() const {
+    return clamp(_current_bytes.load(std::memory_order_relaxed));
+  }
+
+  // ! Maximum number of bytes that were allocated at the same time
+  size_t peakBytes() const {
+    return clamp(_peak_bytes.load(std::memory_order_relaxed));
+  }
+
+  // ! Resets the global high-water mark to the current memory usage
+  void resetPeakBytes() {
+    _peak_bytes.store(_current_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  void setMemoryLimit(const size_t memory_limit) {
+    _memory_limit.store(memory_limit, std::memory_order_relaxed);
+  }
+
+  size_t memoryLimit() const {
+    return _memory_limit.load(std::memory_order_relaxed);
+  }
+
+  bool hasMemoryLimit() const {
+    return memoryLimit() != kNoMemoryLimit;
+  }
+
+  // ! Number of bytes that can be allocated without exceeding the memory limit
+  size_t remainingBytes() const {
+    const size_t limit = memoryLimit();
+    const size_t current = currentBytes();
+    return current < limit ? limit - current : 0;
+  }
+
+  // ! Returns true, if allocating additionally projected_bytes
+  // ! does not exceed the memory limit
+  bool fitsIntoMemoryLimit(const size_t projected_bytes) const {
+    return projected_bytes <= remainingBytes();
+  }
+
+  // ! Starts tracking the high-water mark of the memory usage, which is initialized
+  // ! with the current memory usage. Returns the ID of the peak tracker, or
+  // ! kNoPeakTracker if all trackers are in use. A tracker is owned by the caller
+  // ! (e.g., an active timing of a utils::Timer), such that the timers of concurrent
+  // ! partitioning calls do not interfere. Overlapping trackers all observe each allocation.
+  size_t startPeakTracking() {
+    uint64_t used = _used_peak_trackers.load(std::memory_order_relaxed);
+    while ( used != ~UINT64_C(0) ) {
+      const size_t tracker = utils::lowest_set_bit_64(~used);
+      if ( _used_peak_trackers.compare_exchange_weak(used, used | (UINT64_C(1) << tracker),
+            std::memory_order_acq_rel) ) {
+        _peak_trackers[tracker].store(_current_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return tracker;
+      }
+    }
+    return kNoPeakTracker;
+  }
+
+  // ! Stops the peak tracker and returns the high-water mark in bytes since it was started.
+  // ! If no tracker was available, the global high-water mark is returned.
+  size_t stopPeakTracking(const size_t tracker) {
+    if ( tracker == kNoPeakTracker ) {
+      return peakBytes();
+    }
+    ASSERT(tracker < MAX_PEAK_TRACKERS);
+    const int64_t peak = std::max(_peak_trackers[tracker].load(std::memory_order_relaxed),
+                                  _current_bytes.load(std::memory_order_relaxed));
+    _used_peak_trackers.fetch_and(~(UINT64_C(1) << tracker), std::memory_order_release);
+    return clamp(peak);
+  }
+
+ private:
+  MemoryAccounting() :
+    _current_bytes(0),
+    _peak_bytes(0),
+    _memory_limit(kNoMemoryLimit),
+    _used_peak_trackers(0),
+    _peak_trackers() { }
+
+  void update(const int64_t delta) {
+    int64_t& pending = localPendingBytes();
+    pending += delta;
+    if ( pending >= FLUSH_THRESHOLD || pending <= -FLUSH_THRESHOLD ) {
+      flush(pending);
+    }
+  }
+
+  void flush(int64_t& pending) {
+    const int64_t current = _current_bytes.fetch_add(
+      pending, std::memory_order_relaxed) + pending;
+    if ( pending > 0 ) {
+      updateMaximum(_peak_bytes, current);
+      uint64_t used = _used_peak_trackers.load(std::memory_order_acquire);
+      while ( used != 0 ) {
+        updateMaximum(_peak_trackers[utils::lowest_set_bit_64(used)], current);
+        used &= used - 1;
+      }
+    }
+    pending = 0;
+  }
+
+  static void updateMaximum(std::atomic<int64_t>& maximum, const int64_t value) {
+    int64_t current_maximum = maximum.load(std::memory_order_relaxed);
+    while ( value > current_maximum &&
+            !maximum.compare_exchange_weak(current_maximum, value, std::memory_order_relaxed) ) { }
+  }
+
+  static size_t clamp(const int64_t value) {
+    return value > 0 ? static_cast<size_t>(value) : 0;
+  }
+
+  static int64_t& localPendingBytes() {
+    static thread_local int64_t pending = 0;
+    return pending;
+  }
+
+  std::atomic<int64_t> _current_bytes;
+  std::atomic<int64_t> _peak_bytes;
+  std::atomic<size_t> _memory_limit;
+  // ! Bitmask of the peak trackers that are in use
+  std::atomic<uint64_t> _used_peak_trackers;
+  std::array<std::atomic<int64_t>, MAX_PEAK_TRACKERS> _peak_trackers;
+};
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -44,6 +44,7 @@
 #include <tbb/scalable_allocator.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/memory_accounting.h"
 #include "mt-kahypar/parallel/stl/scalable_unique_ptr.h"
 #include "mt-kahypar/utils/memory_tree.h"
 
@@ -159,6 +160,7 @@ class MemoryPoolT {
     bool allocate() {
       if ( !_data && !_defer_allocation ) {
         _data = (char*) scalable_calloc(_num_elements, _size);
+        MemoryAccounting::instance().allocate(size_in_bytes());
         return true;
       } else {
         return false;
@@ -168,6 +170,7 @@ class MemoryPoolT {
     // ! Frees the memory chunk
     void free() {
       if ( _data ) {
+        MemoryAccounting::instance().deallocate(size_in_bytes());
         scalable_free(_data);
         _data = nullptr;
       }
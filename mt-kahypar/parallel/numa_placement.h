@@ -0,0 +1,279 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+
+// Per-thread data structures (e.g., streaming vectors and random number generators)
+// are indexed by THREAD_ID. Only if threads are pinned, THREAD_ID is a CPU ID that is
+// unique across task arenas. Otherwise, it is the slot index of the current task arena,
+// which threads of different NUMA task arenas share at the same time.
+#if defined(KAHYPAR_ENABLE_THREAD_PINNING) && !defined(MT_KAHYPAR_LIBRARY_MODE) && \
+    !defined(KAHYPAR_DISABLE_HWLOC)
+#define KAHYPAR_HAS_NUMA_TASK_ARENAS
+#endif
+
+namespace mt_kahypar {
+namespace parallel {
+
+/**
+ * NUMA-aware placement of large node- and edge-indexed arrays. An ID range [0, n)
+ * is split into one contiguous range per used NUMA node (proportional to the number
+ * of threads running on that NUMA node). place(...) binds the memory of each range
+ * to its NUMA node and parallel_for(...) processes each range with threads that are
+ * pinned to the owning NUMA node (in a task arena of that NUMA node).
+ *
+ * The placement is disabled by default, if only one NUMA node is used and if thread
+ * pinning is disabled (see KAHYPAR_HAS_NUMA_TASK_ARENAS). In that case, place(...) is
+ * a no-op and parallel_for(...) falls back to tbb::parallel_for.
+ */
+class NumaPlacement {
+
+  static constexpr bool debug = false;
+  static constexpr size_t PAGE_SIZE = 4096;
+
+ public:
+  NumaPlacement(const NumaPlacement&) = delete;
+  NumaPlacement & operator= (const NumaPlacement &) = delete;
+
+  NumaPlacement(NumaPlacement&&) = delete;
+  NumaPlacement & operator= (NumaPlacement &&) = delete;
+
+  static NumaPlacement& instance() {
+    static NumaPlacement instance;
+    return instance;
+  }
+
+  // ! Must be called after the TBBInitializer is initialized
+  void enable() {
+    #ifdef KAHYPAR_HAS_NUMA_TASK_ARENAS
+    mt_kahypar::TBBInitializer& tbb_initializer = mt_kahypar::TBBInitializer::instance();
+    _numa_nodes.clear();
+    _thread_prefix_sum.assign(1, 0);
+    for ( int node = 0; node < tbb_initializer.num_used_numa_nodes(); ++node ) {
+      const size_t num_threads = tbb_initializer.number_of_used_cpus_on_numa_node(node);
+      if ( num_threads > 0 ) {
+        _numa_nodes.push_back(node);
+        _thread_prefix_sum.push_back(_thread_prefix_sum.back() + num_threads);
+      }
+    }
+    if ( _numa_nodes.size() > 1 ) {
+      tbb_initializer.initialize_numa_arenas();
+      _is_enabled = true;
+      _bind_memory = true;
+    }
+    DBG << "NUMA-aware placement on" << _numa_nodes.size() << "NUMA nodes"
+        << V(_is_enabled);
+    #else
+    WARNING("NUMA-aware placement requires thread pinning"
+      << "(add -DKAHYPAR_ENABLE_THREAD_PINNING=ON to the cmake command) and is ignored");
+    #endif
+  }
+
+  void disable() {
+    _is_enabled = false;
+  }
+
+  // ! Only for testing: Enables the placement on (virtual) NUMA nodes with the
+  // ! given number of threads without creating task arenas or binding memory
+  void enableWithoutHardwareBinding(const std::vector<size_t>& threads_per_numa_node) {
+    _numa_nodes.clear();
+    _thread_prefix_sum.assign(1, 0);
+    for ( size_t node = 0; node < threads_per_numa_node.size(); ++node ) {
+      if ( threads_per_numa_node[node] > 0 ) {
+        _numa_nodes.push_back(static_cast<int>(node));
+        _thread_prefix_sum.push_back(_thread_prefix_sum.back() + threads_per_numa_node[node]);
+      }
+    }
+    _is_enabled = _numa_nodes.size() > 1;
+    _bind_memory = false;
+  }
+
+  bool isEnabled() const {
+    return _is_enabled;
+  }
+
+  size_t numNumaNodes() const {
+    return _is_enabled ? _numa_nodes.size() : 1;
+  }
+
+  // ! First ID of the range [0, n) owned by the i-th used NUMA node
+  size_t rangeBegin(const size_t i, const size_t n) const {
+    ASSERT(i <= numNumaNodes());
+    if ( !_is_enabled ) {
+      return i == 0 ? 0 : n;
+    }
+    return (n * _thread_prefix_sum[i]) / _thread_prefix_sum.back();
+  }
+
+  // ! Index of the used NUMA node that owns ID id of the range [0, n)
+  size_t owner(const size_t id, const size_t n) const {
+    ASSERT(id < n);
+    size_t i = 0;
+    while ( i + 1 < numNumaNodes() && rangeBegin(i + 1, n) <= id ) {
+      ++i;
+    }
+    return i;
+  }
+
+  // ! Range boundaries of all used NUMA nodes for the range [0, n)
+  std::vector<size_t> rangeBounds(const size_t n) const {
+    std::vector<size_t> bounds(numNumaNodes() + 1);
+    for ( size_t i = 0; i <= numNumaNodes(); ++i ) {
+      bounds[i] = rangeBegin(i, n);
+    }
+    return bounds;
+  }
+
+  // ! Range boundaries of all used NUMA nodes for an array with size entries that
+  // ! are grouped by the IDs of the range [0, n) (e.g., the incidence array, which
+  // ! stores the pins of each hyperedge consecutively). The entries of an ID start at
+  // ! position first_entry(id), and all entries of an ID belong to the owner of the ID.
+  template<typename FirstEntryFunc>
+  std::vector<size_t> entryBounds(const size_t size,
+                                  const size_t n,
+                                  const FirstEntryFunc& first_entry) const {
+    std::vector<size_t> bounds = rangeBounds(n);
+    for ( size_t i = 1; i < numNumaNodes(); ++i ) {
+      bounds[i] = bounds[i] < n ? first_entry(bounds[i]) : size;
+      ASSERT(bounds[i - 1] <= bounds[i]);
+    }
+    bounds.back() = size;
+    return bounds;
+  }
+
+  // ! Binds the memory of data[0, size) such that the range owned by
+  // ! a NUMA node is placed on that NUMA node
+  template<typename T>
+  void place(const T* data, const size_t size) const {
+    if ( _is_enabled ) {
+      placeRanges(data, rangeBounds(size));
+    }
+  }
+
+  // ! Binds the memory of data[0, size), whose entries are grouped by the IDs of
+  // ! the range [0, n), such that the entries of an ID are placed on the NUMA node
+  // ! owning the ID (see entryBounds(...))
+  template<typename T, typename FirstEntryFunc>
+  void placeGrouped(const T* data,
+                    const size_t size,
+                    const size_t n,
+                    const FirstEntryFunc& first_entry) const {
+    if ( _is_enabled ) {
+      placeRanges(data, entryBounds(size, n, first_entry));
+    }
+  }
+
+  // ! Calls f(id) for all IDs in [0, n). The range owned by a NUMA node
+  // ! is processed by threads of that NUMA node.
+  template<typename F>
+  void parallel_for(const size_t n, const F& f) const {
+    parallel_for(rangeBounds(n), f);
+  }
+
+  // ! Calls f(j) for all j in [bounds[i], bounds[i + 1]) with threads of the i-th used NUMA node
+  template<typename F>
+  void parallel_for(const std::vector<size_t>& bounds, const F& f) const {
+    ASSERT(bounds.size() == numNumaNodes() + 1);
+    #ifdef KAHYPAR_HAS_NUMA_TASK_ARENAS
+    if ( _is_enabled ) {
+      tbb::task_group tg;
+      for ( size_t i = 0; i < numNumaNodes(); ++i ) {
+        tg.run([&, i] {
+          mt_kahypar::TBBInitializer::instance().execute_on_numa_node(_numa_nodes[i], [&] {
+            tbb::parallel_for(bounds[i], bounds[i + 1], f);
+          });
+        });
+      }
+      tg.wait();
+      return;
+    }
+    #endif
+    tbb::parallel_for(bounds.front(), bounds.back(), f);
+  }
+
+ private:
+  NumaPlacement() :
+    _is_enabled(false),
+    _bind_memory(false),
+    _numa_nodes(),
+    _thread_prefix_sum(1, 0) { }
+
+  // ! Binds the memory of data[bounds[i], bounds[i + 1]) to the i-th used NUMA node
+  template<typename T>
+  void placeRanges(const T* data, const std::vector<size_t>& bounds) const {
+    ASSERT(bounds.size() == numNumaNodes() + 1);
+    #ifndef KAHYPAR_DISABLE_HWLOC
+    if ( _is_enabled && _bind_memory && data != nullptr && bounds.back() > 0 ) {
+      // Pages that are only partially covered by the array can contain other
+      // allocations and are therefore not placed
+      const uintptr_t start = reinterpret_cast<uintptr_t>(data);
+      const uintptr_t first_page = alignUp(start);
+      const uintptr_t end_of_last_page = alignDown(start + bounds.back() * sizeof(T));
+      for ( size_t i = 0; i < numNumaNodes(); ++i ) {
+        // A page that contains a range boundary is placed on the NUMA node whose range starts in it
+        const uintptr_t range_start = std::max(first_page,
+          alignDown(start + bounds[i] * sizeof(T)));
+        const uintptr_t range_end = i + 1 == numNumaNodes() ? end_of_last_page :
+          std::min(end_of_last_page, alignDown(start + bounds[i + 1] * sizeof(T)));
+        if ( range_start < range_end ) {
+          mt_kahypar::HardwareTopology::instance().bind_memory_to_numa_node(
+            reinterpret_cast<const void*>(range_start), range_end - range_start, _numa_nodes[i]);
+        }
+      }
+    }
+    #else
+    unused(data);
+    unused(bounds);
+    #endif
+  }
+
+  static uintptr_t alignDown(const uintptr_t addr) {
+    return addr & ~(PAGE_SIZE - 1);
+  }
+
+  static uintptr_t alignUp(const uintptr_t addr) {
+    return alignDown(addr + PAGE_SIZE - 1);
+  }
+
+  bool _is_enabled;
+  // ! False, if the placement is only simulated (for testing)
+  bool _bind_memory;
+  // ! IDs of the used NUMA nodes
+  std::vector<int> _numa_nodes;
+  // ! Prefix sum over the number of threads on the used NUMA nodes
+  std::vector<size_t> _thread_prefix_sum;
+};
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -31,14 +31,20 @@
 
 #include <tbb/scalable_allocator.h>
 
+#include "mt-kahypar/parallel/memory_accounting.h"
+
 namespace mt_kahypar {
 namespace parallel {
 
 template<typename T>
 struct tbb_deleter {
   void operator()(T *p) {
+    MemoryAccounting::instance().deallocate(size_in_bytes);
     scalable_free(p);
   }
+
+  // ! Size of the allocation (reported to the memory accounting)
+  size_t size_in_bytes = 0;
 };
 
 template<typename T>
@@ -47,7 +53,8 @@ using tbb_unique_ptr = std::unique_ptr<T, tbb_deleter<T>>;
 template<typename T>
 static tbb_unique_ptr<T> make_unique(const size_t size) {
   T* ptr = (T*) scalable_malloc(sizeof(T) * size);
-  return tbb_unique_ptr<T>(ptr, parallel::tbb_deleter<T>());
+  MemoryAccounting::instance().allocate(sizeof(T) * size);
+  return tbb_unique_ptr<T>(ptr, parallel::tbb_deleter<T> { sizeof(T) * size });
 }
 
 }  // namespace parallel
@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <new>
 #include <vector>
 
 #include <tbb/parallel_for.h>
@@ -34,15 +35,60 @@
 #include <tbb/scalable_allocator.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/memory_accounting.h"
 
 namespace mt_kahypar {
+namespace parallel {
+
+// ! Scalable allocator that reports its allocations to the memory accounting
+template <typename T>
+class accounted_scalable_allocator {
+ public:
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = accounted_scalable_allocator<U>;
+  };
+
+  accounted_scalable_allocator() noexcept = default;
+
+  template <typename U>
+  accounted_scalable_allocator(const accounted_scalable_allocator<U>&) noexcept { }
+
+  T* allocate(const size_t n) {
+    T* ptr = static_cast<T*>(scalable_malloc(n * sizeof(T)));
+    if ( !ptr ) {
+      throw std::bad_alloc();
+    }
+    MemoryAccounting::instance().allocate(n * sizeof(T));
+    return ptr;
+  }
+
+  void deallocate(T* ptr, const size_t n) noexcept {
+    MemoryAccounting::instance().deallocate(n * sizeof(T));
+    scalable_free(ptr);
+  }
+};
+
+template <typename T, typename U>
+bool operator== (const accounted_scalable_allocator<T>&, const accounted_scalable_allocator<U>&) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!= (const accounted_scalable_allocator<T>&, const accounted_scalable_allocator<U>&) {
+  return false;
+}
+
+}  // namespace parallel
 
 template<typename T>
-using vec = std::vector<T, tbb::scalable_allocator<T> >;  // shorter name
+using vec = std::vector<T, parallel::accounted_scalable_allocator<T> >;  // shorter name
 
 namespace parallel {
 template <typename T>
-using scalable_vector = std::vector<T, tbb::scalable_allocator<T> >;
+using scalable_vector = std::vector<T, accounted_scalable_allocator<T> >;
 
 template<typename T>
 static inline void free(scalable_vector<T>& vec) {
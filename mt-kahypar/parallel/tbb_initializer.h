@@ -97,7 +97,43 @@ class TBBInitializer {
     return cpuset;
   }
 
+  // ! Creates a task arena for each used NUMA node. Threads joining such
+  // ! an arena are pinned to the CPUs of the corresponding NUMA node.
+  void initialize_numa_arenas() {
+    std::lock_guard<std::mutex> lock(_numa_arena_mutex);
+    if ( !_numa_arenas.empty() ) {
+      return;
+    }
+    _numa_arenas.resize(_numa_node_to_cpu_id.size());
+    _numa_arena_observers.resize(_numa_node_to_cpu_id.size());
+    for ( size_t node = 0; node < _numa_node_to_cpu_id.size(); ++node ) {
+      const std::vector<int>& cpus = _numa_node_to_cpu_id[node];
+      if ( !cpus.empty() ) {
+        _numa_arenas[node] = std::make_unique<tbb::task_arena>(cpus.size(), 1);
+        _numa_arenas[node]->initialize();
+        _numa_arena_observers[node] = std::make_unique<ThreadPinningObserver>(
+          *_numa_arenas[node], static_cast<int>(node), cpus);
+      }
+    }
+  }
+
+  // ! Executes f in the task arena of the NUMA node (or in the calling
+  // ! arena if no task arena exists for that NUMA node)
+  template<typename F>
+  void execute_on_numa_node(const int node, const F& f) {
+    if ( static_cast<size_t>(node) < _numa_arenas.size() && _numa_arenas[node] ) {
+      _numa_arenas[node]->execute(f);
+    } else {
+      f();
+    }
+  }
+
   void terminate() {
+    for ( auto& observer : _numa_arena_observers ) {
+      if ( observer ) {
+        observer->observe(false);
+      }
+    }
     if ( _global_observer ) {
       _global_observer->observe(false);
     }
@@ -109,7 +145,10 @@ class TBBInitializer {
     _gc(tbb::global_control::max_allowed_parallelism, num_threads),
     _global_observer(nullptr),
     _cpus(),
-    _numa_node_to_cpu_id() {
+    _numa_node_to_cpu_id(),
+    _numa_arena_mutex(),
+    _numa_arenas(),
+    _numa_arena_observers() {
     HwTopology& topology = HwTopology::instance();
     int num_numa_nodes = topology.num_numa_nodes();
     DBG << "Initialize TBB with" << num_threads << "threads";
@@ -151,6 +190,9 @@ class TBBInitializer {
   std::unique_ptr<ThreadPinningObserver> _global_observer;
   std::vector<int> _cpus;
   std::vector<std::vector<int>> _numa_node_to_cpu_id;
+  std::mutex _numa_arena_mutex;
+  std::vector<std::unique_ptr<tbb::task_arena>> _numa_arenas;
+  std::vector<std::unique_ptr<ThreadPinningObserver>> _numa_arena_observers;
 };
 
 #else
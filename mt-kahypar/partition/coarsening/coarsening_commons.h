@@ -28,7 +28,9 @@
 
 #pragma once
 
+#include "mt-kahypar/datastructures/level_arena.h"
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/utils/memory_tree.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/definitions.h"
 
@@ -45,7 +47,11 @@ public:
                  double coarsening_time) :
     _contracted_hypergraph(std::move(contracted_hypergraph)),
     _communities(std::move(communities)),
-    _coarsening_time(coarsening_time) { }
+    _coarsening_time(coarsening_time),
+    _is_materialized(true),
+    _memory_consumption(0) {
+    _memory_consumption = computeMemoryConsumption();
+  }
 
   Hypergraph& contractedHypergraph() {
     return _contracted_hypergraph;
@@ -62,10 +68,49 @@ public:
     return _communities[hn];
   }
 
+  // ! Communities of the representative hypergraph that are contracted
+  // ! into the vertices of this level (required to recompute a dropped level)
+  parallel::scalable_vector<HypernodeID>& communities() {
+    return _communities;
+  }
+
+  size_t numCommunityEntries() const {
+    return _communities.size();
+  }
+
   double coarseningTime() const {
     return _coarsening_time;
   }
 
+  // ! Returns whether or not the contracted hypergraph is currently
+  // ! stored in memory. If not, it has to be recomputed by contracting
+  // ! the hypergraph of the previous level with the communities of this level.
+  bool isMaterialized() const {
+    return _is_materialized;
+  }
+
+  // ! Memory consumption of the contracted hypergraph in bytes
+  // ! (measured when the level was created)
+  size_t memoryConsumption() const {
+    return _memory_consumption;
+  }
+
+  // ! Releases the memory of the contracted hypergraph, but keeps the
+  // ! communities such that the level can be recomputed on demand.
+  void drop() {
+    ASSERT(_is_materialized);
+    _contracted_hypergraph.freeInternalData();
+    _contracted_hypergraph = Hypergraph();
+    _is_materialized = false;
+  }
+
+  // ! Restores a previously dropped level
+  void restore(Hypergraph&& contracted_hypergraph) {
+    ASSERT(!_is_materialized);
+    _contracted_hypergraph = std::move(contracted_hypergraph);
+    _is_materialized = true;
+  }
+
   void freeInternalData() {
     tbb::parallel_invoke([&] {
       _contracted_hypergraph.freeInternalData();
@@ -75,6 +120,13 @@ public:
   }
 
 private:
+  size_t computeMemoryConsumption() const {
+    utils::MemoryTreeNode memory_consumption("Level", utils::OutputType::BYTES);
+    _contracted_hypergraph.memoryConsumption(&memory_consumption);
+    memory_consumption.finalize();
+    return memory_consumption.size();
+  }
+
   // ! Contracted Hypergraph
   Hypergraph _contracted_hypergraph;
   // ! Defines the communities that are contracted
@@ -83,6 +135,10 @@ private:
   // ! Time to create the coarsened hypergraph
   // ! (includes coarsening + contraction time)
   double _coarsening_time;
+  // ! Indicates whether the contracted hypergraph is currently stored
+  bool _is_materialized;
+  // ! Memory consumption of the contracted hypergraph in bytes
+  size_t _memory_consumption;
 };
 
 template<typename TypeTraits>
@@ -142,11 +198,11 @@ public:
       timer.start_timer("finalize_multilevel_hierarchy", "Finalize Multilevel Hierarchy");
       // Free memory of temporary contraction buffer and
       // release coarsening memory in memory pool
-      if (!hierarchy.empty()) {
-        hierarchy.back().contractedHypergraph().freeTmpContractionBuffer();
-      } else {
-        _hg.freeTmpContractionBuffer();
+      Hypergraph& coarsest_hg = hierarchy.empty() ? _hg : hierarchy.back().contractedHypergraph();
+      if constexpr ( Hypergraph::is_static_hypergraph ) {
+        _contraction_arena_stats = coarsest_hg.tmpContractionBufferStats();
       }
+      coarsest_hg.freeTmpContractionBuffer();
       if (_context.type == ContextType::main) {
         parallel::MemoryPool::instance().release_mem_group("Coarsening");
       }
@@ -174,6 +230,89 @@ public:
     const HighResClockTimepoint round_end = std::chrono::high_resolution_clock::now();
     const double elapsed_time = std::chrono::duration<double>(round_end - round_start).count();
     hierarchy.emplace_back(std::move(contracted_hg), std::move(communities), elapsed_time);
+    _materialized_hierarchy_memory += hierarchy.back().memoryConsumption();
+    _peak_accounted_hierarchy_memory = std::max(
+      _peak_accounted_hierarchy_memory, _materialized_hierarchy_memory);
+    enforceHierarchyMemoryBudget(hierarchy.size() - 1);
+  }
+
+  // ! Ensures that the contracted hypergraph of the given level is stored in memory.
+  // ! If the level was dropped due to the hierarchy memory budget, we recompute it
+  // ! by contracting the nearest materialized finer level (or the input hypergraph)
+  // ! with the stored communities of the intermediate levels. The intermediate levels
+  // ! are kept, since uncoarsening visits them next. Thus, each dropped level is
+  // ! recomputed at most once, but the budget is no longer enforced once
+  // ! uncoarsening reaches the dropped levels.
+  void materializeLevel(const size_t level) {
+    ASSERT(!nlevel && level < hierarchy.size());
+    if ( hierarchy[level].isMaterialized() ) {
+      return;
+    }
+
+    utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+    timer.start_timer("restore_hierarchy_level", "Restore Hierarchy Level");
+    size_t first_dropped_level = level;
+    while ( first_dropped_level > 0 && !hierarchy[first_dropped_level - 1].isMaterialized() ) {
+      --first_dropped_level;
+    }
+
+    for ( size_t i = first_dropped_level; i <= level; ++i ) {
+      Hypergraph& finer_hg = i == 0 ? _hg : hierarchy[i - 1].contractedHypergraph();
+      // Communities are already compactified, which is why contracting them
+      // again yields exactly the same vertex IDs as in the original contraction.
+      // Note that the temporary contraction buffer is passed on to the contracted
+      // hypergraph, which is why it is allocated only once for all levels.
+      Hypergraph contracted_hg = finer_hg.contract(
+        hierarchy[i].communities(), _context.partition.deterministic);
+      hierarchy[i].restore(std::move(contracted_hg));
+      _materialized_hierarchy_memory += hierarchy[i].memoryConsumption();
+      _peak_accounted_hierarchy_memory = std::max(
+        _peak_accounted_hierarchy_memory, _materialized_hierarchy_memory);
+      ++_num_restored_levels;
+    }
+    hierarchy[level].contractedHypergraph().freeTmpContractionBuffer();
+    timer.stop_timer("restore_hierarchy_level");
+  }
+
+  // ! Releases the contracted hypergraph of a level that is no longer
+  // ! required during uncoarsening
+  void releaseLevel(const size_t level) {
+    ASSERT(!nlevel && level < hierarchy.size());
+    if ( hierarchy[level].isMaterialized() ) {
+      _materialized_hierarchy_memory -= hierarchy[level].memoryConsumption();
+      hierarchy[level].drop();
+    }
+  }
+
+  void memoryConsumption(utils::MemoryTreeNode* parent) const {
+    ASSERT(parent);
+    utils::MemoryTreeNode* hierarchy_node = parent->addChild("Multilevel Hierarchy");
+    hierarchy_node->addChild("Peak Accounted Size of Materialized Levels", _peak_accounted_hierarchy_memory);
+    size_t communities_memory = 0;
+    for ( const Level<TypeTraits>& level : hierarchy ) {
+      communities_memory += level.numCommunityEntries() * sizeof(HypernodeID);
+    }
+    hierarchy_node->addChild("Communities", communities_memory);
+  }
+
+  // ! Statistics of the level arena that served the contraction buffers
+  // ! (captured before the buffers are freed at the end of coarsening)
+  const ds::LevelArena::Stats& contractionArenaStats() const {
+    return _contraction_arena_stats;
+  }
+
+  // ! Maximum summed memory consumption of all simultaneously materialized levels
+  // ! as accounted by their memory trees (this is not the resident set size)
+  size_t peakAccountedHierarchyMemory() const {
+    return _peak_accounted_hierarchy_memory;
+  }
+
+  size_t numDroppedLevels() const {
+    return _num_dropped_levels;
+  }
+
+  size_t numRestoredLevels() const {
+    return _num_restored_levels;
   }
 
   PartitionedHypergraph& coarsestPartitionedHypergraph() {
@@ -211,8 +350,32 @@ public:
   bool nlevel;
 
 private:
+  bool exceedsHierarchyMemoryBudget() const {
+    const size_t budget = _context.coarsening.hierarchy_memory_budget;
+    return budget > 0 && _materialized_hierarchy_memory > budget;
+  }
+
+  // ! Drops the finest materialized levels of the hierarchy until the memory
+  // ! consumption of all materialized levels fits into the budget. The level that
+  // ! is required for the next contraction step is never dropped.
+  void enforceHierarchyMemoryBudget(const size_t protected_level) {
+    for ( size_t i = 0; i < protected_level && exceedsHierarchyMemoryBudget(); ++i ) {
+      if ( hierarchy[i].isMaterialized() ) {
+        releaseLevel(i);
+        ++_num_dropped_levels;
+      }
+    }
+  }
+
   Hypergraph& _hg;
   const Context& _context;
+  // ! Memory consumption of all levels whose contracted hypergraph is currently stored
+  size_t _materialized_hierarchy_memory = 0;
+  size_t _peak_accounted_hierarchy_memory = 0;
+  size_t _num_dropped_levels = 0;
+  size_t _num_restored_levels = 0;
+  // ! Statistics of the level arena that served the contraction buffers
+  ds::LevelArena::Stats _contraction_arena_stats;
 };
 
 typedef struct uncoarsening_data_s uncoarsening_data_t;
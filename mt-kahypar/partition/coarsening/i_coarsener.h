@@ -33,6 +33,7 @@
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/partition/refinement/i_refiner.h"
 #include "mt-kahypar/partition/coarsening/coarsening_commons.h"
+#include "mt-kahypar/utils/tracer.h"
 
 namespace mt_kahypar {
 
@@ -67,6 +68,7 @@ class ICoarsener {
   }
 
   bool coarseningPass() {
+    utils::TraceScope trace(utils::TraceEvent::coarsening_pass);
     return coarseningPassImpl();
   }
 
@@ -45,6 +45,7 @@
 #include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/numa_placement.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/progress_bar.h"
 #include "mt-kahypar/utils/randomize.h"
@@ -164,7 +165,13 @@ class MultilevelCoarsener : public ICoarsener,
     });
 
     if ( _enable_randomization ) {
-      utils::Randomize::instance().parallelShuffleVector( _current_vertices, UL(0), _current_vertices.size());
+      // With NUMA-aware placement, vertices are only shuffled within the range owned
+      // by a NUMA node such that each vertex is rated by a thread of its NUMA node
+      const std::vector<size_t> bounds =
+        parallel::NumaPlacement::instance().rangeBounds(_current_vertices.size());
+      for ( size_t i = 0; i + 1 < bounds.size(); ++i ) {
+        utils::Randomize::instance().parallelShuffleVector( _current_vertices, bounds[i], bounds[i + 1]);
+      }
     }
 
     const HypernodeID num_hns_before_pass =
@@ -242,7 +249,7 @@ class MultilevelCoarsener : public ICoarsener,
     tbb::enumerable_thread_specific<HypernodeID> num_nodes_update_threshold(0);
     ds::FixedVertexSupport<Hypergraph> fixed_vertices = current_hg.copyOfFixedVertexSupport();
     fixed_vertices.setMaxBlockWeight(_context.partition.max_part_weights);
-    tbb::parallel_for(ID(0), current_hg.initialNumNodes(), [&](const HypernodeID id) {
+    parallel::NumaPlacement::instance().parallel_for(current_hg.initialNumNodes(), [&](const HypernodeID id) {
       ASSERT(id < _current_vertices.size());
       const HypernodeID hn = _current_vertices[id];
       if (current_hg.nodeIsEnabled(hn)) {
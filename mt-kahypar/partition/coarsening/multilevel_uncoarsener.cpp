@@ -31,6 +31,8 @@
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/partition/refinement/i_refiner.h"
 #include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/progress.h"
+#include "mt-kahypar/partition/time_budget.h"
 #include "mt-kahypar/utils/stats.h"
 #include "mt-kahypar/utils/cast.h"
 
@@ -82,6 +84,8 @@ namespace mt_kahypar {
       if (_current_level == 0) {
         partitioned_hg.setHypergraph(_hg);
       } else {
+        // Recompute the level if it was dropped due to the hierarchy memory budget
+        _uncoarseningData.materializeLevel(_current_level - 1);
         partitioned_hg.setHypergraph((_uncoarseningData.hierarchy)[_current_level-1].contractedHypergraph());
       }
       // Hypergraph stores partition from previous level.
@@ -99,6 +103,10 @@ namespace mt_kahypar {
         partitioned_hg.setOnlyNodePart(hn, block);
       });
       partitioned_hg.initializePartition();
+      if ( _context.coarsening.hierarchy_memory_budget > 0 ) {
+        // The contracted hypergraph of the coarser level is no longer required
+        _uncoarseningData.releaseLevel(_current_level);
+      }
       _timer.stop_timer("projecting_partition");
 
       // Improve partition
@@ -112,6 +120,8 @@ namespace mt_kahypar {
     ASSERT(metrics::quality(*_uncoarseningData.partitioned_hg, _context) == _current_metrics.quality,
       V(_current_metrics.quality) << V(metrics::quality(*_uncoarseningData.partitioned_hg, _context)));
 
+    report_progress(partitioned_hg, _context, PROGRESS_REFINEMENT,
+      static_cast<size_t>(_current_level), partitioned_hg.initialNumNodes(), _current_metrics.quality);
     --_current_level;
   }
 
@@ -201,6 +211,12 @@ namespace mt_kahypar {
       // there is a refinement run on the coarsest graph before projection. There is no value stored for this run, so we must avoid looking it up.
       time_limit = Base::refinementTimeLimit(_context, (_uncoarseningData.hierarchy)[_current_level].coarseningTime());
     }
+    if ( _context.isTimeLimitExceeded() ) {
+      // We only project the partition to the remaining levels
+      return;
+    }
+    time_limit = refinement_time_limit_for_level(
+      _context, time_limit, static_cast<size_t>(std::max(_current_level + 1, 1)));
 
     if ( debug && _context.type == ContextType::main ) {
       io::printHypergraphInfo(partitioned_hypergraph.hypergraph(),
@@ -220,7 +236,10 @@ namespace mt_kahypar {
         _rebalancer->initialize(phg);
       }
 
-      if ( _label_propagation && _context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
+      // If label propagation is pipelined with FM, the FM tasks process the label propagation work items
+      const bool lp_is_pipelined = _fm && _context.isLabelPropagationPipelinedWithFM();
+      if ( _label_propagation && _context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing
+           && !lp_is_pipelined ) {
         _timer.start_timer("initialize_lp_refiner", "Initialize LP Refiner");
         _label_propagation->initialize(phg);
         _timer.stop_timer("initialize_lp_refiner");
@@ -240,7 +259,9 @@ namespace mt_kahypar {
         _timer.stop_timer("fm");
       }
 
-      if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
+      // Flow-based refinement is expensive, so we skip it once the time limit is exceeded
+      if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing &&
+           !_context.isTimeLimitExceeded() ) {
         _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
         _flows->initialize(phg);
         _timer.stop_timer("initialize_flow_scheduler");
@@ -259,7 +280,7 @@ namespace mt_kahypar {
       const HyperedgeWeight metric_after = _current_metrics.quality;
       const double relative_improvement = 1.0 -
         static_cast<double>(metric_after) / metric_before;
-      if ( !_context.refinement.refine_until_no_improvement ||
+      if ( !_context.refinement.refine_until_no_improvement || _context.isTimeLimitExceeded() ||
            relative_improvement <= _context.refinement.relative_improvement_threshold ) {
         break;
       }
@@ -40,6 +40,7 @@
 #include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_fixed_vertex_acceptance_policy.h"
+#include "mt-kahypar/utils/simd.h"
 
 
 namespace mt_kahypar {
@@ -53,6 +54,7 @@ class MultilevelVertexPairRater {
   using ThreadLocalVertexDegreeBoundedRatingMap = tbb::enumerable_thread_specific<CacheEfficientRatingMap>;
   using ThreadLocalLargeTmpRatingMap = tbb::enumerable_thread_specific<LargeTmpRatingMap>;
   using ThreadLocalFastResetFlagArray = tbb::enumerable_thread_specific<kahypar::ds::FastResetFlagArray<> >;
+  using ThreadLocalRepresentatives = tbb::enumerable_thread_specific<parallel::scalable_vector<HypernodeID>>;
 
  private:
   static constexpr bool debug = false;
@@ -106,6 +108,7 @@ class MultilevelVertexPairRater {
     _bloom_filter_mask(align_to_next_power_of_two(
       std::min(ID(10) * max_edge_size, _current_num_nodes)) - 1),
     _local_bloom_filter(_bloom_filter_mask + 1),
+    _local_representatives(),
     _already_matched(num_hypernodes) { }
 
   MultilevelVertexPairRater(const MultilevelVertexPairRater&) = delete;
@@ -230,6 +233,7 @@ class MultilevelVertexPairRater {
       }
     } else {
       kahypar::ds::FastResetFlagArray<>& bloom_filter = _local_bloom_filter.local();
+      parallel::scalable_vector<HypernodeID>& representatives = _local_representatives.local();
       for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
         HypernodeID edge_size = hypergraph.edgeSize(he);
         ASSERT(edge_size > 1 || hypergraph.isSinglePinNetsRemovalDisabled(), V(he));
@@ -238,12 +242,14 @@ class MultilevelVertexPairRater {
           continue;
         }
         if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+          // Gather the cluster IDs of all pins in one batch (vectorized if supported)
+          // such that the adaptive edge size and the rating share the same lookups
+          gatherRepresentatives(hypergraph, he, cluster_ids, representatives);
           edge_size = _context.coarsening.use_adaptive_edge_size ?
-            std::max(adaptiveEdgeSize(hypergraph, he, bloom_filter, cluster_ids), ID(2)) : edge_size;
+            std::max(adaptiveEdgeSize(representatives, bloom_filter), ID(2)) : edge_size;
           const RatingType score = ScorePolicy::score(
             hypergraph.edgeWeight(he), edge_size);
-          for ( const HypernodeID& v : hypergraph.pins(he) ) {
-            const HypernodeID representative = cluster_ids[v];
+          for ( const HypernodeID& representative : representatives ) {
             ASSERT(representative < hypergraph.initialNumNodes());
             const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
             if ( !bloom_filter[bloom_filter_rep] ) {
@@ -306,6 +312,37 @@ class MultilevelVertexPairRater {
     }
   }
 
+  // ! Stores the cluster IDs of all pins of hyperedge he in the representatives vector.
+  // ! The pins of a hyperedge are stored consecutively, which enables gathering
+  // ! the cluster IDs with vector instructions.
+  template<typename Hypergraph>
+  inline void gatherRepresentatives(const Hypergraph& hypergraph,
+                                    const HyperedgeID he,
+                                    const parallel::scalable_vector<HypernodeID>& cluster_ids,
+                                    parallel::scalable_vector<HypernodeID>& representatives) {
+    auto pins = hypergraph.pins(he);
+    const size_t edge_size = pins.end() - pins.begin();
+    representatives.resize(edge_size);
+    if ( edge_size > 0 ) {
+      utils::simd::gather(&*pins.begin(), edge_size,
+        cluster_ids.data(), cluster_ids.size(), representatives.data());
+    }
+  }
+
+  inline HypernodeID adaptiveEdgeSize(const parallel::scalable_vector<HypernodeID>& representatives,
+                                      kahypar::ds::FastResetFlagArray<>& bloom_filter) {
+    HypernodeID edge_size = 0;
+    for ( const HypernodeID& representative : representatives ) {
+      const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
+      if ( !bloom_filter[bloom_filter_rep] ) {
+        ++edge_size;
+        bloom_filter.set(bloom_filter_rep, true);
+      }
+    }
+    bloom_filter.reset();
+    return edge_size;
+  }
+
   template<typename Hypergraph>
   inline HypernodeID adaptiveEdgeSize(const Hypergraph& hypergraph,
                                       const HyperedgeID he,
@@ -405,6 +442,8 @@ class MultilevelVertexPairRater {
   // ! we use this bloom filter.
   size_t _bloom_filter_mask;
   ThreadLocalFastResetFlagArray _local_bloom_filter;
+  // ! Buffer for the cluster IDs of the pins of a hyperedge
+  ThreadLocalRepresentatives _local_representatives;
 
   // ! Marks all matched vertices
   kahypar::ds::FastResetFlagArray<> _already_matched;
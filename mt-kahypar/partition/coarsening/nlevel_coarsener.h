@@ -35,12 +35,14 @@
 #include "include/mtkahypartypes.h"
 
 #include "kahypar-resources/meta/mandatory.h"
+#include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
 #include "mt-kahypar/partition/coarsening/nlevel_coarsener_base.h"
 #include "mt-kahypar/partition/coarsening/nlevel_vertex_pair_rater.h"
 #include "mt-kahypar/partition/coarsening/i_coarsener.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "mt-kahypar/parallel/chunking.h"
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/progress_bar.h"
@@ -126,6 +128,13 @@ class NLevelCoarsener : public ICoarsener,
     tbb::enumerable_thread_specific<HypernodeID> _num_nodes_update_threshold;
   };
 
+  struct Contraction {
+    HypernodeID u;
+    HypernodeID v;
+  };
+
+  using ThreadLocalContractions = tbb::enumerable_thread_specific<parallel::scalable_vector<Contraction>>;
+
   static constexpr bool debug = false;
   static constexpr bool enable_heavy_assert = false;
 
@@ -143,6 +152,11 @@ class NLevelCoarsener : public ICoarsener,
     _tmp_current_vertices(),
     _enabled_vertex_flag_array(),
     _cl_tracker(context),
+    _local_contractions(),
+    _round_contractions(),
+    _round_parent(),
+    _is_contraction_partner(),
+    _is_representative(),
     _pass_nr(0),
     _progress_bar(utils::cast<Hypergraph>(hypergraph).initialNumNodes(), 0, false),
     _enable_randomization(true) {
@@ -227,6 +241,11 @@ class NLevelCoarsener : public ICoarsener,
 
   template<bool has_fixed_vertices>
   void performClustering(const HypernodeID contraction_limit) {
+    if ( _context.coarsening.nlevel_registration_sub_rounds > 0 ) {
+      performRoundBasedClustering<has_fixed_vertices>(contraction_limit);
+      return;
+    }
+
     tbb::parallel_for(UL(0), _current_vertices.size(), [&](const size_t i) {
       if ( _cl_tracker.currentNumNodes() > contraction_limit ) {
         const HypernodeID& hn = _current_vertices[i];
@@ -236,6 +255,155 @@ class NLevelCoarsener : public ICoarsener,
     });
   }
 
+  /*!
+   * Round-based variant of the clustering step. The vertices are processed in sub-rounds,
+   * each consisting of three phases separated by a barrier:
+   *  1.) Each thread rates its vertices and stores the resulting contractions in a
+   *      thread-local buffer. A vertex can be claimed as contraction partner only once.
+   *  2.) The buffers are merged and the contractions are registered in the contraction
+   *      forest without acquiring ownership of the involved vertices. Since each vertex
+   *      has at most one representative, the contractions of a sub-round form a functional
+   *      graph. We break each cycle by removing the contraction of its vertex with the
+   *      smallest ID.
+   *  3.) We start the contractions at all leaves of the contraction forest of the sub-round.
+   *      Contracting a vertex whose pending contractions are all processed is done
+   *      recursively by contract(v, max_node_weight).
+   * This avoids the fine-grained locking of registerContraction(u, v) on the hot path.
+   */
+  template<bool has_fixed_vertices>
+  void performRoundBasedClustering(const HypernodeID contraction_limit) {
+    if ( _round_parent.size() != _hg.initialNumNodes() ) {
+      _round_parent.assign(_hg.initialNumNodes(), kInvalidHypernode);
+      _is_contraction_partner = ds::ThreadSafeFastResetFlagArray<>(_hg.initialNumNodes());
+      _is_representative = ds::ThreadSafeFastResetFlagArray<>(_hg.initialNumNodes());
+    }
+
+    const size_t num_vertices = _current_vertices.size();
+    const size_t num_sub_rounds = std::min(
+      _context.coarsening.nlevel_registration_sub_rounds, std::max(num_vertices, UL(1)));
+    const size_t sub_round_size = parallel::chunking::idiv_ceil(num_vertices, num_sub_rounds);
+    for ( size_t sub_round = 0; sub_round < num_sub_rounds &&
+          _cl_tracker.currentNumNodes() > contraction_limit; ++sub_round ) {
+      const size_t first = sub_round * sub_round_size;
+      const size_t last = std::min(first + sub_round_size, num_vertices);
+      if ( first >= last ) {
+        break;
+      }
+
+      // Phase 1: Rate vertices and collect contractions in thread-local buffers
+      const HypernodeID num_nodes_before_round = _cl_tracker.currentNumNodes();
+      parallel::IntegralAtomicWrapper<HypernodeID> num_proposals(0);
+      tbb::parallel_for(first, last, [&](const size_t i) {
+        const HypernodeID hn = _current_vertices[i];
+        if ( num_nodes_before_round - num_proposals.load(std::memory_order_relaxed) > contraction_limit &&
+             _hg.nodeIsEnabled(hn) ) {
+          const Rating rating = _rater.template rate<has_fixed_vertices>(
+            _hg, hn, _context.coarsening.max_allowed_node_weight);
+          if ( rating.target != kInvalidHypernode ) {
+            HypernodeID u = hn;
+            HypernodeID v = rating.target;
+            if ( _hg.nodeDegree(u) < _hg.nodeDegree(v) && _hg.nodeDegree(v) > HIGH_DEGREE_VERTEX_THRESHOLD ) {
+              u = rating.target;
+              v = hn;
+            }
+            if ( _is_contraction_partner.compare_and_set_to_true(v) ) {
+              _rater.markAsMatched(u);
+              _rater.markAsMatched(v);
+              _local_contractions.local().push_back(Contraction { u, v });
+              num_proposals.fetch_add(1, std::memory_order_relaxed);
+            }
+          }
+        }
+      });
+
+      // Phase 2: Merge buffers, break cycles and register contractions
+      mergeLocalContractions();
+      tbb::parallel_for(UL(0), _round_contractions.size(), [&](const size_t i) {
+        const Contraction& c = _round_contractions[i];
+        _round_parent[c.v] = c.u;
+      });
+      tbb::parallel_for(UL(0), _round_contractions.size(), [&](const size_t i) {
+        Contraction& c = _round_contractions[i];
+        if ( isSmallestVertexOnCycle(c.v) ) {
+          c.u = kInvalidHypernode;
+        }
+      });
+      tbb::parallel_for(UL(0), _round_contractions.size(), [&](const size_t i) {
+        const Contraction& c = _round_contractions[i];
+        if ( c.u != kInvalidHypernode ) {
+          _hg.registerContractionOfRound(c.u, c.v);
+          _is_representative.set(c.u, true);
+        }
+      });
+
+      // Phase 3: Perform contractions starting at the leaves of the contraction forest
+      tbb::parallel_for(UL(0), _round_contractions.size(), [&](const size_t i) {
+        const Contraction& c = _round_contractions[i];
+        if ( c.u != kInvalidHypernode && !_is_representative[c.v] ) {
+          const HypernodeID num_contractions =
+            _hg.contract(c.v, _context.coarsening.max_allowed_node_weight);
+          _progress_bar += num_contractions;
+          _cl_tracker.update(num_contractions, contraction_limit);
+        }
+      });
+      _cl_tracker.updateCurrentNumNodes();
+
+      // Reset round data structures
+      tbb::parallel_for(UL(0), _round_contractions.size(), [&](const size_t i) {
+        _round_parent[_round_contractions[i].v] = kInvalidHypernode;
+      });
+      _round_contractions.clear();
+      _is_contraction_partner.reset();
+      _is_representative.reset();
+    }
+  }
+
+  void mergeLocalContractions() {
+    size_t num_contractions = 0;
+    for ( const auto& local_contractions : _local_contractions ) {
+      num_contractions += local_contractions.size();
+    }
+    _round_contractions.resize(num_contractions);
+    size_t pos = 0;
+    for ( auto& local_contractions : _local_contractions ) {
+      std::copy(local_contractions.begin(), local_contractions.end(),
+        _round_contractions.begin() + pos);
+      pos += local_contractions.size();
+      local_contractions.clear();
+    }
+  }
+
+  // ! Returns true, if v lies on a cycle of the contraction forest of the current sub-round
+  // ! and has the smallest ID on that cycle (Brent's cycle detection algorithm).
+  bool isSmallestVertexOnCycle(const HypernodeID v) const {
+    HypernodeID tortoise = v;
+    HypernodeID hare = _round_parent[v];
+    size_t power = 1;
+    size_t cycle_length = 1;
+    while ( tortoise != hare ) {
+      if ( hare == kInvalidHypernode ) {
+        // Reached a root => no cycle
+        return false;
+      }
+      if ( power == cycle_length ) {
+        tortoise = hare;
+        power *= 2;
+        cycle_length = 0;
+      }
+      hare = _round_parent[hare];
+      ++cycle_length;
+    }
+
+    // There is a cycle reachable from v. Check if v lies on it and has the smallest ID.
+    HypernodeID x = v;
+    HypernodeID min_id = v;
+    for ( size_t i = 0; i < cycle_length; ++i ) {
+      x = _round_parent[x];
+      min_id = std::min(min_id, x);
+    }
+    return x == v && min_id == v;
+  }
+
   bool shouldNotTerminateImpl() const override {
     return _cl_tracker.currentNumNodes() > _context.coarsening.contraction_limit;
   }
@@ -328,6 +496,12 @@ class NLevelCoarsener : public ICoarsener,
   parallel::scalable_vector<HypernodeID> _tmp_current_vertices;
   parallel::scalable_vector<size_t> _enabled_vertex_flag_array;
   ContractionLimitTracker _cl_tracker;
+  // ! Data structures for round-based registration of contractions
+  ThreadLocalContractions _local_contractions;
+  parallel::scalable_vector<Contraction> _round_contractions;
+  parallel::scalable_vector<HypernodeID> _round_parent;
+  ds::ThreadSafeFastResetFlagArray<> _is_contraction_partner;
+  ds::ThreadSafeFastResetFlagArray<> _is_representative;
   int _pass_nr;
   utils::ProgressBar _progress_bar;
   bool _enable_randomization;
@@ -29,6 +29,8 @@
 #include "mt-kahypar/partition/coarsening/nlevel_uncoarsener.h"
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/progress.h"
+#include "mt-kahypar/partition/time_budget.h"
 #include "mt-kahypar/utils/progress_bar.h"
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/utils/utilities.h"
@@ -218,6 +220,9 @@ namespace mt_kahypar {
         _timer.enable();
       }
     }
+
+    report_progress(*_uncoarseningData.partitioned_hg, _context, PROGRESS_REFINEMENT,
+      _hierarchy.size(), _stats.current_number_of_nodes, _current_metrics.quality);
   }
 
   template<typename TypeTraits>
@@ -298,6 +303,10 @@ namespace mt_kahypar {
     vec<HypernodeID> refinement_nodes = _tmp_refinement_nodes.copy_parallel();
     _tmp_refinement_nodes.clear_parallel();
     _border_vertices_of_batch.reset();
+    if ( _context.isTimeLimitExceeded() ) {
+      // We only uncontract the remaining batches
+      return;
+    }
 
     if ( debug && _context.type == ContextType::main ) {
       io::printHypergraphInfo(partitioned_hypergraph.hypergraph(),
@@ -308,6 +317,8 @@ namespace mt_kahypar {
 
     bool improvement_found = true;
     mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hypergraph);
+    // n-level refinement does not support pipelining label propagation with FM (rejected in the sanity check)
+    ASSERT(!_context.refinement.fm.pipelined_label_propagation);
     while( improvement_found ) {
       improvement_found = false;
 
@@ -331,7 +342,7 @@ namespace mt_kahypar {
             "does not match the metric updated by the refiners" << V(_current_metrics.quality));
       }
 
-      if ( !_context.refinement.refine_until_no_improvement ) {
+      if ( !_context.refinement.refine_until_no_improvement || _context.isTimeLimitExceeded() ) {
         break;
       }
     }
@@ -343,7 +354,12 @@ namespace mt_kahypar {
 
   template<typename TypeTraits>
   void NLevelUncoarsener<TypeTraits>::globalRefine(PartitionedHypergraph& partitioned_hypergraph,
-                                       const double time_limit) {
+                                       const double fm_time_limit) {
+    if ( _context.isTimeLimitExceeded() ) {
+      return;
+    }
+    const double time_limit = refinement_time_limit_for_level(
+      _context, fm_time_limit, _hierarchy.size() + 1);
 
     auto applyGlobalFMParameters = [&](const FMParameters& fm, const NLevelGlobalFMParameters global_fm){
       NLevelGlobalFMParameters tmp_global_fm;
@@ -386,7 +402,9 @@ namespace mt_kahypar {
           _timer.stop_timer("fm");
         }
 
-        if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
+        // Flow-based refinement is expensive, so we skip it once the time limit is exceeded
+        if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing &&
+             !_context.isTimeLimitExceeded() ) {
           _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
           _flows->initialize(phg);
           _timer.stop_timer("initialize_flow_scheduler");
@@ -405,7 +423,7 @@ namespace mt_kahypar {
         const HyperedgeWeight metric_after = _current_metrics.quality;
         const double relative_improvement = 1.0 -
           static_cast<double>(metric_after) / metric_before;
-        if ( !_context.refinement.global_fm.refine_until_no_improvement ||
+        if ( !_context.refinement.global_fm.refine_until_no_improvement || _context.isTimeLimitExceeded() ||
             relative_improvement <= _context.refinement.relative_improvement_threshold ) {
           break;
         }
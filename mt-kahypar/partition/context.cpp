@@ -43,6 +43,9 @@ namespace mt_kahypar {
     if ( params.write_partition_file ) {
       str << "  Partition File:                     " << params.graph_partition_filename << std::endl;
     }
+    if ( params.trace_file != "" ) {
+      str << "  Trace File:                         " << params.trace_file << std::endl;
+    }
     str << "  Mode:                               " << params.mode << std::endl;
     str << "  Objective:                          " << params.objective << std::endl;
     str << "  Gain Policy:                        " << params.gain_policy << std::endl;
@@ -61,6 +64,13 @@ namespace mt_kahypar {
     str << "  Ignore HE Size Threshold:           " << params.ignore_hyperedge_size_threshold << std::endl;
     str << "  Large HE Size Threshold:            " << params.large_hyperedge_size_threshold << std::endl;
     str << "  Collective Sync Updates:            " << std::boolalpha << params.enable_collective_sync_updates << std::endl;
+    if ( params.time_limit > 0 ) {
+      str << "  Time Limit:                         " << params.time_limit << " s" << std::endl;
+    }
+    if ( params.memory_limit > 0 ) {
+      str << "  Memory Limit:                       " << params.memory_limit << " MB" << std::endl;
+      str << "  Use Sparse Connectivity:            " << std::boolalpha << params.use_sparse_connectivity << std::endl;
+    }
     if ( params.use_individual_part_weights ) {
       str << "  Individual Part Weights:            ";
       for ( const HypernodeWeight& w : params.max_part_weights ) {
@@ -89,6 +99,10 @@ namespace mt_kahypar {
     str << "Preprocessing Parameters:" << std::endl;
     str << "  Use Community Detection:            " << std::boolalpha << params.use_community_detection << std::endl;
     str << "  Disable C. D. for Mesh Graphs:      " << std::boolalpha << params.disable_community_detection_for_mesh_graphs << std::endl;
+    str << "  Use Communities as Clustering:      " << std::boolalpha << params.use_communities_as_clustering << std::endl;
+    if (params.use_communities_as_clustering) {
+      str << "  Max Conductance of Communities:     " << params.communities_as_clustering_max_conductance << std::endl;
+    }
     if (params.use_community_detection) {
       str << std::endl << params.community_detection;
     }
@@ -116,6 +130,12 @@ namespace mt_kahypar {
     str << "  Maximum Shrink Factor:              " << params.maximum_shrink_factor << std::endl;
     str << "  Vertex Degree Sampling Threshold:   " << params.vertex_degree_sampling_threshold << std::endl;
     str << "  Number of subrounds (deterministic):" << params.num_sub_rounds_deterministic << std::endl;
+    if ( params.algorithm == CoarseningAlgorithm::nlevel_coarsener ) {
+      str << "  N-Level Registration Sub-Rounds:    " << params.nlevel_registration_sub_rounds << std::endl;
+    }
+    if ( params.hierarchy_memory_budget > 0 ) {
+      str << "  Hierarchy Memory Budget:            " << params.hierarchy_memory_budget << " bytes" << std::endl;
+    }
     str << "  Single-pin Nets Removal:            " << (params.disable_single_pin_nets_removal ? "disabled" : "enabled") << std::endl;
     str << std::endl << params.rating;
     return str;
@@ -128,6 +148,7 @@ namespace mt_kahypar {
       str << "    Maximum Iterations:               " << params.maximum_iterations << std::endl;
       str << "    Unconstrained:                    " << std::boolalpha << params.unconstrained << std::endl;
       str << "    Rebalancing:                      " << std::boolalpha << params.rebalancing << std::endl;
+      str << "    Priority Ordered:                 " << std::boolalpha << params.priority_ordered << std::endl;
       str << "    HE Size Activation Threshold:     " << std::boolalpha << params.hyperedge_size_activation_threshold << std::endl;
       str << "    Relative Improvement Threshold:   " << params.relative_improvement_threshold << std::endl;
     }
@@ -147,6 +168,12 @@ namespace mt_kahypar {
       out << "    Minimum Improvement Factor:       " << params.min_improvement << std::endl;
       out << "    Release Nodes:                    " << std::boolalpha << params.release_nodes << std::endl;
       out << "    Time Limit Factor:                " << params.time_limit_factor << std::endl;
+      out << "    Adaptive Round Budget:            " << std::boolalpha << params.adaptive_round_budget << std::endl;
+      if ( params.adaptive_round_budget ) {
+        out << "    Round Budget Min Rate Fraction:   " << params.round_budget_min_rate_fraction << std::endl;
+      }
+      out << "    Pipelined Label Propagation:      " << std::boolalpha << params.pipelined_label_propagation << std::endl;
+      out << "    Graph-Specialized Delta Updates:  " << std::boolalpha << params.graph_specialized_delta_updates << std::endl;
     }
     if ( params.algorithm == FMAlgorithm::unconstrained_fm ) {
       out << "    Unconstrained Rounds:             " << params.unconstrained_rounds << std::endl;
@@ -191,6 +218,11 @@ namespace mt_kahypar {
       out << "    Skip Small Cuts:                  " << std::boolalpha << params.skip_small_cuts << std::endl;
       out << "    Skip Unpromising Blocks:          " << std::boolalpha << params.skip_unpromising_blocks << std::endl;
       out << "    Pierce in Bulk:                   " << std::boolalpha << params.pierce_in_bulk << std::endl;
+      out << "    Cache Constructions:              " << std::boolalpha << params.cache_constructions << std::endl;
+      if ( params.cache_constructions ) {
+        out << "    Max. Changed Cached Region:       " << params.max_changed_cached_region_fraction << std::endl;
+      }
+      out << "    Multi-Way Number of Blocks:       " << params.multiway_num_blocks << std::endl;
       out << "    Steiner Tree Policy:              " << params.steiner_tree_policy << std::endl;
       out << std::flush;
     }
@@ -200,6 +232,7 @@ namespace mt_kahypar {
   std::ostream& operator<<(std::ostream& out, const DeterministicRefinementParameters& params) {
     out << "    Number of sub-rounds for Sync LP:  " << params.num_sub_rounds_sync_lp << std::endl;
     out << "    Use active node set:               " << std::boolalpha << params.use_active_node_set << std::endl;
+    out << "    Number of sub-rounds for Det. FM:  " << params.num_sub_rounds_fm << std::endl;
     return out;
   }
 
@@ -256,6 +289,7 @@ namespace mt_kahypar {
     }
     str << "  Use Localized Random Shuffle:       " << std::boolalpha << params.use_localized_random_shuffle << std::endl;
     str << "  Random Shuffle Block Size:          " << params.shuffle_block_size << std::endl;
+    str << "  NUMA-Aware Placement:               " << std::boolalpha << params.numa_aware_placement << std::endl;
     return str;
   }
 
@@ -264,6 +298,52 @@ namespace mt_kahypar {
       partition.partition_type == N_LEVEL_HYPERGRAPH_PARTITIONING;
   }
 
+  bool Context::isLabelPropagationPipelinedWithFM() const {
+    return refinement.fm.pipelined_label_propagation &&
+      refinement.fm.algorithm != FMAlgorithm::do_nothing &&
+      refinement.fm.algorithm != FMAlgorithm::deterministic &&
+      refinement.label_propagation.algorithm == LabelPropagationAlgorithm::label_propagation &&
+      !refinement.label_propagation.unconstrained &&
+      !partition.deterministic;
+  }
+
+  void Context::startTimeBudget() {
+    partition.start_time = std::chrono::high_resolution_clock::now();
+    partition.cancelled = std::make_shared<std::atomic<bool>>(false);
+  }
+
+  bool Context::hasTimeLimit() const {
+    return partition.time_limit > 0;
+  }
+
+  double Context::elapsedTime() const {
+    return std::chrono::duration<double>(
+      std::chrono::high_resolution_clock::now() - partition.start_time).count();
+  }
+
+  double Context::remainingTime() const {
+    if ( isCancelled() ) {
+      return 0.0;
+    } else if ( !hasTimeLimit() ) {
+      return std::numeric_limits<double>::infinity();
+    }
+    return std::max(partition.time_limit - elapsedTime(), 0.0);
+  }
+
+  bool Context::isTimeLimitExceeded() const {
+    return isCancelled() || ( hasTimeLimit() && elapsedTime() >= partition.time_limit );
+  }
+
+  void Context::cancel() const {
+    if ( partition.cancelled ) {
+      partition.cancelled->store(true, std::memory_order_relaxed);
+    }
+  }
+
+  bool Context::isCancelled() const {
+    return partition.cancelled && partition.cancelled->load(std::memory_order_relaxed);
+  }
+
   bool Context::forceGainCacheUpdates() const {
     return isNLevelPartitioning() ||
       partition.mode == Mode::deep_multilevel ||
@@ -483,12 +563,29 @@ namespace mt_kahypar {
 
     shared_memory.static_balancing_work_packages = std::clamp(shared_memory.static_balancing_work_packages, UL(4), UL(256));
 
+    if ( refinement.fm.pipelined_label_propagation ) {
+      if ( isNLevelPartitioning() ) {
+        // n-level refinement runs label propagation and FM on small batches of uncontracted nodes
+        refinement.fm.pipelined_label_propagation = false;
+        INFO("Pipelined label propagation is not supported in n-level mode. Running label propagation as a separate phase.");
+      } else if ( refinement.label_propagation.algorithm != LabelPropagationAlgorithm::label_propagation ||
+                  refinement.label_propagation.unconstrained || partition.deterministic ) {
+        refinement.fm.pipelined_label_propagation = false;
+        INFO("Pipelined label propagation is only supported for (constrained) non-deterministic label propagation."
+          << "Running label propagation as a separate phase.");
+      }
+    }
+
     if ( partition.deterministic ) {
       coarsening.algorithm = CoarseningAlgorithm::deterministic_multilevel_coarsener;
 
-      // disable FM until we have a deterministic version
-      refinement.fm.algorithm = FMAlgorithm::do_nothing;
-      initial_partitioning.refinement.fm.algorithm = FMAlgorithm::do_nothing;
+      // switch silently to deterministic FM
+      if ( refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+        refinement.fm.algorithm = FMAlgorithm::deterministic;
+      }
+      if ( initial_partitioning.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+        initial_partitioning.refinement.fm.algorithm = FMAlgorithm::deterministic;
+      }
 
       // disable adaptive IP
       initial_partitioning.use_adaptive_ip_runs = false;
@@ -27,6 +27,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
 #include "mt-kahypar/utils/utilities.h"
@@ -51,7 +56,21 @@ struct PartitioningParameters {
   size_t num_vcycles = 0;
   bool perform_parallel_recursion_in_deep_multilevel = true;
 
-  int time_limit = 0;
+  // Wall-clock time limit in seconds (0 = no limit)
+  double time_limit = 0.0;
+  // Start of the current partitioning call (see Context::startTimeBudget())
+  std::chrono::time_point<std::chrono::high_resolution_clock> start_time { };
+  // Called with each new best partition of the input hypergraph, its objective
+  // and the elapsed time in seconds (direct multilevel mode only)
+  std::function<void(const vec<PartitionID>&, HyperedgeWeight, double)> best_partition_callback { };
+  // Called at phase boundaries and after each uncoarsening level (direct multilevel mode only).
+  // Returning true cancels the partitioning call (see Context::cancel()).
+  std::function<bool(const mt_kahypar_progress_t&)> progress_callback { };
+  // Shared by all copies of the context created during the current partitioning call
+  std::shared_ptr<std::atomic<bool>> cancelled { };
+  // Memory limit in MB (0 = no limit)
+  size_t memory_limit = 0;
+  bool use_sparse_connectivity = false;
   bool use_individual_part_weights = false;
   std::vector<HypernodeWeight> perfect_balance_part_weights;
   std::vector<HypernodeWeight> max_part_weights;
@@ -66,6 +85,7 @@ struct PartitioningParameters {
   bool measure_detailed_uncontraction_timings = false;
   size_t timings_output_depth = std::numeric_limits<size_t>::max();
   bool show_memory_consumption = false;
+  bool show_perf_counters = false;
   bool show_advanced_cut_analysis = false;
   bool enable_progress_bar = false;
   bool sp_process_output = false;
@@ -80,6 +100,9 @@ struct PartitioningParameters {
   std::string graph_partition_filename { };
   std::string graph_community_filename { };
   std::string preset_file { };
+  std::string trace_file { };
+  size_t trace_buffer_size = 1UL << 18;
+  bool trace_moves = false;
 };
 
 std::ostream & operator<< (std::ostream& str, const PartitioningParameters& params);
@@ -99,6 +122,8 @@ struct PreprocessingParameters {
   bool stable_construction_of_incident_edges = false;
   bool use_community_detection = false;
   bool disable_community_detection_for_mesh_graphs = true;
+  bool use_communities_as_clustering = false;
+  double communities_as_clustering_max_conductance = 0.0;
   CommunityDetectionParameters community_detection = { };
 };
 
@@ -123,6 +148,13 @@ struct CoarseningParameters {
   double maximum_shrink_factor = std::numeric_limits<double>::max();
   size_t vertex_degree_sampling_threshold = std::numeric_limits<size_t>::max();
   size_t num_sub_rounds_deterministic = 16;
+  // ! Maximum memory in bytes for the contracted hypergraphs of the multilevel
+  // ! hierarchy (0 = unlimited). Exceeding levels are dropped and recomputed
+  // ! during uncoarsening.
+  size_t hierarchy_memory_budget = 0;
+  // ! Number of sub-rounds for lock-free registration of contractions in the
+  // ! n-level coarsener (0 = register contractions with per-vertex locks)
+  size_t nlevel_registration_sub_rounds = 0;
 
   // needed for preserving conductance
   bool disable_single_pin_nets_removal = false; 
@@ -141,6 +173,7 @@ struct LabelPropagationParameters {
   bool unconstrained = false;
   bool rebalancing = true;
   bool execute_sequential = false;
+  bool priority_ordered = false;
   size_t hyperedge_size_activation_threshold = std::numeric_limits<size_t>::max();
   double relative_improvement_threshold = -1.0;
 };
@@ -163,6 +196,12 @@ struct FMParameters {
   mutable bool obey_minimal_parallelism = false;
   bool release_nodes = true;
 
+  // adaptive round budget
+  bool adaptive_round_budget = false;
+  double round_budget_min_rate_fraction = 0.1;
+  bool pipelined_label_propagation = false;
+  bool graph_specialized_delta_updates = true;
+
   // unconstrained
   size_t unconstrained_rounds = 1;
   double treshold_border_node_inclusion = 0.75;
@@ -201,6 +240,9 @@ struct FlowParameters {
   bool skip_small_cuts = false;
   bool skip_unpromising_blocks = false;
   bool pierce_in_bulk = false;
+  bool cache_constructions = false;
+  double max_changed_cached_region_fraction = 0.1;
+  size_t multiway_num_blocks = 0;
   SteinerTreeFlowValuePolicy steiner_tree_policy = SteinerTreeFlowValuePolicy::UNDEFINED;
 };
 
@@ -209,6 +251,7 @@ std::ostream& operator<<(std::ostream& out, const FlowParameters& params);
 struct DeterministicRefinementParameters {
   size_t num_sub_rounds_sync_lp = 5;
   bool use_active_node_set = false;
+  size_t num_sub_rounds_fm = 4;
 };
 
 std::ostream& operator<<(std::ostream& out, const DeterministicRefinementParameters& params);
@@ -269,6 +312,7 @@ struct SharedMemoryParameters {
   bool use_localized_random_shuffle = false;
   size_t shuffle_block_size = 2;
   double degree_of_parallelism = 1.0;
+  bool numa_aware_placement = false;
 };
 
 std::ostream & operator<< (std::ostream& str, const SharedMemoryParameters& params);
@@ -296,6 +340,31 @@ class Context {
 
   bool isNLevelPartitioning() const;
 
+  // ! True, if label propagation is executed within the multitry FM rounds instead of
+  // ! as a separate refinement phase (only supported for non-deterministic label propagation)
+  bool isLabelPropagationPipelinedWithFM() const;
+
+  // ! Starts the time budget of the current partitioning call (--time-limit)
+  void startTimeBudget();
+
+  bool hasTimeLimit() const;
+
+  // ! Elapsed time in seconds since the start of the current partitioning call
+  double elapsedTime() const;
+
+  // ! Remaining time in seconds until the time limit is reached
+  // ! (infinity if no time limit is set)
+  double remainingTime() const;
+
+  // ! True, if the time limit is reached or the partitioning call was cancelled
+  bool isTimeLimitExceeded() const;
+
+  // ! Cancels the current partitioning call. The partitioner then skips all remaining
+  // ! refinement and V-cycles and returns the partition as fast as possible.
+  void cancel() const;
+
+  bool isCancelled() const;
+
   bool forceGainCacheUpdates() const;
 
   bool disableSinglePinNetsRemoval() const;
@@ -237,6 +237,7 @@ namespace mt_kahypar {
     switch (algo) {
       case FMAlgorithm::kway_fm: return os << "kway_fm";
       case FMAlgorithm::unconstrained_fm: return os << "unconstrained_fm";
+      case FMAlgorithm::deterministic: return os << "deterministic";
       case FMAlgorithm::do_nothing: return os << "fm_do_nothing";
         // omit default case to trigger compiler warning for missing cases
     }
@@ -464,6 +465,8 @@ namespace mt_kahypar {
       return FMAlgorithm::kway_fm;
     } else if (type == "unconstrained_fm") {
       return FMAlgorithm::unconstrained_fm;
+    } else if (type == "deterministic") {
+      return FMAlgorithm::deterministic;
     } else if (type == "do_nothing") {
       return FMAlgorithm::do_nothing;
     }
@@ -162,6 +162,7 @@ enum class LabelPropagationAlgorithm : uint8_t {
 enum class FMAlgorithm : uint8_t {
   kway_fm,
   unconstrained_fm,
+  deterministic,
   do_nothing
 };
 
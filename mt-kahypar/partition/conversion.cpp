@@ -63,7 +63,8 @@ mt_kahypar_hypergraph_type_t to_hypergraph_c_type(const PresetType preset,
 }
 
 mt_kahypar_partition_type_t to_partition_c_type(const PresetType preset,
-                                                const InstanceType instance) {
+                                                const InstanceType instance,
+                                                const bool use_sparse_connectivity) {
   if ( instance == InstanceType::graph ) {
     if ( preset == PresetType::default_preset ||
          preset == PresetType::quality ||
@@ -79,7 +80,8 @@ mt_kahypar_partition_type_t to_partition_c_type(const PresetType preset,
          preset == PresetType::quality ||
          preset == PresetType::cluster ||
          preset == PresetType::deterministic ) {
-      return MULTILEVEL_HYPERGRAPH_PARTITIONING;
+      // Sparse connectivity information is only available via the large k partitioning types
+      return use_sparse_connectivity ? LARGE_K_PARTITIONING : MULTILEVEL_HYPERGRAPH_PARTITIONING;
     } else if ( preset == PresetType::highest_quality ) {
       return N_LEVEL_HYPERGRAPH_PARTITIONING;
     } else if ( preset == PresetType::large_k ) {
@@ -37,7 +37,8 @@ mt_kahypar_hypergraph_type_t to_hypergraph_c_type(const PresetType preset,
                                                   const InstanceType instance);
 
 mt_kahypar_partition_type_t to_partition_c_type(const PresetType preset,
-                                                const InstanceType instance);
+                                                const InstanceType instance,
+                                                const bool use_sparse_connectivity = false);
 
 PresetType to_preset_type(const Mode mode,
                           const PartitionID k,
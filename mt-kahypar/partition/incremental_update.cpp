@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/incremental_update.h"
+
+#include <algorithm>
+#include <string>
+
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar {
+
+namespace {
+
+void checkNode(const HypernodeID hn, const HypernodeID num_nodes) {
+  if ( hn >= num_nodes ) {
+    throw InvalidInputException("Node " + STR(hn) + " of the hypergraph delta does not exist");
+  }
+}
+
+void checkEdge(const HyperedgeID he, const HyperedgeID num_edges) {
+  if ( he >= num_edges ) {
+    throw InvalidInputException("Hyperedge " + STR(he) + " of the hypergraph delta does not exist");
+  }
+}
+
+void checkForDuplicatePins(vec<HypernodeID> pins) {
+  std::sort(pins.begin(), pins.end());
+  if ( std::adjacent_find(pins.begin(), pins.end()) != pins.end() ) {
+    throw InvalidInputException("An added hyperedge of the hypergraph delta contains a pin multiple times");
+  }
+}
+
+} // namespace
+
+template<typename TypeTraits>
+vec<HypernodeID> IncrementalUpdate<TypeTraits>::applyDelta(PartitionedHypergraph& partitioned_hg,
+                                                           const HypergraphDelta& delta) {
+  if constexpr ( Hypergraph::is_graph ) {
+    unused(partitioned_hg);
+    unused(delta);
+    throw UnsupportedOperationException("Incremental updates are only supported for hypergraphs");
+  } else {
+    Hypergraph& hypergraph = partitioned_hg.hypergraph();
+    const PartitionID k = partitioned_hg.k();
+    const HypernodeID num_nodes = hypergraph.initialNumNodes() + delta.added_nodes.size();
+    const HyperedgeID num_edges = hypergraph.initialNumEdges() + delta.added_edges.size();
+    if ( delta.added_edge_weights.size() > 0 &&
+         delta.added_edge_weights.size() != delta.added_edges.size() ) {
+      throw InvalidInputException("Number of added hyperedge weights does not match number of added hyperedges");
+    }
+
+    // ################## COLLECT NODES, HYPEREDGES AND PINS ##################
+    vec<HypernodeWeight> node_weights(num_nodes, 1);
+    vec<PartitionID> part_ids(num_nodes, kInvalidPartition);
+    vec<PartitionID> fixed_vertices(hypergraph.hasFixedVertices() ? num_nodes : 0, -1);
+    vec<vec<HypernodeID>> edges(num_edges);
+    vec<HyperedgeWeight> edge_weights(num_edges, 1);
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      node_weights[hn] = hypergraph.nodeWeight(hn);
+      part_ids[hn] = partitioned_hg.partID(hn);
+      if ( hypergraph.hasFixedVertices() && hypergraph.isFixed(hn) ) {
+        fixed_vertices[hn] = hypergraph.fixedVertexBlock(hn);
+      }
+    });
+    hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+      for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+        edges[he].push_back(pin);
+      }
+      edge_weights[he] = hypergraph.edgeWeight(he);
+    });
+    for ( size_t i = 0; i < delta.added_nodes.size(); ++i ) {
+      node_weights[hypergraph.initialNumNodes() + i] = delta.added_nodes[i];
+    }
+    for ( size_t i = 0; i < delta.added_edges.size(); ++i ) {
+      const HyperedgeID he = hypergraph.initialNumEdges() + i;
+      edges[he] = delta.added_edges[i];
+      edge_weights[he] = delta.added_edge_weights.empty() ? 1 : delta.added_edge_weights[i];
+    }
+
+    // ################## APPLY DELTA ##################
+    vec<bool> changed_node(num_nodes, false);
+    vec<bool> changed_edge(num_edges, false);
+    vec<bool> removed_node(num_nodes, false);
+    vec<bool> removed_edge(num_edges, false);
+    for ( size_t i = 0; i < delta.added_nodes.size(); ++i ) {
+      changed_node[hypergraph.initialNumNodes() + i] = true;
+    }
+    for ( size_t i = 0; i < delta.added_edges.size(); ++i ) {
+      changed_edge[hypergraph.initialNumEdges() + i] = true;
+      for ( const HypernodeID& pin : delta.added_edges[i] ) {
+        checkNode(pin, num_nodes);
+      }
+      checkForDuplicatePins(delta.added_edges[i]);
+    }
+    for ( const auto& [he, hn] : delta.removed_pins ) {
+      checkEdge(he, num_edges);
+      checkNode(hn, num_nodes);
+      auto it = std::find(edges[he].begin(), edges[he].end(), hn);
+      if ( it != edges[he].end() ) {
+        std::swap(*it, edges[he].back());
+        edges[he].pop_back();
+      }
+      changed_edge[he] = true;
+      changed_node[hn] = true;
+    }
+    for ( const auto& [he, hn] : delta.added_pins ) {
+      checkEdge(he, num_edges);
+      checkNode(hn, num_nodes);
+      if ( std::find(edges[he].begin(), edges[he].end(), hn) == edges[he].end() ) {
+        edges[he].push_back(hn);
+      }
+      changed_edge[he] = true;
+      changed_node[hn] = true;
+    }
+    for ( const auto& [hn, weight] : delta.node_weight_changes ) {
+      checkNode(hn, num_nodes);
+      node_weights[hn] = weight;
+      changed_node[hn] = true;
+    }
+    for ( const auto& [he, weight] : delta.edge_weight_changes ) {
+      checkEdge(he, num_edges);
+      edge_weights[he] = weight;
+      changed_edge[he] = true;
+    }
+    for ( const HyperedgeID& he : delta.removed_edges ) {
+      checkEdge(he, num_edges);
+      removed_edge[he] = true;
+      changed_edge[he] = true;
+    }
+    for ( const HypernodeID& hn : delta.removed_nodes ) {
+      checkNode(hn, num_nodes);
+      removed_node[hn] = true;
+      if ( hn < hypergraph.initialNumNodes() ) {
+        for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+          changed_edge[he] = true;
+        }
+      }
+    }
+
+    // ################## COMPACTIFY ##################
+    vec<HypernodeID> node_mapping(num_nodes, kInvalidHypernode);
+    HypernodeID num_new_nodes = 0;
+    for ( HypernodeID hn = 0; hn < num_nodes; ++hn ) {
+      if ( !removed_node[hn] ) {
+        node_mapping[hn] = num_new_nodes;
+        node_weights[num_new_nodes] = node_weights[hn];
+        part_ids[num_new_nodes] = part_ids[hn];
+        changed_node[num_new_nodes] = changed_node[hn];
+        if ( !fixed_vertices.empty() ) {
+          fixed_vertices[num_new_nodes] = fixed_vertices[hn];
+        }
+        ++num_new_nodes;
+      }
+    }
+    node_weights.resize(num_new_nodes);
+    part_ids.resize(num_new_nodes);
+    changed_node.resize(num_new_nodes);
+    if ( !fixed_vertices.empty() ) {
+      fixed_vertices.resize(num_new_nodes);
+    }
+
+    HyperedgeID num_new_edges = 0;
+    for ( HyperedgeID he = 0; he < num_edges; ++he ) {
+      if ( removed_edge[he] ) {
+        continue;
+      }
+      vec<HypernodeID>& pins = edges[he];
+      size_t size = 0;
+      for ( const HypernodeID& pin : pins ) {
+        if ( !removed_node[pin] ) {
+          pins[size++] = node_mapping[pin];
+        }
+      }
+      pins.resize(size);
+      if ( pins.empty() ) {
+        continue;
+      }
+      if ( changed_edge[he] ) {
+        for ( const HypernodeID& pin : pins ) {
+          changed_node[pin] = true;
+        }
+      }
+      edge_weights[num_new_edges] = edge_weights[he];
+      if ( num_new_edges != he ) {
+        edges[num_new_edges] = std::move(pins);
+      }
+      ++num_new_edges;
+    }
+    edges.resize(num_new_edges);
+    edge_weights.resize(num_new_edges);
+
+    // ################## ASSIGN NEW NODES ##################
+    // A new node is assigned to the block with the highest total weight of incident
+    // hyperedges that contain an already assigned node of that block, i.e., a hyperedge
+    // contributes its weight once to each of its blocks (ties are broken by block weight)
+    vec<vec<HyperedgeID>> incident_edges_of_new_nodes(num_new_nodes);
+    vec<HypernodeWeight> block_weights(k, 0);
+    for ( HypernodeID hn = 0; hn < num_new_nodes; ++hn ) {
+      if ( !fixed_vertices.empty() && fixed_vertices[hn] != -1 ) {
+        part_ids[hn] = fixed_vertices[hn];
+      }
+      if ( part_ids[hn] != kInvalidPartition ) {
+        block_weights[part_ids[hn]] += node_weights[hn];
+      }
+    }
+    for ( HyperedgeID he = 0; he < num_new_edges; ++he ) {
+      for ( const HypernodeID& pin : edges[he] ) {
+        if ( part_ids[pin] == kInvalidPartition ) {
+          incident_edges_of_new_nodes[pin].push_back(he);
+        }
+      }
+    }
+    vec<HyperedgeWeight> rating(k, 0);
+    vec<HyperedgeID> last_rated_edge(k, kInvalidHyperedge);
+    for ( HypernodeID hn = 0; hn < num_new_nodes; ++hn ) {
+      if ( part_ids[hn] == kInvalidPartition ) {
+        std::fill(rating.begin(), rating.end(), 0);
+        std::fill(last_rated_edge.begin(), last_rated_edge.end(), kInvalidHyperedge);
+        for ( const HyperedgeID& he : incident_edges_of_new_nodes[hn] ) {
+          for ( const HypernodeID& pin : edges[he] ) {
+            const PartitionID block = part_ids[pin];
+            if ( block != kInvalidPartition && last_rated_edge[block] != he ) {
+              rating[block] += edge_weights[he];
+              last_rated_edge[block] = he;
+            }
+          }
+        }
+        PartitionID best_block = 0;
+        for ( PartitionID block = 1; block < k; ++block ) {
+          if ( rating[block] > rating[best_block] ||
+               ( rating[block] == rating[best_block] && block_weights[block] < block_weights[best_block] ) ) {
+            best_block = block;
+          }
+        }
+        part_ids[hn] = best_block;
+        block_weights[best_block] += node_weights[hn];
+      }
+    }
+
+    // ################## REPLACE HYPERGRAPH ##################
+    Hypergraph updated_hypergraph = Hypergraph::Factory::construct(num_new_nodes, num_new_edges,
+      edges, edge_weights.data(), node_weights.data(), true);
+    // Release the data of the partitioned hypergraph before we replace its underlying hypergraph
+    partitioned_hg = PartitionedHypergraph();
+    hypergraph = std::move(updated_hypergraph);
+    if ( !fixed_vertices.empty() ) {
+      io::addFixedVertices(utils::hypergraph_cast(hypergraph), fixed_vertices.data(), k);
+    }
+    partitioned_hg = PartitionedHypergraph(k, hypergraph, parallel_tag_t { });
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      partitioned_hg.setOnlyNodePart(hn, part_ids[hn]);
+    });
+    partitioned_hg.initializePartition();
+    partitioned_hg.needsConductancePriorityQueue(); // initializes conductance priority queue if needed
+
+    vec<HypernodeID> refinement_nodes;
+    for ( HypernodeID hn = 0; hn < num_new_nodes; ++hn ) {
+      if ( changed_node[hn] ) {
+        refinement_nodes.push_back(hn);
+      }
+    }
+    DBG << "Applied hypergraph delta:" << V(num_new_nodes) << V(num_new_edges)
+        << V(refinement_nodes.size());
+    return refinement_nodes;
+  }
+}
+
+INSTANTIATE_CLASS_WITH_TYPE_TRAITS(IncrementalUpdate)
+
+} // namepace mt_kahypar
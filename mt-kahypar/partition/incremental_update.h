@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <utility>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+/**
+ * Describes the changes of a hypergraph between two partitioning runs.
+ * All IDs refer to the hypergraph before the update, except that the i-th added
+ * node gets ID n + i and the i-th added hyperedge gets ID m + i (n and m are the
+ * number of nodes and hyperedges before the update). Removed nodes and hyperedges
+ * are compacted afterwards, i.e., the remaining ones keep their relative order.
+ */
+struct HypergraphDelta {
+  vec<HypernodeWeight> added_nodes;
+  vec<HypernodeID> removed_nodes;
+  vec<vec<HypernodeID>> added_edges;
+  vec<HyperedgeWeight> added_edge_weights;
+  vec<HyperedgeID> removed_edges;
+  vec<std::pair<HyperedgeID, HypernodeID>> added_pins;
+  vec<std::pair<HyperedgeID, HypernodeID>> removed_pins;
+  vec<std::pair<HypernodeID, HypernodeWeight>> node_weight_changes;
+  vec<std::pair<HyperedgeID, HyperedgeWeight>> edge_weight_changes;
+};
+
+template<typename TypeTraits>
+class IncrementalUpdate {
+
+  static constexpr bool debug = false;
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+ public:
+  // ! Applies the delta to the underlying hypergraph of the partitioned hypergraph.
+  // ! Both objects are replaced in place (references to them remain valid). Nodes
+  // ! keep their block, and added nodes are assigned to the block to which they
+  // ! are most strongly connected. Returns all nodes around the changed region
+  // ! (the nodes of the updated hypergraph whose gains might have changed).
+  static vec<HypernodeID> applyDelta(PartitionedHypergraph& partitioned_hg,
+                                     const HypergraphDelta& delta);
+};
+
+}  // namespace mt_kahypar
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/memory_budget.h"
+
+#include <algorithm>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/pin_count_in_part.h"
+#include "mt-kahypar/datastructures/connectivity_set.h"
+#include "mt-kahypar/datastructures/sparse_pin_counts.h"
+#include "mt-kahypar/parallel/memory_accounting.h"
+#include "mt-kahypar/partition/conversion.h"
+#include "mt-kahypar/utils/cast.h"
+
+namespace mt_kahypar {
+
+namespace {
+  static constexpr bool debug = false;
+
+  // Rough estimation of the memory required per pin of a flow problem
+  // (flow hypergraph, incidence lists and the data structures of the flow algorithm)
+  static constexpr size_t FLOW_MEMORY_PER_PIN = 64;
+
+  double to_mb(const size_t size_in_bytes) {
+    return static_cast<double>(size_in_bytes) / 1000000.0;
+  }
+}
+
+void adapt_connectivity_to_memory_limit(const mt_kahypar_hypergraph_t hypergraph,
+                                        Context& context) {
+  #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+  const auto& accounting = parallel::MemoryAccounting::instance();
+  if ( !accounting.hasMemoryLimit() || hypergraph.type != STATIC_HYPERGRAPH ||
+       context.partition.partition_type != MULTILEVEL_HYPERGRAPH_PARTITIONING ||
+       context.partition.objective == Objective::steiner_tree ) {
+    return;
+  }
+
+  const ds::StaticHypergraph& hg = utils::cast_const<ds::StaticHypergraph>(hypergraph);
+  const HyperedgeID num_hyperedges = hg.initialNumEdges();
+  const PartitionID k = context.partition.k;
+  const size_t dense_size_in_bytes =
+    ds::PinCountInPart::num_elements(num_hyperedges, k, hg.maxEdgeSize()) * sizeof(ds::PinCountInPart::Value) +
+    ds::ConnectivitySets::num_elements(num_hyperedges, k) * sizeof(ds::ConnectivitySets::UnsafeBlock);
+  const size_t sparse_size_in_bytes =
+    ds::SparsePinCounts::num_elements(num_hyperedges, k, hg.maxEdgeSize()) * sizeof(ds::SparsePinCounts::Value);
+  DBG << "Dense connectivity information =" << to_mb(dense_size_in_bytes) << "MB"
+      << ", sparse connectivity information =" << to_mb(sparse_size_in_bytes) << "MB"
+      << ", remaining =" << to_mb(accounting.remainingBytes()) << "MB";
+
+  if ( !accounting.fitsIntoMemoryLimit(dense_size_in_bytes) &&
+       sparse_size_in_bytes < dense_size_in_bytes ) {
+    context.partition.use_sparse_connectivity = true;
+    context.partition.partition_type = to_partition_c_type(
+      context.partition.preset_type, context.partition.instance_type, true);
+    if ( context.partition.verbose_output ) {
+      INFO("Dense connectivity information requires" << to_mb(dense_size_in_bytes)
+        << "MB, which exceeds the memory limit. Switching to sparse connectivity information"
+        << "(" << to_mb(sparse_size_in_bytes) << "MB ).");
+    }
+  }
+  #else
+  unused(hypergraph);
+  unused(context);
+  #endif
+}
+
+void adapt_initial_partitioning_to_memory_limit(const HypernodeID num_nodes,
+                                                Context& context) {
+  const auto& accounting = parallel::MemoryAccounting::instance();
+  if ( !accounting.hasMemoryLimit() || num_nodes == 0 ) {
+    return;
+  }
+
+  // Each entry of the pool stores a partition of the coarsest hypergraph
+  const size_t partition_size_in_bytes = static_cast<size_t>(num_nodes) * sizeof(PartitionID);
+  const size_t max_population_size = std::max(UL(1),
+    accounting.remainingBytes() / partition_size_in_bytes);
+  if ( max_population_size < context.initial_partitioning.population_size ) {
+    DBG << "Reduce population size of initial partitioning pool from"
+        << context.initial_partitioning.population_size << "to" << max_population_size;
+    context.initial_partitioning.population_size = max_population_size;
+  }
+}
+
+void adapt_flows_to_memory_limit(const HypernodeID num_pins,
+                                 Context& context) {
+  const auto& accounting = parallel::MemoryAccounting::instance();
+  if ( !accounting.hasMemoryLimit() ||
+       context.refinement.flows.algorithm == FlowAlgorithm::do_nothing ) {
+    return;
+  }
+
+  // The size of a flow problem is bounded by the maximum number of pins of a search
+  const size_t max_pins_per_search = std::min(
+    static_cast<size_t>(context.refinement.flows.max_num_pins), static_cast<size_t>(num_pins));
+  const size_t search_size_in_bytes = std::max(UL(1), max_pins_per_search * FLOW_MEMORY_PER_PIN);
+  const size_t max_parallel_searches = std::max(UL(1),
+    accounting.remainingBytes() / search_size_in_bytes);
+  if ( max_parallel_searches < context.refinement.flows.num_parallel_searches ) {
+    if ( context.partition.verbose_output && context.type == ContextType::main ) {
+      INFO("Flow-based refinement exceeds the memory limit. Reducing the number of parallel searches from"
+        << context.refinement.flows.num_parallel_searches << "to" << max_parallel_searches << ".");
+    }
+    context.refinement.flows.num_parallel_searches = max_parallel_searches;
+  }
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "include/mtkahypartypes.h"
+
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Fallbacks to variants with lower memory requirements, if the projected
+ * memory usage of the next phase exceeds the memory limit (--memory-limit).
+ * The remaining memory budget is determined via parallel::MemoryAccounting.
+ * All functions do nothing if no memory limit is set.
+ */
+
+// ! Switches to sparse connectivity information (see ds::SparsePinCounts), if the
+// ! dense pin count and connectivity set data structures exceed the memory limit.
+// ! Must be called before the memory pool is registered.
+void adapt_connectivity_to_memory_limit(const mt_kahypar_hypergraph_t hypergraph,
+                                        Context& context);
+
+// ! Reduces the number of partitions stored in the initial partitioning pool
+void adapt_initial_partitioning_to_memory_limit(const HypernodeID num_nodes,
+                                                Context& context);
+
+// ! Reduces the number of parallel flow searches such that
+// ! the flow hypergraphs of all searches fit into the memory limit
+void adapt_flows_to_memory_limit(const HypernodeID num_pins,
+                                 Context& context);
+
+}  // namespace mt_kahypar
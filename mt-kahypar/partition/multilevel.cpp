@@ -27,6 +27,8 @@
 
 #include "mt-kahypar/partition/multilevel.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 
 #include <tbb/task.h>
@@ -35,6 +37,10 @@
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/factories.h"
+#include "mt-kahypar/partition/memory_budget.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/progress.h"
+#include "mt-kahypar/partition/time_budget.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/degree_zero_hn_remover.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/large_he_remover.h"
 #include "mt-kahypar/partition/initial_partitioning/pool_initial_partitioner.h"
@@ -72,6 +78,33 @@ namespace {
     }
   }
 
+  template<typename PartitionedHypergraph>
+  void reportBestPartition(const PartitionedHypergraph& partitioned_hg, const Context& context) {
+    if ( !context.partition.best_partition_callback || context.type != ContextType::main ) {
+      return;
+    }
+
+    vec<PartitionID> partition(partitioned_hg.initialNumNodes(), kInvalidPartition);
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      partition[hn] = partitioned_hg.partID(hn);
+    });
+    // Nodes removed before partitioning (degree-zero nodes) are not part of the
+    // partitioned hypergraph. We assign them to the lightest block.
+    vec<HypernodeWeight> block_weights(partitioned_hg.k());
+    for ( PartitionID block = 0; block < partitioned_hg.k(); ++block ) {
+      block_weights[block] = partitioned_hg.partWeight(block);
+    }
+    for ( HypernodeID hn = 0; hn < partition.size(); ++hn ) {
+      if ( partition[hn] == kInvalidPartition ) {
+        const PartitionID block = std::min_element(block_weights.begin(), block_weights.end()) - block_weights.begin();
+        partition[hn] = block;
+        block_weights[block] += partitioned_hg.nodeWeight(hn);
+      }
+    }
+    context.partition.best_partition_callback(
+      partition, metrics::quality(partitioned_hg, context), context.elapsedTime());
+  }
+
   template<typename TypeTraits>
   typename TypeTraits::PartitionedHypergraph multilevel_partitioning(
     typename TypeTraits::Hypergraph& hypergraph,
@@ -107,6 +140,16 @@ namespace {
     }
     timer.stop_timer("coarsening");
 
+    const size_t num_levels = nlevel ? uncoarseningData.removed_hyperedges_batches.size() + 1 :
+      uncoarseningData.hierarchy.size();
+    if ( has_progress_callback(context) ) {
+      mt_kahypar_progress_t progress { };
+      progress.phase = PROGRESS_COARSENING;
+      progress.level = num_levels;
+      progress.num_nodes = uncoarseningData.coarsestPartitionedHypergraph().initialNumNodes();
+      report_progress(context, progress);
+    }
+
     // ################## INITIAL PARTITIONING ##################
     io::printInitialPartitioningBanner(context);
     timer.start_timer("initial_partitioning", "Initial Partitioning");
@@ -149,13 +192,15 @@ namespace {
       Context ip_context(context);
       ip_context.type = ContextType::initial_partitioning;
       ip_context.refinement = context.initial_partitioning.refinement;
+      adapt_initial_partitioning_to_memory_limit(phg.initialNumNodes(), ip_context);
+      adapt_initial_partitioning_to_time_limit(ip_context);
       disableTimerAndStats(context);
       if ( context.initial_partitioning.mode == Mode::direct ) {
         // The pool initial partitioner consist of several flat bipartitioning
         // techniques. This case runs as a base case (k = 2) within recursive bipartitioning
         // or the deep multilevel scheme.
         ip_context.partition.verbose_output = false;
-        Pool<TypeTraits>::bipartition(phg, ip_context);
+        Pool<TypeTraits>::bipartition(phg, ip_context, ip_context.shared_memory.num_threads > 1);
       } else if ( context.initial_partitioning.mode == Mode::recursive_bipartitioning ) {
         RecursiveBipartitioning<TypeTraits>::partition(phg, ip_context, target_graph);
       } else if ( context.initial_partitioning.mode == Mode::deep_multilevel ) {
@@ -214,11 +259,16 @@ namespace {
       utils::Utilities::instance().getInitialPartitioningStats(
         context.utility_id).printInitialPartitioningStats();
     }
+    if ( has_progress_callback(context) ) {
+      report_progress(phg, context, PROGRESS_INITIAL_PARTITIONING, num_levels,
+        phg.initialNumNodes(), metrics::quality(phg, context));
+    }
     timer.stop_timer("initial_partitioning");
 
     // ################## UNCOARSENING ##################
     io::printLocalSearchBanner(context);
     timer.start_timer("refinement", "Refinement");
+    adapt_flows_to_memory_limit(hypergraph.initialNumPins(), context);
     std::unique_ptr<IUncoarsener<TypeTraits>> uncoarsener(nullptr);
     if (uncoarseningData.nlevel) {
       uncoarsener = std::make_unique<NLevelUncoarsener<TypeTraits>>(
@@ -229,6 +279,23 @@ namespace {
     }
     partitioned_hg = uncoarsener->uncoarsen();
 
+    if ( context.partition.verbose_output && context.partition.show_memory_consumption &&
+         context.type == ContextType::main && !uncoarseningData.nlevel ) {
+      utils::MemoryTreeNode hierarchy_memory_consumption("Coarsening", utils::OutputType::MEGABYTE);
+      uncoarseningData.memoryConsumption(&hierarchy_memory_consumption);
+      hierarchy_memory_consumption.finalize();
+      LOG << "\nMultilevel Hierarchy Memory Consumption"
+          << "(Dropped Levels =" << uncoarseningData.numDroppedLevels()
+          << ", Restored Levels =" << uncoarseningData.numRestoredLevels() << ")";
+      LOG << hierarchy_memory_consumption;
+      const ds::LevelArena::Stats& arena_stats = uncoarseningData.contractionArenaStats();
+      LOG << "Contraction Buffer Arena"
+          << "(Levels =" << arena_stats.num_levels
+          << ", Reserved =" << arena_stats.reserved_bytes << "bytes"
+          << ", Peak Used =" << arena_stats.peak_used_bytes << "bytes"
+          << ", Requested over all Levels =" << arena_stats.requested_bytes << "bytes)";
+    }
+
     io::printPartitioningResults(partitioned_hg, context, "Local Search Results:");
     timer.stop_timer("refinement");
 
@@ -241,9 +308,12 @@ typename Multilevel<TypeTraits>::PartitionedHypergraph Multilevel<TypeTraits>::p
   Hypergraph& hypergraph, Context& context, const TargetGraph* target_graph) {
   PartitionedHypergraph partitioned_hg =
     multilevel_partitioning<TypeTraits>(hypergraph, context, target_graph, false);
+  reportBestPartition(partitioned_hg, context);
 
   // ################## V-CYCLES ##################
-  if ( context.partition.num_vcycles > 0 && context.type == ContextType::main ) {
+  // If a time limit is set, we perform V-cycles until it is reached
+  if ( ( context.partition.num_vcycles > 0 || context.hasTimeLimit() ) &&
+       context.type == ContextType::main ) {
     partitionVCycle(hypergraph, partitioned_hg, context, target_graph);
   }
 
@@ -267,9 +337,25 @@ void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
                                              PartitionedHypergraph& partitioned_hg,
                                              Context& context,
                                              const TargetGraph* target_graph) {
-  ASSERT(context.partition.num_vcycles > 0);
+  ASSERT(context.partition.num_vcycles > 0 || context.hasTimeLimit());
+
+  const size_t max_num_vcycles = context.partition.num_vcycles > 0 ?
+    context.partition.num_vcycles : std::numeric_limits<size_t>::max();
+  vec<PartitionID> best_partition(hypergraph.initialNumNodes(), kInvalidPartition);
+  HyperedgeWeight best_quality = metrics::quality(partitioned_hg, context);
+  bool best_is_balanced = metrics::isBalanced(partitioned_hg, context);
+  double last_vcycle_time = 0.0;
+  for ( size_t i = 0; i < max_num_vcycles; ++i ) {
+    // Only start the next V-cycle if it is likely to finish within the time limit
+    if ( context.isTimeLimitExceeded() || context.remainingTime() < last_vcycle_time ) {
+      if ( context.partition.verbose_output ) {
+        LOG << ( context.isCancelled() ? "Partitioning cancelled after" : "Time limit reached after" )
+            << i << "V-cycles";
+      }
+      break;
+    }
+    const auto vcycle_start = std::chrono::high_resolution_clock::now();
 
-  for ( size_t i = 0; i < context.partition.num_vcycles; ++i ) {
     // Reset memory pool
     hypergraph.reset();
     parallel::MemoryPool::instance().reset();
@@ -287,12 +373,36 @@ void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
     // smallest hypergraph as initial partition.
     hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
       hypergraph.setCommunityID(hn, partitioned_hg.partID(hn));
+      best_partition[hn] = partitioned_hg.partID(hn);
     });
 
     // Perform V-cycle
     io::printVCycleBanner(context, i + 1);
     partitioned_hg = multilevel_partitioning<TypeTraits>(
       hypergraph, context, target_graph, true /* V-cycle flag */ );
+    last_vcycle_time = std::chrono::duration<double>(
+      std::chrono::high_resolution_clock::now() - vcycle_start).count();
+
+    // Rebalancing can worsen the partition. In this case, we restore the best partition.
+    const HyperedgeWeight quality = metrics::quality(partitioned_hg, context);
+    const bool is_balanced = metrics::isBalanced(partitioned_hg, context);
+    if ( ( best_is_balanced && !is_balanced ) ||
+         ( best_is_balanced == is_balanced && quality > best_quality ) ) {
+      partitioned_hg.resetData();
+      partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+        partitioned_hg.setOnlyNodePart(hn, best_partition[hn]);
+      });
+      partitioned_hg.initializePartition();
+    } else if ( quality < best_quality || is_balanced != best_is_balanced ) {
+      best_quality = quality;
+      best_is_balanced = is_balanced;
+      reportBestPartition(partitioned_hg, context);
+    }
+
+    if ( has_progress_callback(context) ) {
+      report_progress(partitioned_hg, context, PROGRESS_VCYCLE, 0,
+        partitioned_hg.initialNumNodes(), metrics::quality(partitioned_hg, context));
+    }
   }
 }
 
@@ -39,9 +39,12 @@
 #include "mt-kahypar/partition/recursive_bipartitioning.h"
 #include "mt-kahypar/partition/deep_multilevel.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/partition/factories.h"
+#include "mt-kahypar/partition/metrics.h"
 #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
 #include "mt-kahypar/partition/mapping/initial_mapping.h"
 #endif
+#include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/hypergraph_statistics.h"
 #include "mt-kahypar/utils/stats.h"
 #include "mt-kahypar/utils/timer.h"
@@ -268,7 +271,7 @@ namespace mt_kahypar {
   }
 
   template<typename Hypergraph>
-  void preprocess(Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
+  bool preprocess(Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
     bool use_community_detection = context.preprocessing.use_community_detection;
     bool is_graph = false;
 
@@ -308,6 +311,123 @@ namespace mt_kahypar {
     precomputeSteinerTrees(hypergraph, target_graph, context);
 
     parallel::MemoryPool::instance().release_mem_group("Preprocessing");
+    return use_community_detection;
+  }
+
+  template<typename TypeTraits>
+  bool partitionFromCommunities(typename TypeTraits::Hypergraph& hypergraph,
+                                typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+                                Context& context) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    if ( Hypergraph::is_graph || hypergraph.hasFixedVertices() ||
+         context.partition.preset_type != PresetType::cluster ||
+         !context.preprocessing.use_communities_as_clustering ||
+         ( context.partition.objective != Objective::conductance_local &&
+           context.partition.objective != Objective::conductance_global ) ) {
+      return false;
+    }
+
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("communities_as_clustering", "Communities as Clustering");
+
+    // Community IDs are not consecutive after restricting the clustering to the
+    // hypernodes. Therefore, we remap them to the block IDs 0, ..., k - 1.
+    PartitionID max_community_id = 0;
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      max_community_id = std::max(max_community_id, hypergraph.communityID(hn));
+    }
+    vec<PartitionID> community_to_block(max_community_id + 1, kInvalidPartition);
+    PartitionID num_communities = 0;
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      PartitionID& block = community_to_block[hypergraph.communityID(hn)];
+      if ( block == kInvalidPartition ) {
+        block = num_communities++;
+      }
+    }
+
+    // The multilevel pipeline computes at most initial_k clusters, or at most as
+    // many clusters as nodes in the coarsest hypergraph if singleton IP is enabled.
+    const bool singleton_ip = context.initial_partitioning.enabled_ip_algos[
+      static_cast<size_t>(InitialPartitioningAlgorithm::singleton)];
+    const PartitionID max_k = singleton_ip ?
+      static_cast<PartitionID>(context.coarsening.contraction_limit) : context.partition.initial_k;
+    if ( num_communities < 2 || num_communities > max_k ) {
+      if ( context.partition.verbose_output ) {
+        LOG << "Number of communities" << V(num_communities) << "is not in [2," << max_k << "]."
+            << "Communities are not used as clustering.";
+      }
+      timer.stop_timer("communities_as_clustering");
+      return false;
+    }
+
+    PartitionedHypergraph phg(num_communities, hypergraph, parallel_tag_t { });
+    phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      phg.setOnlyNodePart(hn, community_to_block[hypergraph.communityID(hn)]);
+    });
+    phg.initializePartition();
+
+    const double conductance = metrics::compute_double_conductance(phg);
+    if ( conductance > context.preprocessing.communities_as_clustering_max_conductance ) {
+      if ( context.partition.verbose_output ) {
+        LOG << "Conductance of communities" << V(conductance) << "exceeds"
+            << context.preprocessing.communities_as_clustering_max_conductance
+            << "=> Proceed with multilevel clustering.";
+      }
+      timer.stop_timer("communities_as_clustering");
+      return false;
+    }
+
+    context.partition.k = num_communities;
+    context.setupPartWeights(hypergraph.totalWeight());
+    context.setupContractionLimit(hypergraph.totalWeight());
+    context.setupThreadsPerFlowSearch();
+    io::printPartitioningResults(phg, context, "Community Clustering Results:");
+
+    // Refine communities with label propagation on the input hypergraph
+    io::printLocalSearchBanner(context);
+    gain_cache_t gain_cache = GainCachePtr::constructGainCache(context);
+    std::unique_ptr<IRebalancer> rebalancer = RebalancerFactory::getInstance().createObject(
+      context.refinement.rebalancer, hypergraph.initialNumNodes(), context, gain_cache);
+    std::unique_ptr<IRefiner> label_propagation = LabelPropagationFactory::getInstance().createObject(
+      context.refinement.label_propagation.algorithm,
+      hypergraph.initialNumNodes(), hypergraph.initialNumEdges(), context, gain_cache, *rebalancer);
+
+    Metrics current_metrics = { metrics::quality(phg, context), metrics::imbalance(phg, context) };
+    mt_kahypar_partitioned_hypergraph_t partitioned_hypergraph = utils::partitioned_hg_cast(phg);
+    parallel::scalable_vector<HypernodeID> dummy;
+    if ( context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
+      bool improvement_found = true;
+      while ( improvement_found ) {
+        const HyperedgeWeight metric_before = current_metrics.quality;
+        if ( context.refinement.rebalancer != RebalancingAlgorithm::do_nothing ) {
+          rebalancer->initialize(partitioned_hypergraph);
+        }
+        timer.start_timer("initialize_lp_refiner", "Initialize LP Refiner");
+        label_propagation->initialize(partitioned_hypergraph);
+        timer.stop_timer("initialize_lp_refiner");
+
+        timer.start_timer("label_propagation", "Label Propagation");
+        improvement_found = label_propagation->refine(partitioned_hypergraph,
+          dummy, current_metrics, std::numeric_limits<double>::max());
+        timer.stop_timer("label_propagation");
+
+        const double relative_improvement = 1.0 -
+          static_cast<double>(current_metrics.quality) / metric_before;
+        if ( !context.refinement.refine_until_no_improvement ||
+             relative_improvement <= context.refinement.relative_improvement_threshold ) {
+          break;
+        }
+      }
+    }
+    label_propagation.reset();
+    rebalancer.reset();
+    GainCachePtr::deleteGainCache(gain_cache);
+
+    io::printPartitioningResults(phg, context, "Local Search Results:");
+    partitioned_hg = std::move(phg);
+    timer.stop_timer("communities_as_clustering");
+    return true;
   }
 
   template<typename PartitionedHypergraph>
@@ -339,8 +459,15 @@ namespace mt_kahypar {
   template<typename TypeTraits>
   typename Partitioner<TypeTraits>::PartitionedHypergraph Partitioner<TypeTraits>::partition(
     Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
+    context.startTimeBudget();
     configurePreprocessing(hypergraph, context);
     setupContext(hypergraph, context, target_graph);
+    if ( context.partition.mode != Mode::direct ) {
+      // Intermediate partitions and progress are only reported by the direct multilevel scheme
+      // (the other schemes run several multilevel cycles with a main context in parallel)
+      context.partition.best_partition_callback = nullptr;
+      context.partition.progress_callback = nullptr;
+    }
 
     io::printContext(context);
     io::printMemoryPoolConsumption(context);
@@ -361,13 +488,16 @@ namespace mt_kahypar {
     timer.start_timer("preprocessing", "Preprocessing");
     DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(context);
     LargeHyperedgeRemover<TypeTraits> large_he_remover(context);
-    preprocess(hypergraph, context, target_graph);
+    const bool has_communities = preprocess(hypergraph, context, target_graph);
     sanitize(hypergraph, context, degree_zero_hn_remover, large_he_remover);
     timer.stop_timer("preprocessing");
 
     // ################## MULTILEVEL & VCYCLE ##################
     PartitionedHypergraph partitioned_hypergraph;
-    if (context.partition.mode == Mode::direct) {
+    if ( has_communities && partitionFromCommunities<TypeTraits>(
+           hypergraph, partitioned_hypergraph, context) ) {
+      // Communities are used as clustering => multilevel hierarchy is skipped
+    } else if (context.partition.mode == Mode::direct) {
       partitioned_hypergraph = Multilevel<TypeTraits>::partition(hypergraph, context, target_graph);
     } else if (context.partition.mode == Mode::recursive_bipartitioning) {
       partitioned_hypergraph = RecursiveBipartitioning<TypeTraits>::partition(hypergraph, context, target_graph);
@@ -425,6 +555,7 @@ namespace mt_kahypar {
   void Partitioner<TypeTraits>::partitionVCycle(PartitionedHypergraph& partitioned_hg,
                                                 Context& context,
                                                 TargetGraph* target_graph) {
+    context.startTimeBudget();
     Hypergraph& hypergraph = partitioned_hg.hypergraph();
     configurePreprocessing(hypergraph, context);
     setupContext(hypergraph, context, target_graph);
@@ -484,5 +615,88 @@ namespace mt_kahypar {
     }(), "Some fixed vertices are not assigned to their corresponding block");
   }
 
+  template<typename TypeTraits>
+  void Partitioner<TypeTraits>::refineLocally(PartitionedHypergraph& partitioned_hg,
+                                              const vec<HypernodeID>& refinement_nodes,
+                                              Context& context,
+                                              TargetGraph* target_graph) {
+    context.startTimeBudget();
+    Hypergraph& hypergraph = partitioned_hg.hypergraph();
+    setupContext(hypergraph, context, target_graph);
+
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("preprocessing", "Preprocessing");
+    precomputeSteinerTrees(hypergraph, target_graph, context);
+    partitioned_hg.setTargetGraph(target_graph);
+    timer.stop_timer("preprocessing");
+
+    io::printContext(context);
+    io::printInputInformation(context, hypergraph);
+    io::printPartitioningResults(partitioned_hg, context, "\nInput Partition:");
+
+    // ################## LOCALIZED REFINEMENT ##################
+    io::printLocalSearchBanner(context);
+    timer.start_timer("refinement", "Refinement");
+    gain_cache_t gain_cache = GainCachePtr::constructGainCache(context);
+    std::unique_ptr<IRebalancer> rebalancer = RebalancerFactory::getInstance().createObject(
+      context.refinement.rebalancer, hypergraph.initialNumNodes(), context, gain_cache);
+    std::unique_ptr<IRefiner> label_propagation = LabelPropagationFactory::getInstance().createObject(
+      context.refinement.label_propagation.algorithm,
+      hypergraph.initialNumNodes(), hypergraph.initialNumEdges(), context, gain_cache, *rebalancer);
+    std::unique_ptr<IRefiner> fm = FMFactory::getInstance().createObject(
+      context.refinement.fm.algorithm,
+      hypergraph.initialNumNodes(), hypergraph.initialNumEdges(), context, gain_cache, *rebalancer);
+
+    Metrics current_metrics = { metrics::quality(partitioned_hg, context),
+                                metrics::imbalance(partitioned_hg, context) };
+    mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hg);
+    // Note that an empty set of refinement nodes would refine all border nodes
+    bool improvement_found = !refinement_nodes.empty();
+    while ( improvement_found && !context.isTimeLimitExceeded() ) {
+      improvement_found = false;
+      if ( context.refinement.rebalancer != RebalancingAlgorithm::do_nothing ) {
+        rebalancer->initialize(phg);
+      }
+
+      if ( context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
+        timer.start_timer("label_propagation", "Label Propagation");
+        label_propagation->initialize(phg);
+        improvement_found |= label_propagation->refine(phg,
+          refinement_nodes, current_metrics, std::numeric_limits<double>::max());
+        timer.stop_timer("label_propagation");
+      }
+
+      if ( context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+        timer.start_timer("fm", "FM");
+        fm->initialize(phg);
+        improvement_found |= fm->refine(phg,
+          refinement_nodes, current_metrics, std::numeric_limits<double>::max());
+        timer.stop_timer("fm");
+      }
+
+      if ( !context.refinement.refine_until_no_improvement ) {
+        break;
+      }
+    }
+
+    // The changes of the hypergraph (e.g., new nodes or weight changes)
+    // can violate the balance constraint
+    if ( !metrics::isBalanced(partitioned_hg, context) &&
+         context.refinement.rebalancer != RebalancingAlgorithm::do_nothing ) {
+      timer.start_timer("rebalance", "Rebalance");
+      rebalancer->initialize(phg);
+      rebalancer->refine(phg, {}, current_metrics, 0.0);
+      timer.stop_timer("rebalance");
+    }
+    fm.reset();
+    label_propagation.reset();
+    rebalancer.reset();
+    GainCachePtr::deleteGainCache(gain_cache);
+    timer.stop_timer("refinement");
+
+    forceFixedVertexAssignment(partitioned_hg, context);
+    io::printPartitioningResults(partitioned_hg, context, "Local Search Results:");
+  }
+
   INSTANTIATE_CLASS_WITH_TYPE_TRAITS(Partitioner)
 }
@@ -48,6 +48,13 @@ class Partitioner {
   static void partitionVCycle(PartitionedHypergraph& partitioned_hg,
                               Context& context,
                               TargetGraph* target_graph = nullptr);
+
+  // ! Improves the partition with label propagation and FM searches that
+  // ! start only from the given nodes (and rebalances it if necessary)
+  static void refineLocally(PartitionedHypergraph& partitioned_hg,
+                            const vec<HypernodeID>& refinement_nodes,
+                            Context& context,
+                            TargetGraph* target_graph = nullptr);
 };
 
 }  // namespace mt_kahypar
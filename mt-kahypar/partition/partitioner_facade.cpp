@@ -29,6 +29,7 @@
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/partition/incremental_update.h"
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/io/csv_output.h"
@@ -70,6 +71,20 @@ namespace internal {
     Partitioner<TypeTraits>::partitionVCycle(phg, context, target_graph);
   }
 
+  template<typename TypeTraits>
+  void updatePartition(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                       const HypergraphDelta& delta,
+                       Context& context,
+                       TargetGraph* target_graph) {
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    PartitionedHypergraph& phg = utils::cast<PartitionedHypergraph>(partitioned_hg);
+
+    // Apply delta and refine around the changed region
+    const vec<HypernodeID> refinement_nodes =
+      IncrementalUpdate<TypeTraits>::applyDelta(phg, delta);
+    Partitioner<TypeTraits>::refineLocally(phg, refinement_nodes, context, target_graph);
+  }
+
   void check_if_feature_is_enabled(const mt_kahypar_partition_type_t type) {
     unused(type);
     #ifndef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -108,7 +123,8 @@ namespace internal {
                                                                    Context& context,
                                                                    TargetGraph* target_graph) {
     const mt_kahypar_partition_type_t type = to_partition_c_type(
-      context.partition.preset_type, context.partition.instance_type);
+      context.partition.preset_type, context.partition.instance_type,
+      context.partition.use_sparse_connectivity);
     internal::check_if_feature_is_enabled(type);
     switch ( type ) {
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -144,7 +160,8 @@ namespace internal {
                                   Context& context,
                                   TargetGraph* target_graph) {
     const mt_kahypar_partition_type_t type = to_partition_c_type(
-      context.partition.preset_type, context.partition.instance_type);
+      context.partition.preset_type, context.partition.instance_type,
+      context.partition.use_sparse_connectivity);
     internal::check_if_feature_is_enabled(type);
     switch ( type ) {
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -173,6 +190,41 @@ namespace internal {
     }
   }
 
+  void PartitionerFacade::updatePartition(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                          const HypergraphDelta& delta,
+                                          Context& context,
+                                          TargetGraph* target_graph) {
+    const mt_kahypar_partition_type_t type = to_partition_c_type(
+      context.partition.preset_type, context.partition.instance_type,
+      context.partition.use_sparse_connectivity);
+    internal::check_if_feature_is_enabled(type);
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        internal::updatePartition<StaticGraphTypeTraits>(partitioned_hg, delta, context, target_graph); break;
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        internal::updatePartition<StaticHypergraphTypeTraits>(partitioned_hg, delta, context, target_graph); break;
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        internal::updatePartition<LargeKHypergraphTypeTraits>(partitioned_hg, delta, context, target_graph); break;
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        internal::updatePartition<DynamicGraphTypeTraits>(partitioned_hg, delta, context, target_graph); break;
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        internal::updatePartition<DynamicHypergraphTypeTraits>(partitioned_hg, delta, context, target_graph); break;
+      #endif
+      #ifdef KAHYPAR_ENABLE_CLUSTERING_FEATURES
+       case MULTILEVEL_HYPERGRAPH_CLUSTERING:
+         internal::updatePartition<StaticHypergraphTypeTraits>(partitioned_hg, delta, context, target_graph); break;
+       #endif
+      default: break;
+    }
+  }
+
   void PartitionerFacade::printPartitioningResults(const mt_kahypar_partitioned_hypergraph_t phg,
                                                    const Context& context,
                                                    const std::chrono::duration<double>& elapsed_seconds) {
@@ -35,6 +35,7 @@ namespace mt_kahypar {
 
 // Forward Declaration
 class TargetGraph;
+struct HypergraphDelta;
 
 class PartitionerFacade {
  public:
@@ -48,6 +49,13 @@ class PartitionerFacade {
                       Context& context,
                       TargetGraph* target_graph = nullptr);
 
+  // ! Applies the delta to the partitioned hypergraph and its underlying
+  // ! hypergraph and refines the partition around the changed region
+  static void updatePartition(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                              const HypergraphDelta& delta,
+                              Context& context,
+                              TargetGraph* target_graph = nullptr);
+
   // ! Prints timings and metrics to output
   static void printPartitioningResults(const mt_kahypar_partitioned_hypergraph_t phg,
                                        const Context& context,
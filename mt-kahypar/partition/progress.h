@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "include/mtkahypartypes.h"
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Reports the progress of the current partitioning call to the progress callback of
+ * the context (see PartitioningParameters::progress_callback). Progress is only reported
+ * for main contexts and until the callback requests cancellation of the partitioning call.
+ */
+
+inline bool has_progress_callback(const Context& context) {
+  return context.partition.progress_callback &&
+    context.type == ContextType::main && !context.isCancelled();
+}
+
+inline void report_progress(const Context& context, mt_kahypar_progress_t progress) {
+  if ( !has_progress_callback(context) ) {
+    return;
+  }
+  progress.elapsed_seconds = context.elapsedTime();
+  if ( context.partition.progress_callback(progress) ) {
+    context.cancel();
+  }
+}
+
+template<typename PartitionedHypergraph>
+void report_progress(const PartitionedHypergraph& partitioned_hg,
+                     const Context& context,
+                     const mt_kahypar_progress_phase_t phase,
+                     const size_t level,
+                     const HypernodeID num_nodes,
+                     const HyperedgeWeight objective) {
+  if ( !has_progress_callback(context) ) {
+    return;
+  }
+  mt_kahypar_progress_t progress { };
+  progress.phase = phase;
+  progress.level = level;
+  progress.num_nodes = num_nodes;
+  progress.objective = objective;
+  progress.imbalance = metrics::imbalance(partitioned_hg, context);
+  if ( !PartitionedHypergraph::is_graph && partitioned_hg.hasConductancePriorityQueue() &&
+       ( context.partition.objective == Objective::conductance_local ||
+         context.partition.objective == Objective::conductance_global ) ) {
+    progress.conductance = metrics::compute_double_conductance(partitioned_hg);
+  }
+  report_progress(context, progress);
+}
+
+}  // namespace mt_kahypar
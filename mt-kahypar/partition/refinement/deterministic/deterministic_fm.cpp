@@ -0,0 +1,382 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/refinement/deterministic/deterministic_fm.h"
+
+#include <algorithm>
+
+#include <tbb/parallel_sort.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/refinement/fm/stop_rule.h"
+#include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
+#include "mt-kahypar/parallel/chunking.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/timer.h"
+#include "mt-kahypar/utils/utilities.h"
+
+namespace mt_kahypar {
+
+  template<typename GraphAndGainTypes>
+  DeterministicFMRefiner<GraphAndGainTypes>::DeterministicFMRefiner(const HypernodeID num_hypernodes,
+                                                                    const HyperedgeID num_hyperedges,
+                                                                    const Context& c,
+                                                                    GainCache& gainCache) :
+    context(c),
+    gain_cache(gainCache),
+    current_k(c.partition.k),
+    prng(c.partition.seed),
+    sharedData(num_hypernodes),
+    globalRollback(num_hyperedges, context, gainCache),
+    ets_search_data([&] { return LocalSearchData(context, gain_cache); }),
+    border_nodes(num_hypernodes),
+    permutation(),
+    search_moves(),
+    owner_of_node(num_hypernodes, CAtomic<SearchID>(kInvalidSearch)),
+    accepted_moves_prefix_sum() { }
+
+  template<typename GraphAndGainTypes>
+  bool DeterministicFMRefiner<GraphAndGainTypes>::refineImpl(mt_kahypar_partitioned_hypergraph_t& hypergraph,
+                                                             const vec<HypernodeID>& refinement_nodes,
+                                                             Metrics& metrics,
+                                                             const double) {
+    PartitionedHypergraph& phg = utils::cast<PartitionedHypergraph>(hypergraph);
+    resizeDataStructuresForCurrentK();
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+
+    Gain overall_improvement = 0;
+    const size_t num_seeds = std::max(context.refinement.fm.num_seed_nodes, UL(1));
+    for (size_t round = 0; round < context.refinement.fm.multitry_rounds; ++round) {
+      timer.start_timer("collect_border_nodes", "Collect Border Nodes");
+      collectBorderNodes(phg, refinement_nodes);
+      timer.stop_timer("collect_border_nodes");
+
+      const size_t num_border_nodes = border_nodes.size();
+      if (num_border_nodes == 0) {
+        break;
+      }
+
+      // The number of searches and their seeds do not depend on the number of threads
+      const size_t num_searches = parallel::chunking::idiv_ceil(num_border_nodes, num_seeds);
+      const size_t num_sub_rounds = std::min(num_searches,
+        std::max(context.refinement.deterministic_refinement.num_sub_rounds_fm, UL(1)));
+      const size_t searches_per_sub_round = parallel::chunking::idiv_ceil(num_searches, num_sub_rounds);
+
+      Gain round_improvement = 0;
+      for (size_t sub_round = 0; sub_round < num_sub_rounds; ++sub_round) {
+        const auto [first_search, last_search] =
+          parallel::chunking::bounds(sub_round, num_searches, searches_per_sub_round);
+        if (first_search < last_search) {
+          round_improvement += performSubRound(phg, first_search, last_search);
+        }
+      }
+      overall_improvement += round_improvement;
+
+      const double improvement_fraction = metrics.quality - overall_improvement + round_improvement == 0 ? 0.0 :
+        static_cast<double>(round_improvement) / (metrics.quality - overall_improvement + round_improvement);
+      DBG << V(round) << V(round_improvement) << V(num_border_nodes)
+          << V(num_searches) << V(improvement_fraction);
+      if (round_improvement <= 0 || improvement_fraction < context.refinement.fm.min_improvement) {
+        break;
+      }
+    }
+
+    metrics.quality -= overall_improvement;
+    metrics.imbalance = metrics::imbalance(phg, context);
+    HEAVY_REFINEMENT_ASSERT(phg.checkTrackedPartitionInformation(gain_cache));
+    ASSERT(metrics.quality == metrics::quality(phg, context),
+           V(metrics.quality) << V(metrics::quality(phg, context)));
+    return overall_improvement > 0;
+  }
+
+  template<typename GraphAndGainTypes>
+  void DeterministicFMRefiner<GraphAndGainTypes>::collectBorderNodes(const PartitionedHypergraph& phg,
+                                                                     const vec<HypernodeID>& refinement_nodes) {
+    border_nodes.clear();
+    auto insert_if_border_node = [&](const HypernodeID u) {
+      if (phg.nodeIsEnabled(u) && phg.isBorderNode(u) && !phg.isFixed(u)) {
+        border_nodes.push_back_buffered(u);
+      }
+    };
+    if ( refinement_nodes.empty() ) {
+      tbb::parallel_for(ID(0), phg.initialNumNodes(), insert_if_border_node);
+    } else {
+      tbb::parallel_for(UL(0), refinement_nodes.size(), [&](const size_t i) {
+        insert_if_border_node(refinement_nodes[i]);
+      });
+    }
+    border_nodes.finalize();
+
+    // The order of the buffered insertions depends on the scheduling of the threads.
+    // Sorting restores a deterministic order before the seeded shuffle.
+    tbb::parallel_sort(border_nodes.begin(), border_nodes.end());
+    permutation.sample_buckets_and_group_by(border_nodes.range(),
+      context.shared_memory.static_balancing_work_packages, prng());
+  }
+
+  template<typename GraphAndGainTypes>
+  Gain DeterministicFMRefiner<GraphAndGainTypes>::performSubRound(PartitionedHypergraph& phg,
+                                                                  const size_t first_search,
+                                                                  const size_t last_search) {
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    const size_t num_searches = last_search - first_search;
+    const size_t num_seeds = std::max(context.refinement.fm.num_seed_nodes, UL(1));
+    const size_t num_border_nodes = border_nodes.size();
+    if (search_moves.size() < num_searches) {
+      search_moves.resize(num_searches);
+    }
+
+    vec<HypernodeWeight> initial_part_weights(context.partition.k);
+    for (PartitionID i = 0; i < context.partition.k; ++i) {
+      initial_part_weights[i] = phg.partWeight(i);
+    }
+
+    // Run all localized searches of the sub-round on private delta partitions
+    timer.start_timer("find_moves", "Find Moves");
+    tbb::parallel_for(UL(0), num_searches, [&](const size_t i) {
+      const size_t search = first_search + i;
+      const size_t first_seed = search * num_seeds;
+      const size_t last_seed = std::min(first_seed + num_seeds, num_border_nodes);
+      localSearch(phg, ets_search_data.local(), first_seed, last_seed, search_moves[i]);
+    });
+    timer.stop_timer("find_moves");
+
+    // Assign each moved vertex to the search with the smallest ID that moved it
+    timer.start_timer("apply_moves", "Apply Moves");
+    tbb::parallel_for(UL(0), num_searches, [&](const size_t i) {
+      for (const Move& m : search_moves[i]) {
+        SearchID current = owner_of_node[m.node].load(std::memory_order_relaxed);
+        while (i < current && !owner_of_node[m.node].compare_exchange_weak(
+                 current, static_cast<SearchID>(i), std::memory_order_relaxed)) { }
+      }
+    });
+
+    // Compute the position of each accepted move in the global move sequence
+    accepted_moves_prefix_sum.assign(num_searches + 1, 0);
+    tbb::parallel_for(UL(0), num_searches, [&](const size_t i) {
+      size_t num_accepted_moves = 0;
+      for (const Move& m : search_moves[i]) {
+        num_accepted_moves += owner_of_node[m.node].load(std::memory_order_relaxed) == i;
+      }
+      accepted_moves_prefix_sum[i + 1] = num_accepted_moves;
+    });
+    parallel::TBBPrefixSum<size_t> prefix_sum(accepted_moves_prefix_sum);
+    tbb::parallel_scan(tbb::blocked_range<size_t>(UL(0), accepted_moves_prefix_sum.size()), prefix_sum);
+    const MoveID num_moves = accepted_moves_prefix_sum.back();
+
+    // Apply accepted moves. The resulting partition does not depend on the order
+    // in which the moves are applied.
+    GlobalMoveTracker& move_tracker = sharedData.moveTracker;
+    tbb::parallel_for(UL(0), num_searches, [&](const size_t i) {
+      MoveID position = accepted_moves_prefix_sum[i];
+      for (const Move& m : search_moves[i]) {
+        if (owner_of_node[m.node].load(std::memory_order_relaxed) == i) {
+          phg.changeNodePart(gain_cache, m.node, m.from, m.to);
+          move_tracker.insertMoveAt(m, position++);
+        }
+      }
+    });
+    move_tracker.setNumPerformedMoves(num_moves);
+
+    tbb::parallel_for(UL(0), num_searches, [&](const size_t i) {
+      for (const Move& m : search_moves[i]) {
+        owner_of_node[m.node].store(kInvalidSearch, std::memory_order_relaxed);
+      }
+      search_moves[i].clear();
+    });
+    timer.stop_timer("apply_moves");
+
+    // The global rollback is deterministic for a fixed move sequence
+    timer.start_timer("rollback", "Rollback to Best Solution");
+    const HyperedgeWeight improvement = globalRollback.revertToBestPrefix(
+      phg, sharedData, initial_part_weights, context.partition.max_part_weights);
+    timer.stop_timer("rollback");
+    return improvement;
+  }
+
+  template<typename GraphAndGainTypes>
+  void DeterministicFMRefiner<GraphAndGainTypes>::localSearch(PartitionedHypergraph& phg,
+                                                              LocalSearchData& data,
+                                                              const size_t first_seed,
+                                                              const size_t last_seed,
+                                                              vec<Move>& best_prefix) {
+    data.delta_phg.clear();
+    data.delta_phg.setPartitionedHypergraph(&phg);
+    data.delta_gain_cache.clear();
+    data.pq.clear();
+    data.search_state.clear();
+    data.moves.clear();
+
+    for (size_t pos = first_seed; pos < last_seed; ++pos) {
+      insertIntoPQ(data, permutation.at(pos), 0);
+    }
+
+    StopRule stop_rule(phg.initialNumNodes());
+    Gain estimated_improvement = 0;
+    Gain best_improvement = 0;
+    size_t best_prefix_length = 0;
+    while (!data.pq.empty() && !stop_rule.searchShouldStop()) {
+      std::pop_heap(data.pq.begin(), data.pq.end());
+      const auto [estimated_gain, u] = data.pq.back();
+      data.pq.pop_back();
+      if (data.search_state[u] == kMovedNode) {
+        continue;
+      }
+
+      const auto [to, gain] = computeBestTargetBlock(data, u, false);
+      if (to == kInvalidPartition) {
+        continue;
+      } else if (gain < estimated_gain) {
+        // Gain of u decreased since its insertion => reinsert with current gain
+        data.pq.emplace_back(gain, u);
+        std::push_heap(data.pq.begin(), data.pq.end());
+        continue;
+      }
+
+      const bool expect_improvement = estimated_improvement + gain > best_improvement;
+      if (!expect_improvement && phg.nodeDegree(u) >= PartitionedHypergraph::HIGH_DEGREE_THRESHOLD) {
+        continue;
+      }
+
+      const PartitionID from = data.delta_phg.partID(u);
+      data.edges_with_gain_changes.clear();
+      const bool moved = data.delta_phg.changeNodePart(u, from, to,
+        context.partition.max_part_weights[to], [&](const SynchronizedEdgeUpdate& sync_update) {
+          if (!PartitionedHypergraph::is_graph && GainCache::triggersDeltaGainUpdate(sync_update)) {
+            data.edges_with_gain_changes.push_back(sync_update.he);
+          }
+          data.delta_gain_cache.deltaGainUpdate(data.delta_phg, sync_update);
+        });
+      if (!moved) {
+        continue;
+      }
+
+      data.search_state[u] = kMovedNode;
+      data.moves.push_back(Move { from, to, u, gain });
+      estimated_improvement += gain;
+      stop_rule.update(gain);
+      if (estimated_improvement > best_improvement) {
+        best_improvement = estimated_improvement;
+        best_prefix_length = data.moves.size();
+        stop_rule.reset();
+      }
+
+      // Insert or update neighbors of u
+      const uint32_t step = data.moves.size();
+      if constexpr (PartitionedHypergraph::is_graph) {
+        for (const HyperedgeID& e : phg.incidentEdges(u)) {
+          const HypernodeID v = phg.edgeTarget(e);
+          if (!phg.isFixed(v)) {
+            insertIntoPQ(data, v, step);
+          }
+        }
+      } else {
+        for (const HyperedgeID& e : data.edges_with_gain_changes) {
+          if (phg.edgeSize(e) < context.partition.ignore_hyperedge_size_threshold) {
+            for (const HypernodeID& v : phg.pins(e)) {
+              if (!phg.isFixed(v)) {
+                insertIntoPQ(data, v, step);
+              }
+            }
+          }
+        }
+      }
+    }
+
+    best_prefix.assign(data.moves.begin(), data.moves.begin() + best_prefix_length);
+  }
+
+  template<typename GraphAndGainTypes>
+  void DeterministicFMRefiner<GraphAndGainTypes>::insertIntoPQ(LocalSearchData& data,
+                                                               const HypernodeID u,
+                                                               const uint32_t step) {
+    const uint32_t* state = data.search_state.get_if_contained(u);
+    if (state == nullptr || (*state != kMovedNode && *state != step)) {
+      data.search_state[u] = step;
+      const auto [to, gain] = computeBestTargetBlock(data, u, true);
+      if (to != kInvalidPartition) {
+        data.pq.emplace_back(gain, u);
+        std::push_heap(data.pq.begin(), data.pq.end());
+      }
+    }
+  }
+
+  template<typename GraphAndGainTypes>
+  std::pair<PartitionID, Gain> DeterministicFMRefiner<GraphAndGainTypes>::computeBestTargetBlock(
+          const LocalSearchData& data,
+          const HypernodeID u,
+          const bool ignore_balance) const {
+    const DeltaPartitionedHypergraph& phg = data.delta_phg;
+    const PartitionID from = phg.partID(u);
+    const HypernodeWeight wu = phg.nodeWeight(u);
+    PartitionID to = kInvalidPartition;
+    HyperedgeWeight to_benefit = std::numeric_limits<HyperedgeWeight>::min();
+    HypernodeWeight best_to_weight = phg.partWeight(from) - wu;
+    for (const PartitionID& i : data.delta_gain_cache.adjacentBlocks(u)) {
+      if (i != from) {
+        const HypernodeWeight to_weight = phg.partWeight(i);
+        const HyperedgeWeight benefit = data.delta_gain_cache.benefitTerm(u, i);
+        if ( ( benefit > to_benefit || ( benefit == to_benefit && to_weight < best_to_weight ) ) &&
+             ( ignore_balance || to_weight + wu <= context.partition.max_part_weights[i] ) ) {
+          to_benefit = benefit;
+          to = i;
+          best_to_weight = to_weight;
+        }
+      }
+    }
+    const Gain gain = to != kInvalidPartition ? to_benefit - data.delta_gain_cache.penaltyTerm(u, from)
+                                              : std::numeric_limits<Gain>::min();
+    return std::make_pair(to, gain);
+  }
+
+  template<typename GraphAndGainTypes>
+  void DeterministicFMRefiner<GraphAndGainTypes>::initializeImpl(mt_kahypar_partitioned_hypergraph_t& hypergraph) {
+    PartitionedHypergraph& phg = utils::cast<PartitionedHypergraph>(hypergraph);
+    if (!gain_cache.isInitialized()) {
+      gain_cache.initializeGainCache(phg);
+    }
+  }
+
+  template<typename GraphAndGainTypes>
+  void DeterministicFMRefiner<GraphAndGainTypes>::resizeDataStructuresForCurrentK() {
+    // If the number of blocks changes, we resize data structures
+    // (can happen during deep multilevel partitioning)
+    if ( current_k != context.partition.k ) {
+      current_k = context.partition.k;
+      globalRollback.changeNumberOfBlocks(current_k);
+      for ( auto& data : ets_search_data ) {
+        data.delta_phg.changeNumberOfBlocks(current_k);
+      }
+      gain_cache.changeNumberOfBlocks(current_k);
+    }
+  }
+
+  namespace {
+  #define DETERMINISTIC_FM_REFINER(X) DeterministicFMRefiner<X>
+  }
+
+  INSTANTIATE_CLASS_WITH_VALID_TRAITS(DETERMINISTIC_FM_REFINER)
+} // namespace mt_kahypar
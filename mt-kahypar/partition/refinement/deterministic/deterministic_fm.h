@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include "mt-kahypar/datastructures/buffered_vector.h"
+#include "mt-kahypar/datastructures/sparse_map.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/refinement/i_refiner.h"
+#include "mt-kahypar/partition/refinement/i_rebalancer.h"
+#include "mt-kahypar/partition/refinement/fm/fm_commons.h"
+#include "mt-kahypar/partition/refinement/fm/global_rollback.h"
+#include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
+#include "mt-kahypar/utils/reproducible_random.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Deterministic variant of the multitry k-way FM algorithm.
+ *
+ * Each round shuffles the border vertices with a seeded permutation and groups them
+ * into localized searches of num_seed_nodes seeds each. The searches are processed in
+ * synchronous sub-rounds. Within a sub-round, all searches run in parallel on a private
+ * delta partition of the same (unchanged) global partition. Afterwards, each moved vertex
+ * is assigned to the search with the smallest ID that moved it, the remaining moves are
+ * applied in search order and the global rollback reverts to the best balanced prefix of
+ * that move sequence. Since neither the searches nor the conflict resolution depend on
+ * the scheduling of the threads, the result only depends on the seed.
+ */
+template<typename GraphAndGainTypes>
+class DeterministicFMRefiner final : public IRefiner {
+
+  static constexpr bool debug = false;
+  static constexpr bool enable_heavy_assert = false;
+
+  using PartitionedHypergraph = typename GraphAndGainTypes::PartitionedHypergraph;
+  using GainCache = typename GraphAndGainTypes::GainCache;
+  using DeltaGainCache = typename GraphAndGainTypes::DeltaGainCache;
+  using DeltaPartitionedHypergraph = typename PartitionedHypergraph::template DeltaPartition<DeltaGainCache::requires_connectivity_set>;
+  using Rollback = GlobalRollback<GraphAndGainTypes>;
+  using SearchID = uint32_t;
+  using PQElement = std::pair<Gain, HypernodeID>;
+
+  static_assert(GainCache::TYPE != GainPolicy::none);
+
+  static constexpr size_t MAP_SIZE_MOVE_DELTA = 8192;
+  static constexpr SearchID kInvalidSearch = std::numeric_limits<SearchID>::max();
+  static constexpr uint32_t kMovedNode = std::numeric_limits<uint32_t>::max();
+
+  // ! Data of one localized search. Each thread owns one instance, which is cleared
+  // ! before each search such that the search does not depend on the executing thread.
+  struct LocalSearchData {
+    LocalSearchData(const Context& context, GainCache& gain_cache) :
+      delta_phg(context),
+      delta_gain_cache(gain_cache),
+      pq(),
+      search_state(),
+      moves(),
+      edges_with_gain_changes() {
+      delta_gain_cache.initialize(MAP_SIZE_MOVE_DELTA);
+    }
+
+    DeltaPartitionedHypergraph delta_phg;
+    DeltaGainCache delta_gain_cache;
+    // ! Max-heap of (gain, node) pairs. Entries are updated lazily.
+    vec<PQElement> pq;
+    // ! Stores for each vertex touched by the search the last step in which its
+    // ! gain was updated or kMovedNode, if the vertex was already moved
+    ds::DynamicSparseMap<HypernodeID, uint32_t> search_state;
+    vec<Move> moves;
+    vec<HyperedgeID> edges_with_gain_changes;
+  };
+
+ public:
+  DeterministicFMRefiner(const HypernodeID num_hypernodes,
+                         const HyperedgeID num_hyperedges,
+                         const Context& context,
+                         GainCache& gain_cache);
+
+  DeterministicFMRefiner(const HypernodeID num_hypernodes,
+                         const HyperedgeID num_hyperedges,
+                         const Context& context,
+                         gain_cache_t gain_cache,
+                         IRebalancer& /* only relevant for other refiners */) :
+    DeterministicFMRefiner(num_hypernodes, num_hyperedges, context,
+      GainCachePtr::cast<GainCache>(gain_cache)) { }
+
+ private:
+  bool refineImpl(mt_kahypar_partitioned_hypergraph_t& phg,
+                  const vec<HypernodeID>& refinement_nodes,
+                  Metrics& metrics,
+                  double time_limit) final ;
+
+  void initializeImpl(mt_kahypar_partitioned_hypergraph_t& phg) final ;
+
+  void collectBorderNodes(const PartitionedHypergraph& phg,
+                          const vec<HypernodeID>& refinement_nodes);
+
+  // ! Runs all searches of a sub-round, resolves conflicts between them and
+  // ! reverts to the best prefix. Returns the improvement of the sub-round.
+  Gain performSubRound(PartitionedHypergraph& phg,
+                       const size_t first_search,
+                       const size_t last_search);
+
+  void localSearch(PartitionedHypergraph& phg,
+                   LocalSearchData& data,
+                   const size_t first_seed,
+                   const size_t last_seed,
+                   vec<Move>& best_prefix);
+
+  void insertIntoPQ(LocalSearchData& data, const HypernodeID u, const uint32_t step);
+
+  std::pair<PartitionID, Gain> computeBestTargetBlock(const LocalSearchData& data,
+                                                      const HypernodeID u,
+                                                      const bool ignore_balance) const;
+
+  void resizeDataStructuresForCurrentK();
+
+  const Context& context;
+  GainCache& gain_cache;
+  PartitionID current_k;
+  std::mt19937 prng;
+  FMSharedData sharedData;
+  Rollback globalRollback;
+  tbb::enumerable_thread_specific<LocalSearchData> ets_search_data;
+  ds::BufferedVector<HypernodeID> border_nodes;
+  utils::ParallelPermutation<HypernodeID> permutation;
+  vec<vec<Move>> search_moves;
+  vec<CAtomic<SearchID>> owner_of_node;
+  vec<size_t> accepted_moves_prefix_sum;
+};
+
+}  // namespace mt_kahypar
@@ -59,7 +59,7 @@ MoveSequence FlowRefiner<GraphAndGainTypes>::refineImpl(mt_kahypar_partitioned_h
 
       HyperedgeWeight new_cut = flow_problem.non_removable_cut;
       HypernodeWeight max_part_weight;
-      const bool sequential = _context.shared_memory.num_threads == _context.refinement.flows.num_parallel_searches;
+      const bool sequential = useSequentialFlowAlgorithm();
       if (sequential) {
         new_cut += _sequential_hfc.cs.flow_algo.flow_value;
         max_part_weight = std::max(_sequential_hfc.cs.source_weight, _sequential_hfc.cs.target_weight);
@@ -123,8 +123,15 @@ bool FlowRefiner<GraphAndGainTypes>::runFlowCutter(const FlowProblem& flow_probl
   };
 
 
-  const bool sequential = _context.shared_memory.num_threads == _context.refinement.flows.num_parallel_searches;
+  const bool sequential = useSequentialFlowAlgorithm();
   if (sequential) {
+    if ( _context.partition.deterministic ) {
+      // A refiner instance processes a different sequence of block pairs in each
+      // run. Thus, we reseed the flow cutter for each block pair such that piercing
+      // decisions only depend on the flow problem.
+      _sequential_hfc.setSeed(_context.partition.seed +
+        _block_0 * _context.partition.k + _block_1);
+    }
     _sequential_hfc.cs.setMaxBlockWeight(0, std::max(
             flow_problem.weight_of_block_0, _context.partition.max_part_weights[_block_0]));
     _sequential_hfc.cs.setMaxBlockWeight(1, std::max(
@@ -155,7 +162,7 @@ FlowProblem FlowRefiner<GraphAndGainTypes>::constructFlowHypergraph(const Partit
   FlowProblem flow_problem;
 
 
-  const bool sequential = _context.shared_memory.num_threads == _context.refinement.flows.num_parallel_searches;
+  const bool sequential = useSequentialFlowAlgorithm();
   if ( sequential ) {
     flow_problem = _sequential_construction.constructFlowHypergraph(
       phg, sub_hg, _block_0, _block_1, _whfc_to_node);
@@ -108,6 +108,13 @@ class FlowRefiner final : public IFlowRefiner {
   FlowProblem constructFlowHypergraph(const PartitionedHypergraph& phg,
                                       const Subhypergraph& sub_hg);
 
+  // ! In deterministic mode, we always use the sequential flow algorithm as
+  // ! the number of threads assigned to a search depends on the thread schedule
+  bool useSequentialFlowAlgorithm() const {
+    return _context.partition.deterministic ||
+      _context.shared_memory.num_threads == _context.refinement.flows.num_parallel_searches;
+  }
+
   PartitionID maxNumberOfBlocksPerSearchImpl() const override {
     return 2;
   }
@@ -27,12 +27,15 @@
 
 #include "mt-kahypar/partition/refinement/flows/problem_construction.h"
 
+#include <algorithm>
+#include <chrono>
 #include <unordered_map>
 
 #include <tbb/parallel_for.h>
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/utils/tracer.h"
 
 namespace mt_kahypar {
 
@@ -97,25 +100,97 @@ void ProblemConstruction<TypeTraits>::BFSData::add_pins_of_hyperedge_to_queue(
 
 namespace {
   using assert_map = std::unordered_map<HyperedgeID, bool>;
+
+  // ! Checks if exactly the hyperedges incident to the nodes
+  // ! of the subhypergraph are contained in it
+  template<typename PartitionedHypergraph>
+  bool isSubhypergraphConsistent(const Subhypergraph& sub_hg,
+                                 const PartitionedHypergraph& phg) {
+    assert_map expected_hes;
+    for ( const HyperedgeID& he : sub_hg.hes ) {
+      const HyperedgeID id = phg.uniqueEdgeID(he);
+      if ( expected_hes.count(id) > 0 ) {
+        LOG << "Hyperedge" << he << "is contained multiple times in subhypergraph!";
+        return false;
+      }
+      expected_hes[id] = true;
+    }
+
+    for ( const HypernodeID& hn : sub_hg.nodes_of_block_0 ) {
+      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+        const HyperedgeID id = phg.uniqueEdgeID(he);
+        if ( expected_hes.count(id) == 0 ) {
+          LOG << "Hyperedge" << he << "not contained in subhypergraph!";
+          return false;
+        }
+        expected_hes[id] = false;
+      }
+    }
+
+    for ( const HypernodeID& hn : sub_hg.nodes_of_block_1 ) {
+      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+        const HyperedgeID id = phg.uniqueEdgeID(he);
+        if ( expected_hes.count(id) == 0 ) {
+          LOG << "Hyperedge" << he << "not contained in subhypergraph!";
+          return false;
+        }
+        expected_hes[id] = false;
+      }
+    }
+
+    for ( const auto& entry : expected_hes ) {
+      const HyperedgeID he = entry.first;
+      const bool visited = !entry.second;
+      if ( !visited ) {
+        LOG << "HyperedgeID" << he << "should be not part of subhypergraph!";
+        return false;
+      }
+    }
+    return true;
+  }
 }
 
 template<typename TypeTraits>
 Subhypergraph ProblemConstruction<TypeTraits>::construct(const SearchID search_id,
                                                          QuotientGraph<TypeTraits>& quotient_graph,
                                                          const PartitionedHypergraph& phg) {
+  utils::TraceScope trace(utils::TraceEvent::flow_region_growing);
   Subhypergraph sub_hg;
+  const BlockPair blocks = quotient_graph.getBlockPair(search_id);
+  const HypernodeWeight max_weight_block_0 =
+    _scaling * _context.partition.perfect_balance_part_weights[blocks.j] - phg.partWeight(blocks.j);
+  const HypernodeWeight max_weight_block_1 =
+    _scaling * _context.partition.perfect_balance_part_weights[blocks.i] - phg.partWeight(blocks.i);
+
+  CachedRegion* cached = nullptr;
+  if ( _context.refinement.flows.cache_constructions ) {
+    cached = &_cache[cacheKey(blocks)];
+    if ( cached->is_valid ) {
+      HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+      if ( tryReuseCachedRegion(*cached, phg, max_weight_block_0, max_weight_block_1, sub_hg) ) {
+        HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+        const double reuse_time = std::chrono::duration<double>(end - start).count();
+        ++_num_cache_hits;
+        _saved_construction_time_us += static_cast<int64_t>(
+          std::max(0.0, cached->construction_time - reuse_time) * 1000000.0);
+        DBG << "Search ID:" << search_id << "- Reused cached region" << sub_hg;
+        ASSERT(isSubhypergraphConsistent(sub_hg, phg), "Reusing cached subhypergraph failed!");
+        return sub_hg;
+      }
+      sub_hg = Subhypergraph();
+    }
+    ++_num_cache_misses;
+  }
+
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
   BFSData& bfs = _local_bfs.local();
   bfs.reset();
-  bfs.blocks = quotient_graph.getBlockPair(search_id);
+  bfs.blocks = blocks;
   sub_hg.block_0 = bfs.blocks.i;
   sub_hg.block_1 = bfs.blocks.j;
   sub_hg.weight_of_block_0 = 0;
   sub_hg.weight_of_block_1 = 0;
   sub_hg.num_pins = 0;
-  const HypernodeWeight max_weight_block_0 =
-    _scaling * _context.partition.perfect_balance_part_weights[sub_hg.block_1] - phg.partWeight(sub_hg.block_1);
-  const HypernodeWeight max_weight_block_1 =
-    _scaling * _context.partition.perfect_balance_part_weights[sub_hg.block_0] - phg.partWeight(sub_hg.block_0);
   const size_t max_bfs_distance = _context.refinement.flows.max_bfs_distance;
 
 
@@ -169,51 +244,109 @@ Subhypergraph ProblemConstruction<TypeTraits>::construct(const SearchID search_i
   DBG << "Search ID:" << search_id << "-" << sub_hg;
 
   // Check if all touched hyperedges are contained in subhypergraph
-  ASSERT([&]() {
-    assert_map expected_hes;
-    for ( const HyperedgeID& he : sub_hg.hes ) {
-      const HyperedgeID id = phg.uniqueEdgeID(he);
-      if ( expected_hes.count(id) > 0 ) {
-        LOG << "Hyperedge" << he << "is contained multiple times in subhypergraph!";
-        return false;
-      }
-      expected_hes[id] = true;
-    }
+  ASSERT(isSubhypergraphConsistent(sub_hg, phg), "Subhypergraph construction failed!");
 
-    for ( const HypernodeID& hn : sub_hg.nodes_of_block_0 ) {
-      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
-        const HyperedgeID id = phg.uniqueEdgeID(he);
-        if ( expected_hes.count(id) == 0 ) {
-          LOG << "Hyperedge" << he << "not contained in subhypergraph!";
-          return false;
-        }
-        expected_hes[id] = false;
-      }
+  if ( cached ) {
+    HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    cached->sub_hg = sub_hg;
+    cached->max_weight_block_0 = max_weight_block_0;
+    cached->max_weight_block_1 = max_weight_block_1;
+    cached->construction_time = std::chrono::duration<double>(end - start).count();
+    cached->is_valid = true;
+  }
+
+  return sub_hg;
+}
+
+template<typename TypeTraits>
+bool ProblemConstruction<TypeTraits>::tryReuseCachedRegion(const CachedRegion& cached,
+                                                           const PartitionedHypergraph& phg,
+                                                           const HypernodeWeight max_weight_block_0,
+                                                           const HypernodeWeight max_weight_block_1,
+                                                           Subhypergraph& sub_hg) const {
+  const Subhypergraph& cached_hg = cached.sub_hg;
+  sub_hg.block_0 = cached_hg.block_0;
+  sub_hg.block_1 = cached_hg.block_1;
+  sub_hg.weight_of_block_0 = 0;
+  sub_hg.weight_of_block_1 = 0;
+  sub_hg.num_pins = 0;
+
+  // Nodes that moved between the two blocks switch sides, nodes that
+  // left both blocks are removed from the region
+  size_t num_changed_nodes = 0;
+  size_t num_removed_nodes = 0;
+  auto patch_node = [&](const HypernodeID hn, const PartitionID cached_block) {
+    const PartitionID block = phg.partID(hn);
+    if ( block == sub_hg.block_0 ) {
+      sub_hg.nodes_of_block_0.push_back(hn);
+      sub_hg.weight_of_block_0 += phg.nodeWeight(hn);
+      sub_hg.num_pins += phg.nodeDegree(hn);
+    } else if ( block == sub_hg.block_1 ) {
+      sub_hg.nodes_of_block_1.push_back(hn);
+      sub_hg.weight_of_block_1 += phg.nodeWeight(hn);
+      sub_hg.num_pins += phg.nodeDegree(hn);
+    } else {
+      ++num_removed_nodes;
     }
+    num_changed_nodes += block != cached_block;
+  };
+  for ( const HypernodeID& hn : cached_hg.nodes_of_block_0 ) {
+    patch_node(hn, cached_hg.block_0);
+  }
+  for ( const HypernodeID& hn : cached_hg.nodes_of_block_1 ) {
+    patch_node(hn, cached_hg.block_1);
+  }
 
-    for ( const HypernodeID& hn : sub_hg.nodes_of_block_1 ) {
-      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
-        const HyperedgeID id = phg.uniqueEdgeID(he);
-        if ( expected_hes.count(id) == 0 ) {
-          LOG << "Hyperedge" << he << "not contained in subhypergraph!";
-          return false;
+  // The region must still contain both sides of the cut and must not exceed
+  // the size constraints by more than the region grown originally
+  const HypernodeWeight overshoot_block_0 =
+    std::max(0, cached_hg.weight_of_block_0 - cached.max_weight_block_0);
+  const HypernodeWeight overshoot_block_1 =
+    std::max(0, cached_hg.weight_of_block_1 - cached.max_weight_block_1);
+  if ( num_changed_nodes > _context.refinement.flows.max_changed_cached_region_fraction * cached_hg.numNodes() ||
+       sub_hg.nodes_of_block_0.empty() || sub_hg.nodes_of_block_1.empty() ||
+       sub_hg.weight_of_block_0 - max_weight_block_0 > overshoot_block_0 ||
+       sub_hg.weight_of_block_1 - max_weight_block_1 > overshoot_block_1 ) {
+    return false;
+  }
+
+  if ( num_removed_nodes == 0 ) {
+    sub_hg.hes = cached_hg.hes;
+  } else {
+    // Some nodes left the region => collect the remaining incident hyperedges
+    auto add_incident_edges = [&](const vec<HypernodeID>& nodes) {
+      for ( const HypernodeID& hn : nodes ) {
+        for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+          sub_hg.hes.push_back(he);
         }
-        expected_hes[id] = false;
       }
-    }
+    };
+    add_incident_edges(sub_hg.nodes_of_block_0);
+    add_incident_edges(sub_hg.nodes_of_block_1);
+    std::sort(sub_hg.hes.begin(), sub_hg.hes.end(),
+      [&](const HyperedgeID& lhs, const HyperedgeID& rhs) {
+        return phg.uniqueEdgeID(lhs) < phg.uniqueEdgeID(rhs);
+      });
+    sub_hg.hes.erase(std::unique(sub_hg.hes.begin(), sub_hg.hes.end(),
+      [&](const HyperedgeID& lhs, const HyperedgeID& rhs) {
+        return phg.uniqueEdgeID(lhs) == phg.uniqueEdgeID(rhs);
+      }), sub_hg.hes.end());
+  }
+  return true;
+}
 
-    for ( const auto& entry : expected_hes ) {
-      const HyperedgeID he = entry.first;
-      const bool visited = !entry.second;
-      if ( !visited ) {
-        LOG << "HyperedgeID" << he << "should be not part of subhypergraph!";
-        return false;
-      }
-    }
-    return true;
-  }(), "Subhypergraph construction failed!");
+template<typename TypeTraits>
+void ProblemConstruction<TypeTraits>::resetCache() {
+  _cache.clear();
+}
 
-  return sub_hg;
+template<typename TypeTraits>
+typename ProblemConstruction<TypeTraits>::CacheStats ProblemConstruction<TypeTraits>::fetchAndResetCacheStats() {
+  CacheStats stats;
+  stats.num_hits = _num_cache_hits.exchange(0);
+  stats.num_misses = _num_cache_misses.exchange(0);
+  stats.saved_time = _saved_construction_time_us.exchange(0) / 1000000.0;
+  return stats;
 }
 
 template<typename TypeTraits>
@@ -224,6 +357,8 @@ void ProblemConstruction<TypeTraits>::changeNumberOfBlocks(const PartitionID new
       data.locked_blocks.assign(new_k, false);
     }
   }
+  // Cache keys depend on the number of blocks
+  resetCache();
 }
 
 template<typename TypeTraits>
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <tbb/enumerable_thread_specific.h>
+#include <tbb/concurrent_unordered_map.h>
 
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/datastructures/sparse_map.h"
@@ -104,7 +105,28 @@ class ProblemConstruction {
     bool lock_queue;
   };
 
+  /**
+   * Region grown for a block pair in a previous round. It is reused
+   * as long as only a small fraction of its nodes changed their block.
+   */
+  struct CachedRegion {
+    Subhypergraph sub_hg;
+    // ! Size constraints of both sides when the region was grown
+    HypernodeWeight max_weight_block_0 = 0;
+    HypernodeWeight max_weight_block_1 = 0;
+    // ! Time in seconds required to grow the region
+    double construction_time = 0.0;
+    bool is_valid = false;
+  };
+
  public:
+  struct CacheStats {
+    size_t num_hits = 0;
+    size_t num_misses = 0;
+    // ! Construction time in seconds saved by reusing cached regions
+    double saved_time = 0.0;
+  };
+
   explicit ProblemConstruction(const HypernodeID num_hypernodes,
                                const HyperedgeID num_hyperedges,
                                const Context& context) :
@@ -119,7 +141,11 @@ class ProblemConstruction {
         // blocks from the context
         return constructBFSData();
       }
-    ) { }
+    ),
+    _cache(),
+    _num_cache_hits(0),
+    _num_cache_misses(0),
+    _saved_construction_time_us(0) { }
 
   ProblemConstruction(const ProblemConstruction&) = delete;
   ProblemConstruction(ProblemConstruction&&) = delete;
@@ -133,6 +159,13 @@ class ProblemConstruction {
 
   void changeNumberOfBlocks(const PartitionID new_k);
 
+  // ! Invalidates all cached regions, e.g., if the partition was modified
+  // ! by another refiner or the hypergraph changed
+  void resetCache();
+
+  // ! Returns and resets the cache statistics collected since the last call
+  CacheStats fetchAndResetCacheStats();
+
  private:
   BFSData constructBFSData() const {
     return BFSData(_num_hypernodes, _num_hyperedges, _context.partition.k);
@@ -144,6 +177,16 @@ class ProblemConstruction {
     const HypernodeWeight max_weight_block_1,
     vec<bool>& locked_blocks) const;
 
+  bool tryReuseCachedRegion(const CachedRegion& cached,
+                            const PartitionedHypergraph& phg,
+                            const HypernodeWeight max_weight_block_0,
+                            const HypernodeWeight max_weight_block_1,
+                            Subhypergraph& sub_hg) const;
+
+  uint64_t cacheKey(const BlockPair& blocks) const {
+    return static_cast<uint64_t>(blocks.i) * _context.partition.k + blocks.j;
+  }
+
   const Context& _context;
   double _scaling;
   HypernodeID _num_hypernodes;
@@ -151,6 +194,14 @@ class ProblemConstruction {
 
   // ! Contains data required for BFS construction algorithm
   tbb::enumerable_thread_specific<BFSData> _local_bfs;
+
+  // ! Regions grown in previous rounds, keyed by block pair. A block pair
+  // ! is owned by exactly one search during region growing, so an entry is
+  // ! never accessed concurrently.
+  tbb::concurrent_unordered_map<uint64_t, CachedRegion> _cache;
+  CAtomic<int64_t> _num_cache_hits;
+  CAtomic<int64_t> _num_cache_misses;
+  CAtomic<int64_t> _saved_construction_time_us;
 };
 
 }  // namespace kahypar
@@ -28,7 +28,9 @@
 #include "mt-kahypar/partition/refinement/flows/quotient_graph.h"
 
 #include <queue>
+#include <tuple>
 
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
 
 #include "mt-kahypar/definitions.h"
@@ -58,8 +60,10 @@ template<typename TypeTraits>
 bool QuotientGraph<TypeTraits>::ActiveBlockSchedulingRound::popBlockPairFromQueue(BlockPair& blocks) {
   blocks.i = kInvalidPartition;
   blocks.j = kInvalidPartition;
-  if ( _unscheduled_blocks.try_pop(blocks) ) {
-    _quotient_graph[blocks.i][blocks.j].markAsNotInQueue();
+  PrioritizedBlockPair prioritized_blocks;
+  if ( _unscheduled_blocks.try_pop(prioritized_blocks) ) {
+    blocks = prioritized_blocks.blocks;
+    _quotient_graph.edge(blocks.i, blocks.j).markAsNotInQueue();
   }
   return blocks.i != kInvalidPartition && blocks.j != kInvalidPartition;
 }
@@ -83,9 +87,11 @@ void QuotientGraph<TypeTraits>::ActiveBlockSchedulingRound::finalizeSearch(const
 
 template<typename TypeTraits>
 bool QuotientGraph<TypeTraits>::ActiveBlockSchedulingRound::pushBlockPairIntoQueue(const BlockPair& blocks) {
-  QuotientGraphEdge& qg_edge = _quotient_graph[blocks.i][blocks.j];
+  QuotientGraphEdge& qg_edge = _quotient_graph.edge(blocks.i, blocks.j);
   if ( qg_edge.markAsInQueue() ) {
-    _unscheduled_blocks.push(blocks);
+    _unscheduled_blocks.push(PrioritizedBlockPair {
+      qg_edge.total_improvement.load(std::memory_order_relaxed),
+      qg_edge.cut_he_weight.load(std::memory_order_relaxed), blocks });
     ++_remaining_blocks;
     return true;
   } else {
@@ -99,39 +105,23 @@ void QuotientGraph<TypeTraits>::ActiveBlockScheduler::initialize(const vec<uint8
   reset();
   _is_input_hypergraph = is_input_hypergraph;
 
-  HyperedgeWeight best_total_improvement = 1;
-  for ( PartitionID i = 0; i < _context.partition.k; ++i ) {
-    for ( PartitionID j = i + 1; j < _context.partition.k; ++j ) {
-      best_total_improvement = std::max(best_total_improvement,
-        _quotient_graph[i][j].total_improvement.load(std::memory_order_relaxed));
-    }
-  }
-
+  // Only block pairs stored in the sparse quotient graph can be adjacent. The priority
+  // queue of the round orders them by total improvement and cut weight.
   vec<BlockPair> active_block_pairs;
-  for ( PartitionID i = 0; i < _context.partition.k; ++i ) {
-    for ( PartitionID j = i + 1; j < _context.partition.k; ++j ) {
-      if ( isActiveBlockPair(i, j) && ( active_blocks[i] || active_blocks[j] ) ) {
-        active_block_pairs.push_back( BlockPair { i, j } );
-      }
+  for ( size_t idx = 0; idx < _quotient_graph.numEdges(); ++idx ) {
+    const BlockPair& blocks = _quotient_graph.edgeAt(idx).blocks;
+    if ( isActiveBlockPair(blocks.i, blocks.j) && ( active_blocks[blocks.i] || active_blocks[blocks.j] ) ) {
+      active_block_pairs.push_back(blocks);
     }
   }
 
   if ( active_block_pairs.size() > 0 ) {
-    std::sort(active_block_pairs.begin(), active_block_pairs.end(),
-      [&](const BlockPair& lhs, const BlockPair& rhs) {
-        return _quotient_graph[lhs.i][lhs.j].total_improvement >
-          _quotient_graph[rhs.i][rhs.j].total_improvement ||
-          ( _quotient_graph[lhs.i][lhs.j].total_improvement ==
-            _quotient_graph[rhs.i][rhs.j].total_improvement &&
-            _quotient_graph[lhs.i][lhs.j].cut_he_weight >
-            _quotient_graph[rhs.i][rhs.j].cut_he_weight );
-      });
     _rounds.emplace_back(_context, _quotient_graph);
     ++_num_rounds;
     for ( const BlockPair& blocks : active_block_pairs ) {
       DBG << "Schedule blocks (" << blocks.i << "," << blocks.j << ") in round 1 ("
-          << "Total Improvement =" << _quotient_graph[blocks.i][blocks.j].total_improvement << ","
-          << "Cut Weight =" << _quotient_graph[blocks.i][blocks.j].cut_he_weight << ")";
+          << "Total Improvement =" << _quotient_graph.edge(blocks.i, blocks.j).total_improvement << ","
+          << "Cut Weight =" << _quotient_graph.edge(blocks.i, blocks.j).cut_he_weight << ")";
       _rounds.back().pushBlockPairIntoQueue(blocks);
     }
   }
@@ -174,41 +164,37 @@ void QuotientGraph<TypeTraits>::ActiveBlockScheduler::finalizeSearch(const Block
     block_0_becomes_active, block_1_becomes_active);
 
   if ( block_0_becomes_active ) {
-    // If blocks.i becomes active, we push all adjacent blocks into the queue of the next round
+    // If blocks.i becomes active, we push all adjacent block pairs into the queue of the next round
     ASSERT(round + 1 < _rounds.size());
-    for ( PartitionID other = 0; other < _context.partition.k; ++other ) {
-      if ( blocks.i != other ) {
-        const PartitionID block_0 = std::min(blocks.i, other);
-        const PartitionID block_1 = std::max(blocks.i, other);
-        if ( isActiveBlockPair(block_0, block_1) ) {
-          DBG << "Schedule blocks (" << block_0 << "," << block_1 << ") in round" << (round + 2) << " ("
-              << "Total Improvement =" << _quotient_graph[block_0][block_1].total_improvement << ","
-              << "Cut Weight =" << _quotient_graph[block_0][block_1].cut_he_weight << ")";
-          _rounds[round + 1].pushBlockPairIntoQueue(BlockPair { block_0, block_1 });
-        }
+    for ( const PartitionID other : _quotient_graph.adjacentBlocks(blocks.i) ) {
+      const PartitionID block_0 = std::min(blocks.i, other);
+      const PartitionID block_1 = std::max(blocks.i, other);
+      if ( isActiveBlockPair(block_0, block_1) ) {
+        DBG << "Schedule blocks (" << block_0 << "," << block_1 << ") in round" << (round + 2) << " ("
+            << "Total Improvement =" << _quotient_graph.edge(block_0, block_1).total_improvement << ","
+            << "Cut Weight =" << _quotient_graph.edge(block_0, block_1).cut_he_weight << ")";
+        _rounds[round + 1].pushBlockPairIntoQueue(BlockPair { block_0, block_1 });
       }
     }
   }
 
   if ( block_1_becomes_active ) {
-    // If blocks.j becomes active, we push all adjacent blocks into the queue of the next round
+    // If blocks.j becomes active, we push all adjacent block pairs into the queue of the next round
     ASSERT(round + 1 < _rounds.size());
-    for ( PartitionID other = 0; other < _context.partition.k; ++other ) {
-      if ( blocks.j != other ) {
-        const PartitionID block_0 = std::min(blocks.j, other);
-        const PartitionID block_1 = std::max(blocks.j, other);
-        if ( isActiveBlockPair(block_0, block_1) ) {
-          DBG << "Schedule blocks (" << block_0 << "," << block_1 << ") in round" << (round + 2) << " ("
-              << "Total Improvement =" << _quotient_graph[block_0][block_1].total_improvement << ","
-              << "Cut Weight =" << _quotient_graph[block_0][block_1].cut_he_weight << ")";
-          _rounds[round + 1].pushBlockPairIntoQueue(BlockPair { block_0, block_1 });
-        }
+    for ( const PartitionID other : _quotient_graph.adjacentBlocks(blocks.j) ) {
+      const PartitionID block_0 = std::min(blocks.j, other);
+      const PartitionID block_1 = std::max(blocks.j, other);
+      if ( isActiveBlockPair(block_0, block_1) ) {
+        DBG << "Schedule blocks (" << block_0 << "," << block_1 << ") in round" << (round + 2) << " ("
+            << "Total Improvement =" << _quotient_graph.edge(block_0, block_1).total_improvement << ","
+            << "Cut Weight =" << _quotient_graph.edge(block_0, block_1).cut_he_weight << ")";
+        _rounds[round + 1].pushBlockPairIntoQueue(BlockPair { block_0, block_1 });
       }
     }
   }
 
   // Special case
-  if ( improvement > 0 && !_quotient_graph[blocks.i][blocks.j].isInQueue() && isActiveBlockPair(blocks.i, blocks.j) &&
+  if ( improvement > 0 && !_quotient_graph.edge(blocks.i, blocks.j).isInQueue() && isActiveBlockPair(blocks.i, blocks.j) &&
        ( _rounds[round].isActive(blocks.i) || _rounds[round].isActive(blocks.j) ) ) {
         // The active block scheduling strategy works in multiple rounds and each contain a separate queue
         // to store active block pairs. A block pair is only allowed to be contained in one queue.
@@ -217,8 +203,8 @@ void QuotientGraph<TypeTraits>::ActiveBlockScheduler::finalizeSearch(const Block
         // a previous round, which are then not scheduled in the next round. If this edge is scheduled and
         // leads to an improvement, we schedule it in the next round here.
         DBG << "Schedule blocks (" << blocks.i << "," << blocks.j << ") in round" << (round + 2) << " ("
-            << "Total Improvement =" << _quotient_graph[blocks.i][blocks.j].total_improvement << ","
-            << "Cut Weight =" << _quotient_graph[blocks.i][blocks.j].cut_he_weight << ")";
+            << "Total Improvement =" << _quotient_graph.edge(blocks.i, blocks.j).total_improvement << ","
+            << "Cut Weight =" << _quotient_graph.edge(blocks.i, blocks.j).cut_he_weight << ")";
         _rounds[round + 1].pushBlockPairIntoQueue(BlockPair { blocks.i, blocks.j });
   }
 
@@ -243,14 +229,15 @@ void QuotientGraph<TypeTraits>::ActiveBlockScheduler::finalizeSearch(const Block
 template<typename TypeTraits>
 bool QuotientGraph<TypeTraits>::ActiveBlockScheduler::isActiveBlockPair(const PartitionID i,
                                                                         const PartitionID j) const {
+  const QuotientGraphEdge& qg_edge = _quotient_graph.edge(i, j);
   const bool skip_small_cuts = !_is_input_hypergraph &&
     _context.refinement.flows.skip_small_cuts;
   const bool contains_enough_cut_hes =
-    (skip_small_cuts && _quotient_graph[i][j].cut_he_weight > 10) ||
-    (!skip_small_cuts && _quotient_graph[i][j].cut_he_weight > 0);
+    (skip_small_cuts && qg_edge.cut_he_weight > 10) ||
+    (!skip_small_cuts && qg_edge.cut_he_weight > 0);
   const bool is_promising_blocks_pair =
     !_context.refinement.flows.skip_unpromising_blocks ||
-      ( _first_active_round == 0 || _quotient_graph[i][j].num_improvements_found > 0 );
+      ( _first_active_round == 0 || qg_edge.num_improvements_found > 0 );
   return contains_enough_cut_hes && is_promising_blocks_pair;
 }
 
@@ -264,11 +251,11 @@ SearchID QuotientGraph<TypeTraits>::requestNewSearch(FlowRefinerAdapter<TypeTrai
   _register_search_lock.lock();
 
   const SearchID tmp_search_id = _searches.size();
-  if ( success && _quotient_graph[blocks.i][blocks.j].acquire(tmp_search_id) ) {
+  if ( success && _quotient_graph.edge(blocks.i, blocks.j).acquire(tmp_search_id) ) {
     ++_num_active_searches;
     // Create new search
     search_id = tmp_search_id;
-    _searches.emplace_back(blocks, round);
+    _searches.emplace_back(blocks, round, true);
     _register_search_lock.unlock();
 
     // Associate refiner with search id
@@ -283,6 +270,51 @@ SearchID QuotientGraph<TypeTraits>::requestNewSearch(FlowRefinerAdapter<TypeTrai
   return search_id;
 }
 
+template<typename TypeTraits>
+SearchID QuotientGraph<TypeTraits>::requestNewSearch(const BlockPair& blocks,
+                                                     FlowRefinerAdapter<TypeTraits>& refiner) {
+  ASSERT(_phg);
+  ASSERT(blocks.i < blocks.j);
+  _register_search_lock.lock();
+  const SearchID search_id = _searches.size();
+  const bool success = _quotient_graph.edge(blocks.i, blocks.j).acquire(search_id);
+  ASSERT(success); unused(success);
+  ++_num_active_searches;
+  _searches.emplace_back(blocks, 0, false);
+  _register_search_lock.unlock();
+
+  const bool has_idle_refiner = refiner.registerNewSearch(search_id, *_phg);
+  ASSERT(has_idle_refiner); unused(has_idle_refiner);
+  return search_id;
+}
+
+template<typename TypeTraits>
+vec<BlockPair> QuotientGraph<TypeTraits>::activeBlockPairs(const vec<uint8_t>& active_blocks,
+                                                           const bool is_first_round) const {
+  const bool skip_small_cuts = !isInputHypergraph() &&
+    _context.refinement.flows.skip_small_cuts;
+  vec<BlockPair> block_pairs;
+  for ( size_t idx = 0; idx < _quotient_graph.numEdges(); ++idx ) {
+    const QuotientGraphEdge& qg_edge = _quotient_graph.edgeAt(idx);
+    const bool contains_enough_cut_hes = qg_edge.cut_he_weight > ( skip_small_cuts ? 10 : 0 );
+    const bool is_promising_block_pair = !_context.refinement.flows.skip_unpromising_blocks ||
+      is_first_round || qg_edge.num_improvements_found > 0;
+    if ( contains_enough_cut_hes && is_promising_block_pair &&
+         ( active_blocks[qg_edge.blocks.i] || active_blocks[qg_edge.blocks.j] ) ) {
+      block_pairs.push_back(qg_edge.blocks);
+    }
+  }
+
+  std::sort(block_pairs.begin(), block_pairs.end(),
+    [&](const BlockPair& lhs, const BlockPair& rhs) {
+      const QuotientGraphEdge& lhs_edge = *_quotient_graph.find(lhs.i, lhs.j);
+      const QuotientGraphEdge& rhs_edge = *_quotient_graph.find(rhs.i, rhs.j);
+      return std::make_tuple(-lhs_edge.total_improvement.load(), -lhs_edge.cut_he_weight.load(), lhs.i, lhs.j) <
+        std::make_tuple(-rhs_edge.total_improvement.load(), -rhs_edge.cut_he_weight.load(), rhs.i, rhs.j);
+    });
+  return block_pairs;
+}
+
 template<typename TypeTraits>
 void QuotientGraph<TypeTraits>::addNewCutHyperedge(const HyperedgeID he,
                                                    const PartitionID block) {
@@ -291,7 +323,7 @@ void QuotientGraph<TypeTraits>::addNewCutHyperedge(const HyperedgeID he,
   // Add hyperedge he as a cut hyperedge to each block pair that contains 'block'
   for ( const PartitionID& other_block : _phg->connectivitySet(he) ) {
     if ( other_block != block ) {
-      _quotient_graph[std::min(block, other_block)][std::max(block, other_block)]
+      _quotient_graph.edge(std::min(block, other_block), std::max(block, other_block))
         .add_hyperedge(he, _phg->edgeWeight(he));
     }
   }
@@ -302,7 +334,7 @@ void QuotientGraph<TypeTraits>::finalizeConstruction(const SearchID search_id) {
   ASSERT(search_id < _searches.size());
   _searches[search_id].is_finalized = true;
   const BlockPair& blocks = _searches[search_id].blocks;
-  _quotient_graph[blocks.i][blocks.j].release(search_id);
+  _quotient_graph.edge(blocks.i, blocks.j).release(search_id);
 }
 
 template<typename TypeTraits>
@@ -313,17 +345,19 @@ void QuotientGraph<TypeTraits>::finalizeSearch(const SearchID search_id,
   ASSERT(_searches[search_id].is_finalized);
 
   const BlockPair& blocks = _searches[search_id].blocks;
-  QuotientGraphEdge& qg_edge = _quotient_graph[blocks.i][blocks.j];
+  QuotientGraphEdge& qg_edge = _quotient_graph.edge(blocks.i, blocks.j);
   if ( total_improvement > 0 ) {
     // If the search improves the quality of the partition, we reinsert
     // all hyperedges that were used by the search and are still cut.
     ++qg_edge.num_improvements_found;
     qg_edge.total_improvement += total_improvement;
   }
-  // In case the block pair becomes active,
-  // we reinsert it into the queue
-  _active_block_scheduler.finalizeSearch(
-    blocks, _searches[search_id].round, total_improvement);
+  if ( _searches[search_id].is_scheduled ) {
+    // In case the block pair becomes active,
+    // we reinsert it into the queue
+    _active_block_scheduler.finalizeSearch(
+      blocks, _searches[search_id].round, total_improvement);
+  }
   --_num_active_searches;
 }
 
@@ -336,7 +370,8 @@ void QuotientGraph<TypeTraits>::initialize(const PartitionedHypergraph& phg) {
   _num_active_searches.store(0, std::memory_order_relaxed);
   _searches.clear();
 
-  // Find all cut hyperedges between the blocks
+  // Find all cut hyperedges between the blocks. Edges of block pairs
+  // that become adjacent for the first time are inserted on the fly.
   tbb::enumerable_thread_specific<HyperedgeID> local_num_hes(0);
   phg.doParallelForAllEdges([&](const HyperedgeID he) {
     ++local_num_hes.local();
@@ -344,7 +379,7 @@ void QuotientGraph<TypeTraits>::initialize(const PartitionedHypergraph& phg) {
     for ( const PartitionID i : phg.connectivitySet(he) ) {
       for ( const PartitionID j : phg.connectivitySet(he) ) {
         if ( i < j ) {
-          _quotient_graph[i][j].add_hyperedge(he, edge_weight);
+          _quotient_graph.edge(i, j).add_hyperedge(he, edge_weight);
         }
       }
     }
@@ -358,18 +393,9 @@ void QuotientGraph<TypeTraits>::initialize(const PartitionedHypergraph& phg) {
 
 template<typename TypeTraits>
 void QuotientGraph<TypeTraits>::changeNumberOfBlocks(const PartitionID new_k) {
-  // Reset improvement history as the number of blocks had changed
-  for ( size_t i = 0; i < _quotient_graph.size(); ++i ) {
-    for ( size_t j = 0; j < _quotient_graph.size(); ++j ) {
-      _quotient_graph[i][j].num_improvements_found.store(0, std::memory_order_relaxed);
-      _quotient_graph[i][j].total_improvement.store(0, std::memory_order_relaxed);
-    }
-  }
-
-  if ( static_cast<size_t>(new_k) > _quotient_graph.size() ) {
-    _quotient_graph.clear();
-    _quotient_graph.assign(new_k, vec<QuotientGraphEdge>(new_k));
-  }
+  // Removing all edges also resets the improvement history
+  // as the number of blocks had changed
+  _quotient_graph.clear(new_k);
 }
 
 template<typename TypeTraits>
@@ -379,11 +405,9 @@ size_t QuotientGraph<TypeTraits>::numActiveBlockPairs() const {
 
 template<typename TypeTraits>
 void QuotientGraph<TypeTraits>::resetQuotientGraphEdges() {
-  for ( PartitionID i = 0; i < _context.partition.k; ++i ) {
-    for ( PartitionID j = i + 1; j < _context.partition.k; ++j ) {
-      _quotient_graph[i][j].reset();
-    }
-  }
+  tbb::parallel_for(UL(0), _quotient_graph.numEdges(), [&](const size_t idx) {
+    _quotient_graph.edgeAt(idx).reset();
+  });
 }
 
 INSTANTIATE_CLASS_WITH_TYPE_TRAITS(QuotientGraph)
@@ -26,7 +26,11 @@
 
 #pragma once
 
-#include <tbb/concurrent_queue.h>
+#include <iterator>
+#include <tuple>
+
+#include <tbb/concurrent_priority_queue.h>
+#include <tbb/concurrent_unordered_map.h>
 #include <tbb/concurrent_vector.h>
 #include <tbb/enumerable_thread_specific.h>
 
@@ -125,6 +129,120 @@ class QuotientGraph {
     CAtomic<HyperedgeWeight> total_improvement;
   };
 
+  /**
+   * Sparse representation of the quotient graph. We only store edges for block pairs
+   * that are adjacent (or were adjacent on a previous level with the same number
+   * of blocks). The edges are stored in a concurrent vector, which does not invalidate
+   * references on growth, and are found via a concurrent hash table. Furthermore, we
+   * store the adjacent blocks of each block such that scheduling only visits adjacent
+   * block pairs instead of all k * (k - 1) / 2 block pairs. New edges are inserted
+   * under a lock, which is only required the first time two blocks become adjacent.
+   */
+  class QuotientGraphEdges {
+
+    using EdgeIndex = tbb::concurrent_unordered_map<uint64_t, size_t>;
+
+   public:
+    explicit QuotientGraphEdges(const PartitionID k) :
+      _k(k),
+      _edges(),
+      _edge_index(),
+      _adjacent_blocks(k),
+      _insert_lock() { }
+
+    // ! Returns the edge of block pair (i,j) and inserts it, if the blocks were not adjacent before
+    QuotientGraphEdge& edge(const PartitionID i, const PartitionID j) {
+      ASSERT(i < j && j < _k);
+      auto it = _edge_index.find(key(i, j));
+      if ( it != _edge_index.end() ) {
+        return _edges[it->second];
+      }
+      return insert(i, j);
+    }
+
+    // ! Returns the edge of block pair (i,j) or nullptr, if the blocks were never adjacent
+    const QuotientGraphEdge* find(const PartitionID i, const PartitionID j) const {
+      ASSERT(i < j && j < _k);
+      auto it = _edge_index.find(key(i, j));
+      return it != _edge_index.end() ? &_edges[it->second] : nullptr;
+    }
+
+    // ! Number of edges (including edges of block pairs that are currently not adjacent)
+    size_t numEdges() const {
+      return _edges.size();
+    }
+
+    QuotientGraphEdge& edgeAt(const size_t idx) {
+      ASSERT(idx < _edges.size());
+      return _edges[idx];
+    }
+
+    const QuotientGraphEdge& edgeAt(const size_t idx) const {
+      ASSERT(idx < _edges.size());
+      return _edges[idx];
+    }
+
+    // ! Returns a copy of the blocks adjacent to block i in the quotient graph
+    vec<PartitionID> adjacentBlocks(const PartitionID i) {
+      ASSERT(i < _k);
+      _insert_lock.lock();
+      vec<PartitionID> adjacent_blocks = _adjacent_blocks[i];
+      _insert_lock.unlock();
+      return adjacent_blocks;
+    }
+
+    // ! Removes all edges and changes the number of blocks
+    void clear(const PartitionID k) {
+      _k = k;
+      _edges.clear();
+      _edge_index.clear();
+      _adjacent_blocks.assign(k, vec<PartitionID>());
+    }
+
+   private:
+    uint64_t key(const PartitionID i, const PartitionID j) const {
+      return static_cast<uint64_t>(i) * _k + j;
+    }
+
+    QuotientGraphEdge& insert(const PartitionID i, const PartitionID j) {
+      _insert_lock.lock();
+      auto it = _edge_index.find(key(i, j));
+      if ( it != _edge_index.end() ) {
+        // Another thread inserted the edge in the meantime
+        _insert_lock.unlock();
+        return _edges[it->second];
+      }
+      auto edge_it = _edges.grow_by(1);
+      const size_t idx = std::distance(_edges.begin(), edge_it);
+      edge_it->blocks = BlockPair { i, j };
+      _adjacent_blocks[i].push_back(j);
+      _adjacent_blocks[j].push_back(i);
+      // The edge is visible for other threads once it is inserted into the index
+      _edge_index.emplace(key(i, j), idx);
+      _insert_lock.unlock();
+      return *edge_it;
+    }
+
+    PartitionID _k;
+    tbb::concurrent_vector<QuotientGraphEdge> _edges;
+    EdgeIndex _edge_index;
+    vec<vec<PartitionID>> _adjacent_blocks;
+    SpinLock _insert_lock;
+  };
+
+  // ! Block pair together with its priority at the time it is scheduled.
+  // ! Block pairs with a higher total improvement and cut weight are scheduled first.
+  struct PrioritizedBlockPair {
+    HyperedgeWeight total_improvement;
+    HyperedgeWeight cut_he_weight;
+    BlockPair blocks;
+
+    bool operator<(const PrioritizedBlockPair& other) const {
+      return std::tie(total_improvement, cut_he_weight) <
+        std::tie(other.total_improvement, other.cut_he_weight);
+    }
+  };
+
   /**
    * Maintains the block pair of a round of the active block scheduling strategy
    */
@@ -132,7 +250,7 @@ class QuotientGraph {
 
    public:
     explicit ActiveBlockSchedulingRound(const Context& context,
-                                        vec<vec<QuotientGraphEdge>>& quotient_graph) :
+                                        QuotientGraphEdges& quotient_graph) :
       _context(context),
       _quotient_graph(quotient_graph),
       _unscheduled_blocks(),
@@ -173,9 +291,9 @@ class QuotientGraph {
 
    const Context& _context;
    // ! Quotient graph
-    vec<vec<QuotientGraphEdge>>& _quotient_graph;
-    // ! Queue that contains all unscheduled block pairs of the current round
-    tbb::concurrent_queue<BlockPair> _unscheduled_blocks;
+    QuotientGraphEdges& _quotient_graph;
+    // ! Priority queue that contains all unscheduled block pairs of the current round
+    tbb::concurrent_priority_queue<PrioritizedBlockPair> _unscheduled_blocks;
     // ! Current improvement made in this round
     CAtomic<HyperedgeWeight> _round_improvement;
     // Active blocks for next round
@@ -202,7 +320,7 @@ class QuotientGraph {
 
    public:
     explicit ActiveBlockScheduler(const Context& context,
-                                  vec<vec<QuotientGraphEdge>>& quotient_graph) :
+                                  QuotientGraphEdges& quotient_graph) :
       _context(context),
       _quotient_graph(quotient_graph),
       _num_rounds(0),
@@ -257,7 +375,7 @@ class QuotientGraph {
 
     const Context& _context;
     // ! Quotient graph
-    vec<vec<QuotientGraphEdge>>& _quotient_graph;
+    QuotientGraphEdges& _quotient_graph;
     // Contains all active block scheduling rounds
     CAtomic<size_t> _num_rounds;
     tbb::concurrent_vector<ActiveBlockSchedulingRound> _rounds;
@@ -274,15 +392,18 @@ class QuotientGraph {
 
   // Contains information required by a local search
   struct Search {
-    explicit Search(const BlockPair& blocks, const size_t round) :
+    explicit Search(const BlockPair& blocks, const size_t round, const bool is_scheduled) :
       blocks(blocks),
       round(round),
+      is_scheduled(is_scheduled),
       is_finalized(false) { }
 
     // ! Block pair on which this search operates on
     BlockPair blocks;
     // ! Round of active block scheduling
     size_t round;
+    // ! Flag indicating if the block pair was taken from the active block scheduler
+    bool is_scheduled;
     // ! Flag indicating if construction of the corresponding search
     // ! is finalized
     bool is_finalized;
@@ -297,19 +418,11 @@ public:
     _context(context),
     _initial_num_edges(num_hyperedges),
     _current_num_edges(kInvalidHyperedge),
-    _quotient_graph(context.partition.k,
-      vec<QuotientGraphEdge>(context.partition.k)),
+    _quotient_graph(context.partition.k),
     _register_search_lock(),
     _active_block_scheduler(context, _quotient_graph),
     _num_active_searches(0),
-    _searches() {
-    for ( PartitionID i = 0; i < _context.partition.k; ++i ) {
-      for ( PartitionID j = i + 1; j < _context.partition.k; ++j ) {
-        _quotient_graph[i][j].blocks.i = i;
-        _quotient_graph[i][j].blocks.j = j;
-      }
-    }
-  }
+    _searches() { }
 
   QuotientGraph(const QuotientGraph&) = delete;
   QuotientGraph(QuotientGraph&&) = delete;
@@ -326,6 +439,25 @@ public:
    */
   SearchID requestNewSearch(FlowRefinerAdapter<TypeTraits>& refiner);
 
+  /**
+   * Returns a new search id for the given block pair. In contrast to the
+   * function above, the block pair is not taken from the active block scheduler,
+   * which allows the deterministic flow refinement scheduling to decide which
+   * block pairs are refined in a round.
+   */
+  SearchID requestNewSearch(const BlockPair& blocks,
+                            FlowRefinerAdapter<TypeTraits>& refiner);
+
+  /**
+   * Returns all block pairs that contain at least one active block and are
+   * eligible for refinement (same criteria as in the active block scheduling
+   * strategy). The block pairs are sorted in decreasing order of their total
+   * improvement and cut weight. Ties are broken by the block IDs such that the
+   * order is deterministic.
+   */
+  vec<BlockPair> activeBlockPairs(const vec<uint8_t>& active_blocks,
+                                  const bool is_first_round) const;
+
   // ! Returns the block pair on which the corresponding search operates on
   BlockPair getBlockPair(const SearchID search_id) const {
     ASSERT(search_id < _searches.size());
@@ -340,12 +472,18 @@ public:
   template<typename F>
   void doForAllCutHyperedgesOfSearch(const SearchID search_id, const F& f) {
     const BlockPair& blocks = _searches[search_id].blocks;
-    const size_t num_cut_hes = _quotient_graph[blocks.i][blocks.j].num_cut_hes.load();
-    std::shuffle(_quotient_graph[blocks.i][blocks.j].cut_hes.begin(),
-                 _quotient_graph[blocks.i][blocks.j].cut_hes.begin() + num_cut_hes,
-                 utils::Randomize::instance().getGenerator());
+    QuotientGraphEdge& qg_edge = _quotient_graph.edge(blocks.i, blocks.j);
+    const size_t num_cut_hes = qg_edge.num_cut_hes.load();
+    if ( _context.partition.deterministic ) {
+      // The order in which cut hyperedges are inserted depends on the thread
+      // schedule. Sorting them ensures that the BFS always grows the same region.
+      std::sort(qg_edge.cut_hes.begin(), qg_edge.cut_hes.begin() + num_cut_hes);
+    } else {
+      std::shuffle(qg_edge.cut_hes.begin(), qg_edge.cut_hes.begin() + num_cut_hes,
+                   utils::Randomize::instance().getGenerator());
+    }
     for ( size_t i = 0; i < num_cut_hes; ++i ) {
-      const HyperedgeID he = _quotient_graph[blocks.i][blocks.j].cut_hes[i];
+      const HyperedgeID he = qg_edge.cut_hes[i];
       if ( _phg->pinCountInPart(he, blocks.i) > 0 && _phg->pinCountInPart(he, blocks.j) > 0 ) {
         f(he);
       }
@@ -393,7 +531,13 @@ public:
     ASSERT(i < j);
     ASSERT(0 <= i && i < _context.partition.k);
     ASSERT(0 <= j && j < _context.partition.k);
-    return _quotient_graph[i][j].cut_he_weight;
+    const QuotientGraphEdge* qg_edge = _quotient_graph.find(i, j);
+    return qg_edge ? qg_edge->cut_he_weight.load() : 0;
+  }
+
+  // ! Number of block pairs that are stored in the quotient graph
+  size_t numStoredBlockPairs() const {
+    return _quotient_graph.numEdges();
   }
 
   void changeNumberOfBlocks(const PartitionID new_k);
@@ -413,7 +557,7 @@ public:
 
   // ! Each edge contains stats and the cut hyperedges
   // ! of the block pair which its represents.
-  vec<vec<QuotientGraphEdge>> _quotient_graph;
+  QuotientGraphEdges _quotient_graph;
 
   SpinLock _register_search_lock;
   // ! Queue that contains all block pairs.
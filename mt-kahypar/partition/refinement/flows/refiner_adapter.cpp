@@ -29,6 +29,7 @@
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/factories.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/tracer.h"
 
 namespace mt_kahypar {
 
@@ -74,6 +75,7 @@ MoveSequence FlowRefinerAdapter<TypeTraits>::refine(const SearchID search_id,
                                                     const Subhypergraph& sub_hg) {
   ASSERT(static_cast<size_t>(search_id) < _active_searches.size());
   ASSERT(_active_searches[search_id].refiner_idx != INVALID_REFINER_IDX);
+  utils::TraceScope trace(utils::TraceEvent::flow_problem);
 
   // Perform refinement
   mt_kahypar_partitioned_hypergraph_const_t partitioned_hg =
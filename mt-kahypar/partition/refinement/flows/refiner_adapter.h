@@ -167,7 +167,10 @@ private:
   std::unique_ptr<IFlowRefiner> initializeRefiner();
 
   bool shouldSetTimeLimit() const {
-    return _num_refinements > static_cast<size_t>(_context.partition.k) &&
+    // The time limit depends on measured running times, which would
+    // break reproducibility in deterministic mode
+    return !_context.partition.deterministic &&
+      _num_refinements > static_cast<size_t>(_context.partition.k) &&
       _context.refinement.flows.time_limit_factor > 1.0;
   }
 
@@ -55,6 +55,23 @@ void FlowRefinementScheduler<GraphAndGainTypes>::RefinementStats::update_global_
     failed_updates_due_to_balance_constraint.load(std::memory_order_relaxed));
   _stats.update_stat("total_flow_refinement_improvement",
     total_improvement.load(std::memory_order_relaxed));
+  if ( num_construction_cache_hits + num_construction_cache_misses > 0 ) {
+    _stats.update_stat("flow_construction_cache_hits",
+      num_construction_cache_hits.load(std::memory_order_relaxed));
+    _stats.update_stat("flow_construction_cache_misses",
+      num_construction_cache_misses.load(std::memory_order_relaxed));
+    _stats.update_stat("flow_construction_time_saved", construction_time_saved);
+  }
+  if ( num_multiway_refinements > 0 ) {
+    _stats.update_stat("num_multiway_flow_refinements",
+      num_multiway_refinements.load(std::memory_order_relaxed));
+    _stats.update_stat("num_multiway_flow_improvements",
+      num_multiway_improvements.load(std::memory_order_relaxed));
+    _stats.update_stat("num_multiway_flow_steps",
+      num_multiway_steps.load(std::memory_order_relaxed));
+    _stats.update_stat("num_multiway_flow_balance_violations",
+      num_multiway_balance_violations.load(std::memory_order_relaxed));
+  }
 }
 
 template<typename GraphAndGainTypes>
@@ -68,53 +85,69 @@ bool FlowRefinementScheduler<GraphAndGainTypes>::refineImpl(
   _quotient_graph.setObjective(best_metrics.quality);
 
   std::atomic<HyperedgeWeight> overall_delta(0);
-  utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
-  tbb::parallel_for(UL(0), _refiner.numAvailableRefiner(), [&](const size_t i) {
-    while ( i < std::max(UL(1), static_cast<size_t>(
-        std::ceil(_context.refinement.flows.parallel_searches_multiplier *
-            _quotient_graph.numActiveBlockPairs()))) ) {
-      SearchID search_id = _quotient_graph.requestNewSearch(_refiner);
-      if ( search_id != QuotientGraph<TypeTraits>::INVALID_SEARCH_ID ) {
-        DBG << "Start search" << search_id
-            << "( Blocks =" << blocksOfSearch(search_id)
-            << ", Refiner =" << i << ")";
-        timer.start_timer("region_growing", "Grow Region", true);
-        const Subhypergraph sub_hg =
-          _constructor.construct(search_id, _quotient_graph, phg);
-        _quotient_graph.finalizeConstruction(search_id);
-        timer.stop_timer("region_growing");
-
-        HyperedgeWeight delta = 0;
-        bool improved_solution = false;
-        if ( sub_hg.numNodes() > 0 ) {
-          ++_stats.num_refinements;
-          MoveSequence sequence = _refiner.refine(search_id, phg, sub_hg);
-
-          if ( !sequence.moves.empty() ) {
-            timer.start_timer("apply_moves", "Apply Moves", true);
-            delta = applyMoves(search_id, sequence);
-            overall_delta -= delta;
-            improved_solution = sequence.state == MoveSequenceState::SUCCESS && delta > 0;
-            timer.stop_timer("apply_moves");
-          } else if ( sequence.state == MoveSequenceState::TIME_LIMIT ) {
-            ++_stats.num_time_limits;
-            DBG << RED << "Search" << search_id << "reaches the time limit ( Time Limit ="
-                << _refiner.timeLimit() << "s )" << END;
+  if ( _context.partition.deterministic ) {
+    overall_delta -= refineDeterministically(phg, best_metrics.quality);
+  } else {
+    utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+    tbb::parallel_for(UL(0), _refiner.numAvailableRefiner(), [&](const size_t i) {
+      // No new searches are started once the time limit of the partitioning call is exceeded
+      while ( i < std::max(UL(1), static_cast<size_t>(
+          std::ceil(_context.refinement.flows.parallel_searches_multiplier *
+              _quotient_graph.numActiveBlockPairs()))) && !_context.isTimeLimitExceeded() ) {
+        SearchID search_id = _quotient_graph.requestNewSearch(_refiner);
+        if ( search_id != QuotientGraph<TypeTraits>::INVALID_SEARCH_ID ) {
+          DBG << "Start search" << search_id
+              << "( Blocks =" << blocksOfSearch(search_id)
+              << ", Refiner =" << i << ")";
+          timer.start_timer("region_growing", "Grow Region", true);
+          const Subhypergraph sub_hg =
+            _constructor.construct(search_id, _quotient_graph, phg);
+          _quotient_graph.finalizeConstruction(search_id);
+          timer.stop_timer("region_growing");
+
+          HyperedgeWeight delta = 0;
+          bool improved_solution = false;
+          if ( sub_hg.numNodes() > 0 ) {
+            ++_stats.num_refinements;
+            MoveSequence sequence = _refiner.refine(search_id, phg, sub_hg);
+
+            if ( !sequence.moves.empty() ) {
+              timer.start_timer("apply_moves", "Apply Moves", true);
+              delta = applyMoves(search_id, sequence);
+              overall_delta -= delta;
+              improved_solution = sequence.state == MoveSequenceState::SUCCESS && delta > 0;
+              timer.stop_timer("apply_moves");
+            } else if ( sequence.state == MoveSequenceState::TIME_LIMIT ) {
+              ++_stats.num_time_limits;
+              DBG << RED << "Search" << search_id << "reaches the time limit ( Time Limit ="
+                  << _refiner.timeLimit() << "s )" << END;
+            }
           }
+          _quotient_graph.finalizeSearch(search_id, improved_solution ? delta : 0);
+          _refiner.finalizeSearch(search_id);
+          DBG << "End search" << search_id
+              << "( Blocks =" << blocksOfSearch(search_id)
+              << ", Refiner =" << i
+              << ", Running Time =" << _refiner.runningTime(search_id) << ")";
+        } else {
+          break;
         }
-        _quotient_graph.finalizeSearch(search_id, improved_solution ? delta : 0);
-        _refiner.finalizeSearch(search_id);
-        DBG << "End search" << search_id
-            << "( Blocks =" << blocksOfSearch(search_id)
-            << ", Refiner =" << i
-            << ", Running Time =" << _refiner.runningTime(search_id) << ")";
-      } else {
-        break;
       }
-    }
-    _refiner.terminateRefiner();
-    DBG << RED << "Refiner" << i << "terminates!" << END;
-  });
+      _refiner.terminateRefiner();
+      DBG << RED << "Refiner" << i << "terminates!" << END;
+    });
+  }
+
+  if ( _context.refinement.flows.multiway_num_blocks >= 3 && !_context.isTimeLimitExceeded() ) {
+    overall_delta -= refineBlockClusters(phg);
+  }
+
+  if ( _context.refinement.flows.cache_constructions ) {
+    const auto cache_stats = _constructor.fetchAndResetCacheStats();
+    _stats.num_construction_cache_hits += cache_stats.num_hits;
+    _stats.num_construction_cache_misses += cache_stats.num_misses;
+    _stats.construction_time_saved += cache_stats.saved_time;
+  }
 
   DBG << _stats;
 
@@ -150,6 +183,187 @@ bool FlowRefinementScheduler<GraphAndGainTypes>::refineImpl(
   return overall_delta.load(std::memory_order_relaxed) < 0;
 }
 
+namespace {
+
+// ! Removes a matching from the given block pairs, i.e., a set of block pairs
+// ! such that no two pairs share a block. The block pairs are visited in the
+// ! given order and the remaining block pairs keep their relative order.
+vec<BlockPair> extractMatching(vec<BlockPair>& block_pairs, const PartitionID k) {
+  vec<BlockPair> matching;
+  vec<BlockPair> remaining_block_pairs;
+  vec<bool> is_matched(k, false);
+  for ( const BlockPair& blocks : block_pairs ) {
+    if ( !is_matched[blocks.i] && !is_matched[blocks.j] ) {
+      is_matched[blocks.i] = true;
+      is_matched[blocks.j] = true;
+      matching.push_back(blocks);
+    } else {
+      remaining_block_pairs.push_back(blocks);
+    }
+  }
+  block_pairs = std::move(remaining_block_pairs);
+  return matching;
+}
+
+// ! Greedily groups the blocks into disjoint clusters of at most max_cluster_size
+// ! mutually adjacent blocks. A cluster is seeded with the next block pair whose
+// ! blocks are not yet clustered and is then grown by the unclustered block with
+// ! the heaviest cut to the cluster among all blocks adjacent to every block of
+// ! the cluster. Only clusters with at least three blocks are returned.
+template<typename F>
+vec<vec<PartitionID>> selectBlockClusters(const vec<BlockPair>& block_pairs,
+                                          const PartitionID k,
+                                          const size_t max_cluster_size,
+                                          const F& cut_weight) {
+  vec<vec<PartitionID>> adjacent_blocks(k);
+  for ( const BlockPair& blocks : block_pairs ) {
+    adjacent_blocks[blocks.i].push_back(blocks.j);
+    adjacent_blocks[blocks.j].push_back(blocks.i);
+  }
+
+  vec<vec<PartitionID>> clusters;
+  vec<bool> is_clustered(k, false);
+  for ( const BlockPair& blocks : block_pairs ) {
+    if ( is_clustered[blocks.i] || is_clustered[blocks.j] ) {
+      continue;
+    }
+
+    vec<PartitionID> cluster = { blocks.i, blocks.j };
+    is_clustered[blocks.i] = true;
+    is_clustered[blocks.j] = true;
+    while ( cluster.size() < max_cluster_size ) {
+      PartitionID best_block = kInvalidPartition;
+      HyperedgeWeight best_cut_weight = 0;
+      for ( const PartitionID block : adjacent_blocks[blocks.i] ) {
+        if ( !is_clustered[block] ) {
+          HyperedgeWeight cut_weight_to_cluster = 0;
+          for ( const PartitionID other : cluster ) {
+            const HyperedgeWeight weight = cut_weight(block, other);
+            if ( weight == 0 ) {
+              cut_weight_to_cluster = 0;
+              break;
+            }
+            cut_weight_to_cluster += weight;
+          }
+          if ( cut_weight_to_cluster > best_cut_weight ) {
+            best_block = block;
+            best_cut_weight = cut_weight_to_cluster;
+          }
+        }
+      }
+      if ( best_block == kInvalidPartition ) {
+        break;
+      }
+      cluster.push_back(best_block);
+      is_clustered[best_block] = true;
+    }
+
+    if ( cluster.size() >= 3 ) {
+      clusters.emplace_back(std::move(cluster));
+    } else {
+      is_clustered[blocks.i] = false;
+      is_clustered[blocks.j] = false;
+    }
+  }
+  return clusters;
+}
+
+} // namespace
+
+template<typename GraphAndGainTypes>
+HyperedgeWeight FlowRefinementScheduler<GraphAndGainTypes>::refineDeterministically(PartitionedHypergraph& phg,
+                                                                                    const HyperedgeWeight objective) {
+  utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+  const HyperedgeWeight min_improvement_per_round =
+    _context.refinement.flows.min_relative_improvement_per_round * objective;
+  const size_t max_parallel_searches = std::max(UL(1), _refiner.numAvailableRefiner());
+
+  HyperedgeWeight overall_improvement = 0;
+  vec<uint8_t> active_blocks(_context.partition.k, true);
+  vec<uint8_t> next_active_blocks(_context.partition.k, false);
+  vec<SearchID> search_ids;
+  vec<MoveSequence> sequences;
+  for ( size_t round = 0; ; ++round ) {
+    vec<BlockPair> block_pairs = _quotient_graph.activeBlockPairs(active_blocks, round == 0);
+    if ( block_pairs.empty() ) {
+      break;
+    }
+
+    HyperedgeWeight round_improvement = 0;
+    std::fill(next_active_blocks.begin(), next_active_blocks.end(), false);
+    while ( !block_pairs.empty() ) {
+      // The block pairs of a matching are disjoint, but a flow problem can still
+      // depend on the blocks of other searches (e.g., cut and steiner tree metric).
+      // Thus, we solve all flow problems of a matching on the unchanged partition.
+      // The number of refiners only limits how many of them are solved concurrently,
+      // which makes the result independent of the number of threads.
+      const vec<BlockPair> matching = extractMatching(block_pairs, _context.partition.k);
+      search_ids.clear();
+      sequences.assign(matching.size(), MoveSequence { {}, 0 });
+      for ( size_t start = 0; start < matching.size(); start += max_parallel_searches ) {
+        const size_t end = std::min(start + max_parallel_searches, matching.size());
+        for ( size_t idx = start; idx < end; ++idx ) {
+          search_ids.push_back(_quotient_graph.requestNewSearch(matching[idx], _refiner));
+        }
+
+        tbb::parallel_for(start, end, [&](const size_t idx) {
+          const SearchID search_id = search_ids[idx];
+          timer.start_timer("region_growing", "Grow Region", true);
+          const Subhypergraph sub_hg =
+            _constructor.construct(search_id, _quotient_graph, phg);
+          _quotient_graph.finalizeConstruction(search_id);
+          timer.stop_timer("region_growing");
+
+          if ( sub_hg.numNodes() > 0 ) {
+            ++_stats.num_refinements;
+            sequences[idx] = _refiner.refine(search_id, phg, sub_hg);
+          }
+        });
+
+        // Release the refiners for the next flow problems of the matching
+        for ( size_t idx = start; idx < end; ++idx ) {
+          _refiner.finalizeSearch(search_ids[idx]);
+        }
+      }
+
+      // Apply the move sequences in the order of the matching
+      timer.start_timer("apply_moves", "Apply Moves");
+      for ( size_t idx = 0; idx < search_ids.size(); ++idx ) {
+        const SearchID search_id = search_ids[idx];
+        MoveSequence& sequence = sequences[idx];
+        HyperedgeWeight delta = 0;
+        bool improved_solution = false;
+        if ( !sequence.moves.empty() ) {
+          delta = applyMoves(search_id, sequence);
+          overall_improvement += delta;
+          improved_solution = sequence.state == MoveSequenceState::SUCCESS && delta > 0;
+        }
+
+        if ( improved_solution ) {
+          const BlockPair blocks = _quotient_graph.getBlockPair(search_id);
+          next_active_blocks[blocks.i] = true;
+          next_active_blocks[blocks.j] = true;
+          round_improvement += delta;
+        }
+        _quotient_graph.finalizeSearch(search_id, improved_solution ? delta : 0);
+        DBG << "End search" << search_id
+            << "( Blocks =" << blocksOfSearch(search_id)
+            << ", Improvement =" << delta << ")";
+      }
+      timer.stop_timer("apply_moves");
+    }
+
+    DBG << GREEN << "Round" << (round + 1) << "terminates with improvement"
+        << round_improvement << "( Minimum Required Improvement ="
+        << min_improvement_per_round << ")" << END;
+    if ( round_improvement == 0 || round_improvement < min_improvement_per_round ) {
+      break;
+    }
+    active_blocks.swap(next_active_blocks);
+  }
+  return overall_improvement;
+}
+
 template<typename GraphAndGainTypes>
 void FlowRefinementScheduler<GraphAndGainTypes>::initializeImpl(mt_kahypar_partitioned_hypergraph_t& hypergraph)  {
   PartitionedHypergraph& phg = utils::cast<PartitionedHypergraph>(hypergraph);
@@ -164,6 +378,8 @@ void FlowRefinementScheduler<GraphAndGainTypes>::initializeImpl(mt_kahypar_parti
   }
 
   _stats.reset();
+  // The partition might have been changed by other refiners
+  _constructor.resetCache();
   utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
   timer.start_timer("initialize_quotient_graph", "Initialize Quotient Graph");
   _quotient_graph.initialize(phg);
@@ -359,6 +575,118 @@ HyperedgeWeight FlowRefinementScheduler<GraphAndGainTypes>::applyMoves(const Sea
   return improvement;
 }
 
+template<typename GraphAndGainTypes>
+HyperedgeWeight FlowRefinementScheduler<GraphAndGainTypes>::refineBlockClusters(PartitionedHypergraph& phg) {
+  utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+  timer.start_timer("multiway_flow_refinement", "Multi-Way Flow Refinement");
+  // The flow problems of a cluster are solved one after another.
+  // Thus, a single refiner can use all threads.
+  _refiner.initialize(1);
+
+  const vec<uint8_t> all_blocks(_context.partition.k, true);
+  const vec<vec<PartitionID>> clusters = selectBlockClusters(
+    _quotient_graph.activeBlockPairs(all_blocks, true), _context.partition.k,
+    _context.refinement.flows.multiway_num_blocks,
+    [&](const PartitionID i, const PartitionID j) {
+      return _quotient_graph.getCutHyperedgeWeightOfBlockPair(std::min(i, j), std::max(i, j));
+    });
+  DBG << "Number of block clusters for multi-way flow refinement =" << clusters.size();
+
+  HyperedgeWeight improvement = 0;
+  for ( const vec<PartitionID>& cluster : clusters ) {
+    improvement += refineBlockCluster(phg, cluster);
+  }
+  timer.stop_timer("multiway_flow_refinement");
+  return improvement;
+}
+
+template<typename GraphAndGainTypes>
+HyperedgeWeight FlowRefinementScheduler<GraphAndGainTypes>::refineBlockCluster(PartitionedHypergraph& phg,
+                                                                               const vec<PartitionID>& cluster) {
+  ASSERT(cluster.size() >= 3);
+  ++_stats.num_multiway_refinements;
+
+  // Two-way flow steps are performed in decreasing order of the cut weight
+  vec<BlockPair> block_pairs;
+  for ( size_t a = 0; a < cluster.size(); ++a ) {
+    for ( size_t b = a + 1; b < cluster.size(); ++b ) {
+      block_pairs.push_back(BlockPair {
+        std::min(cluster[a], cluster[b]), std::max(cluster[a], cluster[b]) });
+    }
+  }
+  std::sort(block_pairs.begin(), block_pairs.end(),
+    [&](const BlockPair& lhs, const BlockPair& rhs) {
+      return std::make_tuple(-_quotient_graph.getCutHyperedgeWeightOfBlockPair(lhs.i, lhs.j), lhs.i, lhs.j) <
+        std::make_tuple(-_quotient_graph.getCutHyperedgeWeightOfBlockPair(rhs.i, rhs.j), rhs.i, rhs.j);
+    });
+
+  HyperedgeWeight improvement = 0;
+  vec<HypernodeWeight> part_weight_deltas(_context.partition.k, 0);
+  vec<NewCutHyperedge> new_cut_hes;
+  for ( const BlockPair& blocks : block_pairs ) {
+    if ( _quotient_graph.getCutHyperedgeWeightOfBlockPair(blocks.i, blocks.j) == 0 ) {
+      continue;
+    }
+
+    const SearchID search_id = _quotient_graph.requestNewSearch(blocks, _refiner);
+    const Subhypergraph sub_hg = _constructor.construct(search_id, _quotient_graph, phg);
+    _quotient_graph.finalizeConstruction(search_id);
+
+    MoveSequence sequence { {}, 0 };
+    if ( sub_hg.numNodes() > 0 ) {
+      ++_stats.num_multiway_steps;
+      sequence = _refiner.refine(search_id, phg, sub_hg);
+    }
+
+    // The moves of a step are applied immediately such that the next step
+    // operates on the partition induced by all previous steps. A step is
+    // solved on the current partition and therefore never worsens the solution.
+    HyperedgeWeight step_improvement = 0;
+    if ( !sequence.moves.empty() ) {
+      std::fill(part_weight_deltas.begin(), part_weight_deltas.end(), 0);
+      for ( Move& move : sequence.moves ) {
+        move.from = phg.partID(move.node);
+        if ( move.from != move.to ) {
+          const HypernodeWeight node_weight = phg.nodeWeight(move.node);
+          part_weight_deltas[move.from] -= node_weight;
+          part_weight_deltas[move.to] += node_weight;
+        }
+      }
+
+      if ( partWeightUpdate(part_weight_deltas, false).is_balanced ) {
+        new_cut_hes.clear();
+        auto delta_func = [&](const SynchronizedEdgeUpdate& sync_update) {
+          step_improvement -= AttributedGains::gain(sync_update);
+
+          // Collect hyperedges with new blocks in its connectivity set
+          if ( sync_update.pin_count_in_to_part_after == 1 ) {
+            // the corresponding block will be set in applyMoveSequence(...) function
+            new_cut_hes.emplace_back(NewCutHyperedge { sync_update.he, kInvalidPartition });
+          }
+        };
+        applyMoveSequence(phg, _gain_cache, sequence, delta_func,
+          _context.forceGainCacheUpdates(), _was_moved, new_cut_hes);
+        ASSERT(step_improvement >= 0, V(step_improvement) << V(sequence.expected_improvement));
+        addCutHyperedgesToQuotientGraph(_quotient_graph, new_cut_hes);
+        improvement += step_improvement;
+      } else {
+        ++_stats.num_multiway_balance_violations;
+      }
+    }
+    _quotient_graph.finalizeSearch(search_id, std::max(step_improvement, 0));
+    _refiner.finalizeSearch(search_id);
+  }
+
+  if ( improvement > 0 ) {
+    DBG << GREEN << "Multi-way flow refinement improves solution quality ("
+        << "Number of Blocks =" << cluster.size()
+        << ", Real Improvement =" << improvement << ")" << END;
+    ++_stats.num_multiway_improvements;
+    _stats.total_improvement += improvement;
+  }
+  return improvement;
+}
+
 template<typename GraphAndGainTypes>
 typename FlowRefinementScheduler<GraphAndGainTypes>::PartWeightUpdateResult
 FlowRefinementScheduler<GraphAndGainTypes>::partWeightUpdate(const vec<HypernodeWeight>& part_weight_deltas,
@@ -76,7 +76,14 @@ class FlowRefinementScheduler final : public IRefiner {
       failed_updates_due_to_conflicting_moves(0),
       failed_updates_due_to_conflicting_moves_without_rollback(0),
       failed_updates_due_to_balance_constraint(0),
-      total_improvement(0) { }
+      total_improvement(0),
+      num_construction_cache_hits(0),
+      num_construction_cache_misses(0),
+      construction_time_saved(0.0),
+      num_multiway_refinements(0),
+      num_multiway_improvements(0),
+      num_multiway_steps(0),
+      num_multiway_balance_violations(0) { }
 
     void reset() {
       num_refinements.store(0);
@@ -88,6 +95,13 @@ class FlowRefinementScheduler final : public IRefiner {
       failed_updates_due_to_conflicting_moves_without_rollback.store(0);
       failed_updates_due_to_balance_constraint.store(0);
       total_improvement.store(0);
+      num_construction_cache_hits.store(0);
+      num_construction_cache_misses.store(0);
+      construction_time_saved = 0.0;
+      num_multiway_refinements.store(0);
+      num_multiway_improvements.store(0);
+      num_multiway_steps.store(0);
+      num_multiway_balance_violations.store(0);
     }
 
     void update_global_stats();
@@ -102,6 +116,13 @@ class FlowRefinementScheduler final : public IRefiner {
     CAtomic<int64_t> failed_updates_due_to_conflicting_moves_without_rollback;
     CAtomic<int64_t> failed_updates_due_to_balance_constraint;
     CAtomic<HyperedgeWeight> total_improvement;
+    CAtomic<int64_t> num_construction_cache_hits;
+    CAtomic<int64_t> num_construction_cache_misses;
+    double construction_time_saved;
+    CAtomic<int64_t> num_multiway_refinements;
+    CAtomic<int64_t> num_multiway_improvements;
+    CAtomic<int64_t> num_multiway_steps;
+    CAtomic<int64_t> num_multiway_balance_violations;
   };
 
   struct PartWeightUpdateResult {
@@ -138,6 +159,23 @@ class FlowRefinementScheduler final : public IRefiner {
     str << "+ Time Limits                       = "
         << progress_bar(stats.num_time_limits, stats.num_refinements,
             [&](const double percentage) { return percentage < 0.0025 ? GREEN : percentage < 0.01 ? YELLOW : RED; }) << "\n";
+    const int64_t num_constructions = stats.num_construction_cache_hits + stats.num_construction_cache_misses;
+    if ( num_constructions > 0 ) {
+      str << "Construction Cache Hits             = "
+          << progress_bar(stats.num_construction_cache_hits, num_constructions,
+              [&](const double) { return WHITE; }) << "\n";
+      str << "Saved Construction Time             = " << stats.construction_time_saved << " s\n";
+    }
+    if ( stats.num_multiway_refinements > 0 ) {
+      str << "Multi-Way Flow Refinements          = " << stats.num_multiway_refinements << "\n";
+      str << "+ Number of Improvements            = "
+          << progress_bar(stats.num_multiway_improvements, stats.num_multiway_refinements,
+              [&](const double) { return WHITE; }) << "\n";
+      str << "+ Two-Way Flow Steps                = " << stats.num_multiway_steps << "\n";
+      str << "+ Failed due to Balance Constraint  = "
+          << progress_bar(stats.num_multiway_balance_violations, stats.num_multiway_steps,
+              [&](const double) { return WHITE; }) << "\n";
+    }
     str << "---------------------------------------------------------------";
     return str;
   }
@@ -205,6 +243,26 @@ private:
 
   void initializeImpl(mt_kahypar_partitioned_hypergraph_t& phg) final;
 
+  // ! Deterministic flow refinement scheduling. Each round selects matchings of
+  // ! the active block pairs of the quotient graph, solves the corresponding flow
+  // ! problems in parallel on the unchanged partition and applies the move
+  // ! sequences in a fixed order.
+  // ! Returns the improvement in solution quality.
+  HyperedgeWeight refineDeterministically(PartitionedHypergraph& phg,
+                                          const HyperedgeWeight objective);
+
+  // ! Multi-way flow refinement via sequential two-way flows. Groups the blocks into
+  // ! clusters of mutually adjacent blocks and refines each cluster via
+  // ! refineBlockCluster(...). Returns the improvement in solution quality.
+  HyperedgeWeight refineBlockClusters(PartitionedHypergraph& phg);
+
+  // ! Solves two-way flow problems on all block pairs of the cluster one after
+  // ! another. The moves of each step are applied immediately, i.e., each step
+  // ! sees the moves of the previous steps. Note that no flow problem spans more
+  // ! than two blocks of the cluster.
+  HyperedgeWeight refineBlockCluster(PartitionedHypergraph& phg,
+                                     const vec<PartitionID>& cluster);
+
   void resizeDataStructuresForCurrentK();
 
   PartWeightUpdateResult partWeightUpdate(const vec<HypernodeWeight>& part_weight_deltas,
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/parallel/chunking.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+
+struct BestPrefix {
+  Gain gain = 0;                           /** gain when using valid moves up to best_index */
+  MoveID best_index = 0;                   /** local ID of first move to revert */
+  HypernodeWeight heaviest_weight =
+          std::numeric_limits<HypernodeWeight>::max();   /** weight of the heaviest part */
+
+  bool operator<(const BestPrefix& o) const {
+    return gain > o.gain ||
+           (gain == o.gain && std::tie(heaviest_weight, best_index) < std::tie(o.heaviest_weight, o.best_index));
+  }
+};
+
+/**
+ * Finds the prefix of the global move sequence with the highest gain that satisfies
+ * the balance constraint (ties are broken by the weight of the heaviest block and
+ * then by the prefix length).
+ *
+ * The move sequence is split into min(ceil(num_moves / 4096), 4 * max_concurrency)
+ * blocks, i.e., the number of blocks depends on the number of threads. The first pass
+ * computes the gain sum and the part weight deltas of each block. An exclusive prefix
+ * sum over the blocks then yields the part weights at the start of each block. The
+ * prefix sum adds contiguous arrays of k weights, which the compiler vectorizes. The
+ * second pass tracks the balance and the best prefix within each block. The result
+ * does not depend on the number of threads, since the scan is exact and ties are
+ * broken deterministically.
+ *
+ * Moves that were reverted locally are invalid. They are skipped without
+ * branching: they contribute zero gain and zero weight.
+ */
+template<typename NodeWeightFunc>
+BestPrefix findBestBalancedPrefix(const vec<Move>& moves,
+                                  const MoveID num_moves,
+                                  const vec<HypernodeWeight>& initial_part_weights,
+                                  const std::vector<HypernodeWeight>& max_part_weights,
+                                  const NodeWeightFunc& node_weight) {
+  static constexpr MoveID MIN_MOVES_PER_BLOCK = 4096;
+  const size_t k = initial_part_weights.size();
+  BestPrefix best { 0, 0, *std::max_element(initial_part_weights.begin(), initial_part_weights.end()) };
+  if ( num_moves == 0 ) {
+    return best;
+  }
+
+  const size_t num_blocks = std::max(UL(1), std::min(
+    static_cast<size_t>(parallel::chunking::idiv_ceil(num_moves, MIN_MOVES_PER_BLOCK)),
+    static_cast<size_t>(4 * tbb::this_task_arena::max_concurrency())));
+  const size_t block_size = parallel::chunking::idiv_ceil(num_moves, num_blocks);
+
+  // Row b + 1 contains the part weight deltas of block b. After the prefix sum,
+  // row b contains the part weights at the start of block b.
+  vec<HypernodeWeight> block_part_weights((num_blocks + 1) * k, 0);
+  vec<Gain> block_gain(num_blocks + 1, 0);
+
+  tbb::parallel_for(UL(0), num_blocks, [&](const size_t b) {
+    const auto [first, last] = parallel::chunking::bounds(b, num_moves, block_size);
+    HypernodeWeight* deltas = block_part_weights.data() + (b + 1) * k;
+    Gain gain_sum = 0;
+    for ( size_t i = first; i < last; ++i ) {
+      const Move& m = moves[i];
+      const bool valid = m.isValid();
+      const HypernodeWeight weight = valid ? node_weight(m.node) : 0;
+      deltas[valid ? m.from : 0] -= weight;
+      deltas[valid ? m.to : 0] += weight;
+      gain_sum += valid ? m.gain : 0;
+    }
+    block_gain[b + 1] = gain_sum;
+  }, tbb::static_partitioner());
+
+  std::copy(initial_part_weights.begin(), initial_part_weights.end(), block_part_weights.begin());
+  for ( size_t b = 1; b <= num_blocks; ++b ) {
+    const HypernodeWeight* prev = block_part_weights.data() + (b - 1) * k;
+    HypernodeWeight* current = block_part_weights.data() + b * k;
+    for ( size_t i = 0; i < k; ++i ) {
+      current[i] += prev[i];
+    }
+    block_gain[b] += block_gain[b - 1];
+  }
+
+  vec<BestPrefix> block_best(num_blocks);
+  tbb::parallel_for(UL(0), num_blocks, [&](const size_t b) {
+    const auto [first, last] = parallel::chunking::bounds(b, num_moves, block_size);
+    vec<HypernodeWeight> part_weights(block_part_weights.begin() + b * k,
+                                      block_part_weights.begin() + (b + 1) * k);
+    size_t overloaded = 0;
+    for ( size_t i = 0; i < k; ++i ) {
+      overloaded += part_weights[i] > max_part_weights[i];
+    }
+
+    Gain gain_sum = block_gain[b];
+    BestPrefix current;
+    for ( size_t i = first; i < last; ++i ) {
+      const Move& m = moves[i];
+      const bool valid = m.isValid();
+      const HypernodeWeight weight = valid ? node_weight(m.node) : 0;
+      const PartitionID from = valid ? m.from : 0;
+      const PartitionID to = valid ? m.to : 0;
+      gain_sum += valid ? m.gain : 0;
+
+      const bool from_overloaded = part_weights[from] > max_part_weights[from];
+      part_weights[from] -= weight;
+      overloaded -= from_overloaded && part_weights[from] <= max_part_weights[from];
+      const bool to_overloaded = part_weights[to] > max_part_weights[to];
+      part_weights[to] += weight;
+      overloaded += !to_overloaded && part_weights[to] > max_part_weights[to];
+
+      if ( valid && overloaded == 0 && gain_sum >= current.gain ) {
+        BestPrefix new_prefix = { gain_sum, static_cast<MoveID>(i + 1),
+          *std::max_element(part_weights.begin(), part_weights.end()) };
+        current = std::min(current, new_prefix);
+      }
+    }
+    block_best[b] = current;
+  }, tbb::static_partitioner());
+
+  for ( const BestPrefix& prefix : block_best ) {
+    if ( prefix.best_index != 0 ) {
+      best = std::min(best, prefix);
+    }
+  }
+  return best;
+}
+
+}  // namespace mt_kahypar
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <limits>
+#include <utility>
 
 #include "mt-kahypar/datastructures/concurrent_bucket_map.h"
 #include "mt-kahypar/datastructures/priority_queue.h"
@@ -73,6 +74,21 @@ struct GlobalMoveTracker {
     return move_id;
   }
 
+  // ! Inserts a move at a fixed position of the current move sequence. Used if the
+  // ! positions are computed in advance (e.g., in the deterministic FM). Afterwards,
+  // ! setNumPerformedMoves(...) must be called with the length of the move sequence.
+  MoveID insertMoveAt(const Move& m, const MoveID position) {
+    const MoveID move_id = firstMoveID + position;
+    assert(position < moveOrder.size());
+    moveOrder[position] = m;
+    moveOfNode[m.node] = move_id;
+    return move_id;
+  }
+
+  void setNumPerformedMoves(const MoveID num_moves) {
+    runningMoveID.store(firstMoveID + num_moves, std::memory_order_relaxed);
+  }
+
   Move& getMove(MoveID move_id) {
     assert(move_id - firstMoveID < moveOrder.size());
     return moveOrder[move_id - firstMoveID];
@@ -147,6 +163,54 @@ struct NodeTracker {
 };
 
 
+// Shared pool of label propagation work items for FM rounds in which label propagation
+// is pipelined with the localized searches. A work item is a chunk of border nodes.
+// The FM tasks process the chunks before they start localized searches, which means
+// that no thread has to wait at a barrier between label propagation and FM.
+struct LabelPropagationWorkPool {
+  static constexpr size_t CHUNK_SIZE = 256;
+
+  vec<HypernodeID> nodes;
+  CAtomic<size_t> nextNode { 0 };
+  CAtomic<size_t> processedChunks { 0 };
+
+  // ! Copies the border nodes of the current round into the pool
+  void initialize(const WorkContainer<HypernodeID>& refinement_nodes) {
+    const size_t num_queues = refinement_nodes.tls_queues.size();
+    vec<size_t> prefix_sum(num_queues + 1, 0);
+    for (size_t i = 0; i < num_queues; ++i) {
+      prefix_sum[i + 1] = prefix_sum[i] + refinement_nodes.tls_queues[i].elements.size();
+    }
+    nodes.resize(prefix_sum[num_queues]);
+    tbb::parallel_for(UL(0), num_queues, [&](const size_t i) {
+      const vec<HypernodeID>& elements = refinement_nodes.tls_queues[i].elements;
+      std::copy(elements.begin(), elements.end(), nodes.begin() + prefix_sum[i]);
+    });
+    nextNode.store(0, std::memory_order_relaxed);
+    processedChunks.store(0, std::memory_order_relaxed);
+  }
+
+  void clear() {
+    nodes.clear();
+    nextNode.store(0, std::memory_order_relaxed);
+    processedChunks.store(0, std::memory_order_relaxed);
+  }
+
+  size_t numChunks() const {
+    return (nodes.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  }
+
+  // ! Returns the range of the next chunk (the range is empty if no chunk is left)
+  std::pair<size_t, size_t> nextChunk() {
+    if (nextNode.load(std::memory_order_relaxed) >= nodes.size()) {
+      return { 0, 0 };
+    }
+    const size_t first = std::min(nextNode.fetch_add(CHUNK_SIZE, std::memory_order_relaxed), nodes.size());
+    return { first, std::min(first + CHUNK_SIZE, nodes.size()) };
+  }
+};
+
+
 // Contains data required for unconstrained FM: We group non-border nodes in buckets based on their
 // incident weight to node weight ratio. This allows to give a (pessimistic) estimate of the effective
 // gain for moves that violate the balance constraint
@@ -271,6 +335,9 @@ struct FMSharedData {
   // ! Additional data for unconstrained FM algorithm
   UnconstrainedFMData unconstrained;
 
+  // ! Label propagation work items (only used if label propagation is pipelined with FM)
+  LabelPropagationWorkPool lpWorkPool;
+
   // ! Stop parallel refinement if finishedTasks > finishedTasksLimit to avoid long-running single searches
   CAtomic<size_t> finishedTasks;
   size_t finishedTasksLimit = std::numeric_limits<size_t>::max();
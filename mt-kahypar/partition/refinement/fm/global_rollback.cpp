@@ -26,10 +26,9 @@
 
 #include "mt-kahypar/partition/refinement/fm/global_rollback.h"
 
-#include <tbb/parallel_scan.h>
-
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/refinement/fm/best_prefix_scan.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
@@ -38,123 +37,6 @@
 
 namespace mt_kahypar {
 
-  template<typename PartitionedHypergraph>
-  struct BalanceAndBestIndexScan {
-    const PartitionedHypergraph& phg;
-    const vec<Move>& moves;
-
-    struct Prefix {
-      Gain gain = 0;                           /** gain when using valid moves up to best_index */
-      MoveID best_index = 0;                   /** local ID of first move to revert */
-      HypernodeWeight heaviest_weight =
-              std::numeric_limits<HypernodeWeight>::max();   /** weight of the heaviest part */
-
-      bool operator<(const Prefix& o) const {
-        return gain > o.gain ||
-               (gain == o.gain && std::tie(heaviest_weight, best_index) < std::tie(o.heaviest_weight, o.best_index));
-      }
-    };
-    std::shared_ptr< tbb::enumerable_thread_specific<Prefix> > local_best;
-
-    Gain gain_sum = 0;
-
-    vec<HypernodeWeight> part_weights;
-    const std::vector<HypernodeWeight>& max_part_weights;
-
-    BalanceAndBestIndexScan(BalanceAndBestIndexScan& b, tbb::split) :
-            phg(b.phg),
-            moves(b.moves),
-            local_best(b.local_best),
-            gain_sum(0),
-            part_weights(b.part_weights.size(), 0),
-            max_part_weights(b.max_part_weights) { }
-
-
-    BalanceAndBestIndexScan(const PartitionedHypergraph& phg,
-                            const vec<Move>& moves,
-                            const vec<HypernodeWeight>& part_weights,
-                            const std::vector<HypernodeWeight>& max_part_weights) :
-            phg(phg),
-            moves(moves),
-            local_best(std::make_shared< tbb::enumerable_thread_specific<Prefix> >()),
-            part_weights(part_weights),
-            max_part_weights(max_part_weights)
-    {
-    }
-
-
-    void operator()(const tbb::blocked_range<MoveID>& r, tbb::pre_scan_tag ) {
-      for (MoveID i = r.begin(); i < r.end(); ++i) {
-        const Move& m = moves[i];
-        if (m.isValid()) {  // skip locally reverted moves
-          gain_sum += m.gain;
-          part_weights[m.from] -= phg.nodeWeight(m.node);
-          part_weights[m.to] += phg.nodeWeight(m.node);
-        }
-      }
-    }
-
-    // subranges a | b | c | d . assuming this ran pre_scan on c,
-    // then lhs ran pre_scan on b and final_scan of this will be on d
-    void reverse_join(BalanceAndBestIndexScan& lhs) {
-      for (size_t i = 0; i < part_weights.size(); ++i) {
-        part_weights[i] += lhs.part_weights[i];
-      }
-      gain_sum += lhs.gain_sum;
-    }
-
-    void operator()(const tbb::blocked_range<MoveID>& r, tbb::final_scan_tag ) {
-      size_t overloaded = 0;
-      for (size_t i = 0; i < part_weights.size(); ++i) {
-        if (part_weights[i] > max_part_weights[i]) {
-          overloaded++;
-        }
-      }
-
-      Prefix current;
-      for (MoveID i = r.begin(); i < r.end(); ++i) {
-        const Move& m = moves[i];
-
-        if (m.isValid()) {  // skip locally reverted moves
-          gain_sum += m.gain;
-
-          const bool from_overloaded = part_weights[m.from] > max_part_weights[m.from];
-          part_weights[m.from] -= phg.nodeWeight(m.node);
-          if (from_overloaded && part_weights[m.from] <= max_part_weights[m.from]) {
-            overloaded--;
-          }
-          const bool to_overloaded = part_weights[m.to] > max_part_weights[m.to];
-          part_weights[m.to] += phg.nodeWeight(m.node);
-          if (!to_overloaded && part_weights[m.to] > max_part_weights[m.to]) {
-            overloaded++;
-          }
-
-          if (overloaded == 0 && gain_sum >= current.gain) {
-            Prefix new_prefix = { gain_sum, i + 1, *std::max_element(part_weights.begin(), part_weights.end()) };
-            current = std::min(current, new_prefix);
-          }
-        }
-      }
-
-      if (current.best_index != 0) {
-        Prefix& lb = local_best->local();
-        lb = std::min(lb, current);
-      }
-    }
-
-    void assign(BalanceAndBestIndexScan& b) {
-      gain_sum = b.gain_sum;
-    }
-
-    Prefix finalize(const vec<HypernodeWeight>& initial_part_weights) {
-      Prefix res { 0, 0, *std::max_element(initial_part_weights.begin(), initial_part_weights.end()) };
-      for (const Prefix& x : *local_best) {
-        res = std::min(res, x);
-      }
-      return res;
-    }
-  };
-
   template<typename GraphAndGainTypes>
   HyperedgeWeight GlobalRollback<GraphAndGainTypes>::revertToBestPrefixParallel(
           PartitionedHypergraph& phg, FMSharedData& sharedData,
@@ -167,10 +49,8 @@ namespace mt_kahypar {
     recalculateGains(phg, sharedData);
     HEAVY_REFINEMENT_ASSERT(verifyGains(phg, sharedData));
 
-    BalanceAndBestIndexScan<PartitionedHypergraph> s(phg, move_order, partWeights, maxPartWeights);
-    // TODO set grain size in blocked_range? to avoid too many copies of part weights array. experiment with different values
-    tbb::parallel_scan(tbb::blocked_range<MoveID>(0, numMoves), s);
-    typename BalanceAndBestIndexScan<PartitionedHypergraph>::Prefix b = s.finalize(partWeights);
+    const BestPrefix b = findBestBalancedPrefix(move_order, numMoves, partWeights, maxPartWeights,
+      [&](const HypernodeID u) { return phg.nodeWeight(u); });
 
     tbb::parallel_for(b.best_index, numMoves, [&](const MoveID moveID) {
       const Move& m = move_order[moveID];
@@ -31,6 +31,7 @@
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/gain_cache_strategy.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/unconstrained_strategy.h"
+#include "mt-kahypar/utils/tracer.h"
 
 namespace mt_kahypar {
 
@@ -38,6 +39,7 @@ namespace mt_kahypar {
   template<typename DispatchedFMStrategy>
   bool LocalizedKWayFM<GraphAndGainTypes>::findMoves(DispatchedFMStrategy& fm_strategy, PartitionedHypergraph& phg,
                                                   size_t taskID, size_t numSeeds) {
+    utils::TraceScope trace(utils::TraceEvent::fm_localized_search);
     localMoves.clear();
     thisSearch = ++sharedData.nodeTracker.highestActiveSearchID;
 
@@ -80,6 +82,7 @@ namespace mt_kahypar {
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   void LocalizedKWayFM<GraphAndGainTypes>::acquireOrUpdateNeighbors(PHG& phg, CACHE& gain_cache, const Move& move,
                                                                  DispatchedFMStrategy& fm_strategy) {
+    utils::TraceScope trace(utils::TraceEvent::fm_pq_update);
     auto updateOrAcquire = [&](const HypernodeID v) {
       SearchID searchOfV = sharedData.nodeTracker.searchOfNode[v].load(std::memory_order_relaxed);
       if (searchOfV == thisSearch) {
@@ -121,6 +124,57 @@ namespace mt_kahypar {
   }
 
 
+  template<typename GraphAndGainTypes>
+  bool LocalizedKWayFM<GraphAndGainTypes>::labelPropagationOnNextChunk(PartitionedHypergraph& phg) {
+    const auto [first, last] = sharedData.lpWorkPool.nextChunk();
+    if (first == last) {
+      return false;
+    }
+
+    // The nodes are acquired via the node tracker such that they are not moved concurrently
+    // by a localized search. Moved nodes are inserted into the global move sequence and
+    // deactivated, since a node can be moved at most once per round. The global rollback
+    // treats these moves as any other move of the round.
+    thisSearch = ++sharedData.nodeTracker.highestActiveSearchID;
+    for (size_t i = first; i < last; ++i) {
+      const HypernodeID u = sharedData.lpWorkPool.nodes[i];
+      if (!sharedData.nodeTracker.tryAcquireNode(u, thisSearch)) {
+        continue;
+      }
+
+      // As in the label propagation refiner, we perform a move if it either improves the
+      // solution quality or, in case of a zero gain move, the balance of the solution.
+      const PartitionID from = phg.partID(u);
+      const HypernodeWeight weight = phg.nodeWeight(u);
+      Move move { from, kInvalidPartition, u, 0 };
+      for (PartitionID to = 0; to < context.partition.k; ++to) {
+        if (to != from && phg.partWeight(to) + weight <= context.partition.max_part_weights[to]) {
+          const Gain gain = gain_cache.gain(u, from, to);
+          if (gain > move.gain) {
+            move.to = to;
+            move.gain = gain;
+          } else if (gain == 0 && move.gain == 0 && context.refinement.label_propagation.rebalancing &&
+                     phg.partWeight(from) - 1 > phg.partWeight(to) + 1 &&
+                     phg.partWeight(to) < context.partition.perfect_balance_part_weights[to] &&
+                     (move.to == kInvalidPartition || phg.partWeight(to) < phg.partWeight(move.to))) {
+            move.to = to;
+          }
+        }
+      }
+
+      if (move.to != kInvalidPartition && phg.changeNodePart(
+              gain_cache, u, from, move.to, context.partition.max_part_weights[move.to],
+              [&] { sharedData.moveTracker.insertMove(move); },
+              [&](const SynchronizedEdgeUpdate& ) {})) {
+        sharedData.nodeTracker.deactivateNode(u, thisSearch);
+      } else {
+        sharedData.nodeTracker.releaseNode(u);
+      }
+    }
+    sharedData.lpWorkPool.processedChunks.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
   template<typename GraphAndGainTypes>
   template<typename DispatchedFMStrategy>
   void LocalizedKWayFM<GraphAndGainTypes>::internalFindMoves(PartitionedHypergraph& phg,
@@ -169,13 +223,28 @@ namespace mt_kahypar {
         // global partition (used to expand the localized search and update the gain values).
         moved = toWeight + phg.nodeWeight(move.node) <= allowed_weight;
       } else {
-        moved = deltaPhg.changeNodePart(move.node, move.from, move.to, allowed_weight,
-                                        [&](const SynchronizedEdgeUpdate& sync_update) {
-          if (!PartitionedHypergraph::is_graph && GainCache::triggersDeltaGainUpdate(sync_update)) {
-            edgesWithGainChanges.push_back(sync_update.he);
+        bool graph_specialized_update = false;
+        if constexpr (GainCache::TYPE == GainPolicy::cut_for_graphs) {
+          // Edges of a graph have exactly two pins. Thus, the delta gain cache can be updated
+          // directly from the incident edges of the moved node without constructing a
+          // synchronized edge update (which requires the block of each neighbor).
+          graph_specialized_update = context.refinement.fm.graph_specialized_delta_updates;
+          if (graph_specialized_update) {
+            moved = deltaPhg.changeNodePart(move.node, move.from, move.to, allowed_weight);
+            if (moved) {
+              delta_gain_cache.deltaGainUpdateOfMovedNode(deltaPhg, move.node, move.from, move.to);
+            }
           }
-          delta_gain_cache.deltaGainUpdate(deltaPhg, sync_update);
-        });
+        }
+        if (!graph_specialized_update) {
+          moved = deltaPhg.changeNodePart(move.node, move.from, move.to, allowed_weight,
+                                          [&](const SynchronizedEdgeUpdate& sync_update) {
+            if (!PartitionedHypergraph::is_graph && GainCache::triggersDeltaGainUpdate(sync_update)) {
+              edgesWithGainChanges.push_back(sync_update.he);
+            }
+            delta_gain_cache.deltaGainUpdate(deltaPhg, sync_update);
+          });
+        }
         fm_strategy.applyMove(deltaPhg, delta_gain_cache, move);
       }
 
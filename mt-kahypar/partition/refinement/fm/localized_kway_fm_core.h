@@ -80,6 +80,10 @@ public:
   template<typename DispatchedFMStrategy>
   bool findMoves(DispatchedFMStrategy& fm_strategy, PartitionedHypergraph& phg, size_t taskID, size_t numSeeds);
 
+  // ! Moves the nodes of the next label propagation work item to their best target block
+  // ! (if the move improves the solution). Returns false if no work item is left.
+  bool labelPropagationOnNextChunk(PartitionedHypergraph& phg);
+
   void memoryConsumption(utils::MemoryTreeNode* parent) const;
 
   void changeNumberOfBlocks(const PartitionID new_k);
@@ -36,6 +36,7 @@
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/utils/memory_tree.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/tracer.h"
 
 namespace mt_kahypar {
   using ds::StreamingVector;
@@ -55,7 +56,8 @@ namespace mt_kahypar {
     globalRollback(num_hyperedges, context, gainCache),
     ets_fm([&] { return constructLocalizedKWayFMSearch(); }),
     tmp_move_order(num_hypernodes),
-    rebalancer(rb) {
+    rebalancer(rb),
+    round_budget(c.refinement.fm.round_budget_min_rate_fraction) {
     if (context.refinement.fm.obey_minimal_parallelism) {
       sharedData.finishedTasksLimit = std::min(UL(8), context.shared_memory.num_threads);
     }
@@ -99,8 +101,14 @@ namespace mt_kahypar {
     std::vector<HypernodeWeight> max_part_weights = setupMaxPartWeights(context);
     HighResClockTimepoint fm_start = std::chrono::high_resolution_clock::now();
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    utils::Stats& stats = utils::Utilities::instance().getStats(context.utility_id);
+    const bool use_round_budget = context.refinement.fm.adaptive_round_budget;
+    if (use_round_budget) {
+      round_budget.beginLevel(phg.initialNumNodes());
+    }
 
     for (size_t round = 0; round < context.refinement.fm.multitry_rounds; ++round) { // global multi try rounds
+      utils::TraceScope trace_round(utils::TraceEvent::fm_round);
       for (PartitionID i = 0; i < context.partition.k; ++i) {
         initialPartWeights[i] = phg.partWeight(i);
       }
@@ -113,13 +121,17 @@ namespace mt_kahypar {
       }
 
       timer.start_timer("collect_border_nodes", "Collect Border Nodes");
-      roundInitialization(phg, refinement_nodes);
+      // label propagation is pipelined within the first rounds (one round per label propagation iteration)
+      const bool pipeline_label_propagation = context.isLabelPropagationPipelinedWithFM() &&
+        round < context.refinement.label_propagation.maximum_iterations;
+      roundInitialization(phg, refinement_nodes, pipeline_label_propagation);
       timer.stop_timer("collect_border_nodes");
 
       size_t num_border_nodes = sharedData.refinementNodes.unsafe_size();
       if (num_border_nodes == 0) {
         break;
       }
+      HighResClockTimepoint round_start = std::chrono::high_resolution_clock::now();
       size_t num_seeds = context.refinement.fm.num_seed_nodes;
       if (context.type == ContextType::main
           && !refinement_nodes.empty()  /* n-level */
@@ -130,11 +142,21 @@ namespace mt_kahypar {
       }
 
       timer.start_timer("find_moves", "Find Moves");
-      size_t num_tasks = std::min(num_border_nodes, size_t(TBBInitializer::instance().total_number_of_threads()));
+      // the thread budget of the context is smaller than the number of threads if several
+      // instances are partitioned concurrently (e.g., deep multilevel recursions or batches)
+      size_t num_tasks = std::min(num_border_nodes, context.shared_memory.num_threads);
+      max_num_tasks = std::max(max_num_tasks, num_tasks);
       sharedData.finishedTasks.store(0, std::memory_order_relaxed);
       fm_strategy->findMoves(utils::localized_fm_cast(ets_fm), hypergraph,
                              num_tasks, num_seeds, round);
       timer.stop_timer("find_moves");
+      // the FM tasks only terminate once all label propagation work items are taken
+      ASSERT(sharedData.lpWorkPool.processedChunks.load() == sharedData.lpWorkPool.numChunks(),
+        V(sharedData.lpWorkPool.processedChunks.load()) << V(sharedData.lpWorkPool.numChunks()));
+      if (pipeline_label_propagation) {
+        num_pipelined_lp_chunks += sharedData.lpWorkPool.numChunks();
+        stats.update_stat("fm_pipelined_lp_chunks", static_cast<int64_t>(sharedData.lpWorkPool.numChunks()));
+      }
 
       if (is_unconstrained && !isBalanced(phg, max_part_weights)) {
         vec<vec<Move>> moves_by_part;
@@ -168,6 +190,14 @@ namespace mt_kahypar {
       HyperedgeWeight improvement = globalRollback.revertToBestPrefix(phg, sharedData, initialPartWeights, max_part_weights);
       timer.stop_timer("rollback");
 
+      HighResClockTimepoint fm_timestamp = std::chrono::high_resolution_clock::now();
+      const double round_time = std::chrono::duration<double>(fm_timestamp - round_start).count();
+      stats.update_stat("fm_round_" + std::to_string(round + 1) + "_improvement",
+        static_cast<int64_t>(improvement));
+      if (use_round_budget) {
+        round_budget.recordRound(improvement, round_time);
+      }
+
       const double roundImprovementFraction = improvementFraction(improvement,
         metrics.quality - overall_improvement);
       overall_improvement += improvement;
@@ -178,12 +208,11 @@ namespace mt_kahypar {
       }
       fm_strategy->reportImprovement(round, improvement, roundImprovementFraction);
 
-      HighResClockTimepoint fm_timestamp = std::chrono::high_resolution_clock::now();
       const double elapsed_time = std::chrono::duration<double>(fm_timestamp - fm_start).count();
       if (debug && context.type == ContextType::main) {
         LOG << V(round) << V(improvement) << V(metrics::quality(phg, context))
             << V(metrics::imbalance(phg, context)) << V(num_border_nodes) << V(roundImprovementFraction)
-            << V(elapsed_time) << V(current_time_limit);
+            << V(elapsed_time) << V(round_time) << V(current_time_limit);
       }
 
       // Enforce a time limit (based on k and coarsening time).
@@ -204,14 +233,25 @@ namespace mt_kahypar {
             || consecutive_rounds_with_too_little_improvement >= 2 ) {
         break;
       }
+
+      if ( use_round_budget && !round_budget.continueLevel() ) {
+        DBG << "Improvement per second of round" << (round + 1) << "is too small => stop multitry FM";
+        break;
+      }
     }
 
+    const bool is_top_level = phg.initialNumNodes() == sharedData.moveTracker.moveOrder.size();
     if (context.partition.show_memory_consumption && context.partition.verbose_output
-        && context.type == ContextType::main
-        && phg.initialNumNodes() == sharedData.moveTracker.moveOrder.size() /* top level */) {
+        && context.type == ContextType::main && is_top_level) {
       printMemoryConsumption();
     }
 
+    if (use_round_budget && context.partition.show_detailed_timings && context.partition.verbose_output
+        && context.type == ContextType::main && is_top_level) {
+      LOG << "\nFM Round Budget Telemetry:";
+      LOG << round_budget;
+    }
+
     metrics.quality -= overall_improvement;
     metrics.imbalance = metrics::imbalance(phg, context);
     HEAVY_REFINEMENT_ASSERT(phg.checkTrackedPartitionInformation(gain_cache));
@@ -223,7 +263,8 @@ namespace mt_kahypar {
 
   template<typename GraphAndGainTypes>
   void MultiTryKWayFM<GraphAndGainTypes>::roundInitialization(PartitionedHypergraph& phg,
-                                                                  const vec<HypernodeID>& refinement_nodes) {
+                                                                  const vec<HypernodeID>& refinement_nodes,
+                                                                  const bool pipeline_label_propagation) {
     // clear border nodes
     sharedData.refinementNodes.clear();
 
@@ -265,9 +306,19 @@ namespace mt_kahypar {
       sharedData.refinementNodes.shuffle();
     }
 
+    // label propagation work items are taken from the border nodes
+    size_t num_lp_work_items = 0;
+    if (pipeline_label_propagation) {
+      sharedData.lpWorkPool.initialize(sharedData.refinementNodes);
+      num_lp_work_items = sharedData.lpWorkPool.numChunks();
+    } else {
+      sharedData.lpWorkPool.clear();
+    }
+
     // requesting new searches activates all nodes by raising the deactivated node marker
     // also clears the array tracking search IDs in case of overflow
-    sharedData.nodeTracker.requestNewSearches(static_cast<SearchID>(sharedData.refinementNodes.unsafe_size()));
+    sharedData.nodeTracker.requestNewSearches(static_cast<SearchID>(
+      sharedData.refinementNodes.unsafe_size() + num_lp_work_items));
   }
 
   template<typename GraphAndGainTypes>
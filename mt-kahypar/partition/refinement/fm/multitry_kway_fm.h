@@ -35,6 +35,7 @@
 #include "mt-kahypar/partition/refinement/i_rebalancer.h"
 #include "mt-kahypar/partition/refinement/fm/localized_kway_fm_core.h"
 #include "mt-kahypar/partition/refinement/fm/global_rollback.h"
+#include "mt-kahypar/partition/refinement/fm/round_budget.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/i_fm_strategy.h"
 #include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
 
@@ -71,6 +72,16 @@ class MultiTryKWayFM final : public IRefiner {
 
   void printMemoryConsumption();
 
+  // ! Only for testing
+  size_t numPipelinedLabelPropagationChunks() const {
+    return num_pipelined_lp_chunks;
+  }
+
+  // ! Only for testing
+  size_t maxNumLocalizedSearchTasks() const {
+    return max_num_tasks;
+  }
+
  private:
   bool refineImpl(mt_kahypar_partitioned_hypergraph_t& phg,
                   const vec<HypernodeID>& refinement_nodes,
@@ -80,7 +91,8 @@ class MultiTryKWayFM final : public IRefiner {
   void initializeImpl(mt_kahypar_partitioned_hypergraph_t& phg) final ;
 
   void roundInitialization(PartitionedHypergraph& phg,
-                           const vec<HypernodeID>& refinement_nodes);
+                           const vec<HypernodeID>& refinement_nodes,
+                           const bool pipeline_label_propagation);
 
   void interleaveMoveSequenceWithRebalancingMoves(const PartitionedHypergraph& phg,
                                                   const vec<HypernodeWeight>& initialPartWeights,
@@ -128,6 +140,9 @@ class MultiTryKWayFM final : public IRefiner {
   tbb::enumerable_thread_specific<LocalizedFMSearch> ets_fm;
   vec<Move> tmp_move_order;
   IRebalancer& rebalancer;
+  FMRoundBudget round_budget;
+  size_t num_pipelined_lp_chunks = 0;
+  size_t max_num_tasks = 0;
 };
 
 } // namespace mt_kahypar
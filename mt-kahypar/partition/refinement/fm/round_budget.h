@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <ostream>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+
+// Decides whether multitry FM should spend another round on the current level.
+// We record the improvement per second of each round. A round is only followed
+// by another one if its improvement per second is at least a fraction of the
+// average improvement per second of all previous rounds, including those on
+// coarser levels. Thus, finer levels stop early once FM no longer pays off there
+// as much as it did on the coarse levels.
+class FMRoundBudget {
+ public:
+  struct RoundTelemetry {
+    Gain improvement;
+    double time;
+  };
+
+  struct LevelTelemetry {
+    HypernodeID num_nodes;
+    vec<RoundTelemetry> rounds;
+  };
+
+  explicit FMRoundBudget(const double min_rate_fraction) :
+    _min_rate_fraction(min_rate_fraction),
+    _levels(),
+    _total_improvement(0),
+    _total_time(0.0),
+    _last_improvement(0),
+    _last_time(0.0) { }
+
+  // ! Consecutive calls on a hypergraph with the same number of nodes belong to the
+  // ! same level (e.g., the batches of the n-level uncoarsening)
+  void beginLevel(const HypernodeID num_nodes) {
+    if ( _levels.empty() || _levels.back().num_nodes != num_nodes ) {
+      _levels.push_back(LevelTelemetry { num_nodes, {} });
+    }
+  }
+
+  void recordRound(const Gain improvement, const double time) {
+    ASSERT(!_levels.empty());
+    _levels.back().rounds.push_back(RoundTelemetry { improvement, time });
+    // The reference rate excludes the last round, which is compared against it
+    _total_improvement += _last_improvement;
+    _total_time += _last_time;
+    _last_improvement = std::max(improvement, 0);
+    _last_time = time;
+  }
+
+  // ! Returns true, if the improvement per second of the last round justifies another round
+  bool continueLevel() const {
+    if ( _total_time <= 0.0 || _total_improvement == 0 ) {
+      // No reference available yet
+      return true;
+    }
+    const double reference_rate = static_cast<double>(_total_improvement) / _total_time;
+    const double last_rate = static_cast<double>(_last_improvement) / std::max(_last_time, 1e-9);
+    return last_rate >= _min_rate_fraction * reference_rate;
+  }
+
+  const vec<LevelTelemetry>& telemetry() const {
+    return _levels;
+  }
+
+  friend std::ostream& operator<<(std::ostream& out, const FMRoundBudget& budget) {
+    for ( const LevelTelemetry& level : budget._levels ) {
+      Gain improvement = 0;
+      double time = 0.0;
+      for ( const RoundTelemetry& round : level.rounds ) {
+        improvement += round.improvement;
+        time += round.time;
+      }
+      out << "  Level with " << level.num_nodes << " nodes: Rounds = " << level.rounds.size()
+          << ", Improvement = " << improvement << ", Time = " << time << " s"
+          << ", Improvement per Second = " << ( time > 0.0 ? improvement / time : 0.0 ) << "\n";
+    }
+    return out;
+  }
+
+ private:
+  const double _min_rate_fraction;
+  vec<LevelTelemetry> _levels;
+  int64_t _total_improvement;
+  double _total_time;
+  Gain _last_improvement;
+  double _last_time;
+};
+
+}  // namespace mt_kahypar
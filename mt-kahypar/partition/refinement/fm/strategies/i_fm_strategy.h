@@ -111,8 +111,10 @@ class IFMStrategy {
 
     auto task = [&](const size_t task_id) {
       LocalFM& fm = ets_fm.local();
+      // label propagation work items (if any) are processed before the localized searches
       while(sharedData.finishedTasks.load(std::memory_order_relaxed) < sharedData.finishedTasksLimit
-            && concrete_strategy.dispatchedFindMoves(fm, phg, task_id, num_seeds, round)) { /* keep running*/ }
+            && (fm.labelPropagationOnNextChunk(phg)
+                || concrete_strategy.dispatchedFindMoves(fm, phg, task_id, num_seeds, round))) { /* keep running*/ }
       sharedData.finishedTasks.fetch_add(1, std::memory_order_relaxed);
     };
     for (size_t i = 0; i < num_tasks; ++i) {
@@ -76,7 +76,8 @@ class UnconstrainedStrategy: public IFMStrategy {
   }
 
   virtual bool isUnconstrainedRoundImpl(size_t round) const final {
-    if (round > 0 && !unconstrained_is_enabled) {
+    if ((round > 0 && !unconstrained_is_enabled) || round >= context.refinement.fm.multitry_rounds) {
+      // additional rounds granted by the adaptive round budget are always constrained
       return false;
     }
     if (context.refinement.fm.activate_unconstrained_dynamically) {
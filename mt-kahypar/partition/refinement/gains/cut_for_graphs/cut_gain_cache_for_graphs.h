@@ -33,6 +33,7 @@
 #include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/numa_placement.h"
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/utils/range.h"
 #include "mt-kahypar/partition/context.h"
@@ -272,6 +273,7 @@ class GraphCutGainCache {
       _k = k;
       _dummy_adjacent_blocks = IntegerRangeIterator<PartitionID>(k);
       _gain_cache.resize("Refinement", "incident_weight_in_part", num_nodes * size_t(_k), true);
+      parallel::NumaPlacement::instance().place(_gain_cache.data(), _gain_cache.size());
     }
   }
 
@@ -376,6 +378,24 @@ class DeltaGraphCutGainCache {
     _incident_weight_in_part_delta[index_in_to_part] += sync_update.edge_weight;
   }
 
+  // ! Performs the delta gain updates for moving node u from block 'from' to block 'to'
+  // ! in one pass over its incident edges. Since each edge has exactly one other endpoint,
+  // ! this does not require the pin counts (or blocks) of the neighbors in contrast
+  // ! to calling deltaGainUpdate(...) for each synchronized edge update.
+  template<typename PartitionedGraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void deltaGainUpdateOfMovedNode(const PartitionedGraph& partitioned_graph,
+                                  const HypernodeID u,
+                                  const PartitionID from,
+                                  const PartitionID to) {
+    for ( const HyperedgeID& he : partitioned_graph.incidentEdges(u) ) {
+      const HypernodeID target = partitioned_graph.edgeTarget(he);
+      const HyperedgeWeight edge_weight = partitioned_graph.edgeWeight(he);
+      _incident_weight_in_part_delta[_gain_cache.incident_weight_index(target, from)] -= edge_weight;
+      _incident_weight_in_part_delta[_gain_cache.incident_weight_index(target, to)] += edge_weight;
+    }
+  }
+
 
  // ####################### Miscellaneous #######################
 
@@ -35,6 +35,7 @@
 #include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/numa_placement.h"
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/utils/range.h"
 #include "mt-kahypar/partition/context.h"
@@ -288,6 +289,7 @@ class Km1GainCache {
       _dummy_adjacent_blocks = IntegerRangeIterator<PartitionID>(k);
       _gain_cache.resize(
         "Refinement", "gain_cache", num_nodes * size_t(_k + 1), true);
+      parallel::NumaPlacement::instance().place(_gain_cache.data(), _gain_cache.size());
     }
   }
 
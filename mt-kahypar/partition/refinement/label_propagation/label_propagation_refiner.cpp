@@ -30,11 +30,14 @@
 #include <tbb/parallel_for.h>
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/numa_placement.h"
+#include "mt-kahypar/parallel/parallel_counting_sort.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/utils/randomize.h"
 #include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/utils/timer.h"
+#include "mt-kahypar/utils/tracer.h"
 #include "mt-kahypar/utils/cast.h"
 
 namespace mt_kahypar {
@@ -45,48 +48,58 @@ namespace mt_kahypar {
                                                            const HypernodeID hn,
                                                            NextActiveNodes& next_active_nodes,
                                                            const F& objective_delta) {
-    bool is_moved = false;
     ASSERT(hn != kInvalidHypernode);
     if ( hypergraph.isBorderNode(hn) && !hypergraph.isFixed(hn) ) {
       ASSERT(hypergraph.nodeIsEnabled(hn));
+      const Move best_move = _gain.computeMaxGainMove(hypergraph, hn, false, false, unconstrained);
+      return performMove<unconstrained>(hypergraph, hn, best_move, next_active_nodes, objective_delta);
+    }
+    return false;
+  }
 
-      Move best_move = _gain.computeMaxGainMove(hypergraph, hn, false, false, unconstrained);
-      // We perform a move if it either improves the solution quality or, in case of a
-      // zero gain move, the balance of the solution.
-      const bool positive_gain = best_move.gain < 0;
-      const bool zero_gain_move = (_context.refinement.label_propagation.rebalancing &&
-                                    best_move.gain == 0 &&
-                                    hypergraph.partWeight(best_move.from) - 1 >
-                                    hypergraph.partWeight(best_move.to) + 1 &&
-                                    hypergraph.partWeight(best_move.to) <
-                                    _context.partition.perfect_balance_part_weights[best_move.to]);
-      const bool perform_move = positive_gain || zero_gain_move;
-      if (best_move.from != best_move.to && perform_move) {
-        PartitionID from = best_move.from;
-        PartitionID to = best_move.to;
-
-        Gain delta_before = _gain.localDelta();
-        bool changed_part = changeNodePart<unconstrained>(hypergraph, hn, from, to, objective_delta);
-        ASSERT(!unconstrained || changed_part);
-        is_moved = true;
-        if (unconstrained || changed_part) {
-          // In case the move to block 'to' was successful, we verify that the "real" gain
-          // of the move is either equal to our computed gain or if not, still improves
-          // the solution quality.
-          Gain move_delta = _gain.localDelta() - delta_before;
-          bool accept_move = (move_delta == best_move.gain || move_delta <= 0);
-          if (accept_move) {
-            if constexpr (!unconstrained) {
-              // in unconstrained case, we don't want to activate neighbors if the move is undone
-              // by the rebalancing
-              activateNodeAndNeighbors(hypergraph, next_active_nodes, hn, true);
-            }
-          } else {
-            // If the real gain is not equal with the computed gain and
-            // worsens the solution quality we revert the move.
-            ASSERT(hypergraph.partID(hn) == to);
-            changeNodePart<unconstrained>(hypergraph, hn, to, from, objective_delta);
+  template <typename GraphAndGainTypes>
+  template<bool unconstrained, typename F>
+  bool LabelPropagationRefiner<GraphAndGainTypes>::performMove(PartitionedHypergraph& hypergraph,
+                                                            const HypernodeID hn,
+                                                            const Move& best_move,
+                                                            NextActiveNodes& next_active_nodes,
+                                                            const F& objective_delta) {
+    bool is_moved = false;
+    // We perform a move if it either improves the solution quality or, in case of a
+    // zero gain move, the balance of the solution.
+    const bool positive_gain = best_move.gain < 0;
+    const bool zero_gain_move = (_context.refinement.label_propagation.rebalancing &&
+                                  best_move.gain == 0 &&
+                                  hypergraph.partWeight(best_move.from) - 1 >
+                                  hypergraph.partWeight(best_move.to) + 1 &&
+                                  hypergraph.partWeight(best_move.to) <
+                                  _context.partition.perfect_balance_part_weights[best_move.to]);
+    const bool perform_move = positive_gain || zero_gain_move;
+    if (best_move.from != best_move.to && perform_move) {
+      PartitionID from = best_move.from;
+      PartitionID to = best_move.to;
+
+      Gain delta_before = _gain.localDelta();
+      bool changed_part = changeNodePart<unconstrained>(hypergraph, hn, from, to, objective_delta);
+      ASSERT(!unconstrained || changed_part);
+      is_moved = true;
+      if (unconstrained || changed_part) {
+        // In case the move to block 'to' was successful, we verify that the "real" gain
+        // of the move is either equal to our computed gain or if not, still improves
+        // the solution quality.
+        Gain move_delta = _gain.localDelta() - delta_before;
+        bool accept_move = (move_delta == best_move.gain || move_delta <= 0);
+        if (accept_move) {
+          if constexpr (!unconstrained) {
+            // in unconstrained case, we don't want to activate neighbors if the move is undone
+            // by the rebalancing
+            activateNodeAndNeighbors(hypergraph, next_active_nodes, hn, true);
           }
+        } else {
+          // If the real gain is not equal with the computed gain and
+          // worsens the solution quality we revert the move.
+          ASSERT(hypergraph.partID(hn) == to);
+          changeNodePart<unconstrained>(hypergraph, hn, to, from, objective_delta);
         }
       }
     }
@@ -151,6 +164,7 @@ namespace mt_kahypar {
                                                                       Metrics& best_metrics,
                                                                       vec<Move>& rebalance_moves,
                                                                       bool unconstrained_lp) {
+    utils::TraceScope trace(utils::TraceEvent::label_propagation_round);
     Metrics current_metrics = best_metrics;
     _visited_he.reset();
     _next_active.reset();
@@ -231,7 +245,9 @@ namespace mt_kahypar {
     const bool should_update_gain_cache = GainCache::invalidates_entries && _gain_cache.isInitialized();
     const bool should_mark_nodes = unconstrained || should_update_gain_cache;
 
-    if ( _context.refinement.label_propagation.execute_sequential ) {
+    if ( _context.refinement.label_propagation.priority_ordered ) {
+      moveActiveNodesByPriority<unconstrained>(phg, next_active_nodes, objective_delta, should_mark_nodes);
+    } else if ( _context.refinement.label_propagation.execute_sequential ) {
       utils::Randomize::instance().shuffleVector(
               _active_nodes, UL(0), _active_nodes.size(), THREAD_ID);
 
@@ -241,6 +257,29 @@ namespace mt_kahypar {
           if (should_mark_nodes) { _active_node_was_moved[j] = uint8_t(true); }
         }
       }
+    } else if ( parallel::NumaPlacement::instance().isEnabled() ) {
+      // Group the active nodes by the NUMA node owning them and shuffle each group.
+      // Each group is then processed by the threads of the corresponding NUMA node.
+      const parallel::NumaPlacement& numa_placement = parallel::NumaPlacement::instance();
+      const HypernodeID num_nodes = phg.initialNumNodes();
+      auto get_owner = [&](const HypernodeID hn) {
+        return numa_placement.owner(hn, num_nodes);
+      };
+      ActiveNodes grouped_active_nodes(_active_nodes.size());
+      const vec<uint32_t> group_bounds = parallel::counting_sort(_active_nodes, grouped_active_nodes,
+        numa_placement.numNumaNodes(), get_owner, _context.shared_memory.num_threads);
+      _active_nodes.swap(grouped_active_nodes);
+
+      std::vector<size_t> bounds(group_bounds.begin(), group_bounds.begin() + numa_placement.numNumaNodes() + 1);
+      for ( size_t i = 0; i < numa_placement.numNumaNodes(); ++i ) {
+        utils::Randomize::instance().parallelShuffleVector(_active_nodes, bounds[i], bounds[i + 1]);
+      }
+      numa_placement.parallel_for(bounds, [&](const size_t j) {
+        const HypernodeID hn = _active_nodes[j];
+        if ( moveVertex<unconstrained>(phg, hn, next_active_nodes, objective_delta) ) {
+          if (should_mark_nodes) { _active_node_was_moved[j] = uint8_t(true); }
+        }
+      });
     } else {
       utils::Randomize::instance().parallelShuffleVector(
               _active_nodes, UL(0), _active_nodes.size());
@@ -255,6 +294,87 @@ namespace mt_kahypar {
   }
 
 
+  template <typename GraphAndGainTypes>
+  template<bool unconstrained, typename F>
+  void LabelPropagationRefiner<GraphAndGainTypes>::moveActiveNodesByPriority(PartitionedHypergraph& phg,
+                                                                          NextActiveNodes& next_active_nodes,
+                                                                          const F& objective_delta,
+                                                                          const bool should_mark_nodes) {
+    const bool sequential = _context.refinement.label_propagation.execute_sequential;
+    auto for_each = [&](const size_t size, const auto& f) {
+      if ( sequential ) {
+        for ( size_t i = 0; i < size; ++i ) {
+          f(i);
+        }
+      } else {
+        tbb::parallel_for(UL(0), size, f);
+      }
+    };
+
+    // Distribute the active nodes into buckets according to their approximate gain.
+    // Note that the buckets store the index of a node in the active nodes vector.
+    _gain_buckets.clear();
+    _popped_buckets.clear();
+    for_each(_active_nodes.size(), [&](const size_t j) {
+      const HypernodeID hn = _active_nodes[j];
+      if ( phg.isBorderNode(hn) && !phg.isFixed(hn) ) {
+        _gain_buckets.insert(approximateGain<unconstrained>(phg, hn), j);
+      }
+    });
+
+    // Process the buckets in decreasing order of their gain. The gain of a node is
+    // recomputed when it is processed. If it dropped below the current bucket due to
+    // moves of its neighbors, we defer the node to the bucket of its new gain.
+    // Since nodes are only deferred to lower buckets, each node is moved at most once.
+    for ( size_t b = GainBuckets::NUM_BUCKETS; b-- > 0; ) {
+      if ( _gain_buckets.empty(b) ) {
+        continue;
+      }
+      vec<HypernodeID> bucket = _gain_buckets.extract(b, !sequential);
+      if ( sequential ) {
+        utils::Randomize::instance().shuffleVector(bucket, UL(0), bucket.size(), THREAD_ID);
+        _popped_buckets.insert(_popped_buckets.end(), bucket.size(), b);
+      } else {
+        utils::Randomize::instance().parallelShuffleVector(bucket, UL(0), bucket.size());
+      }
+
+      for_each(bucket.size(), [&](const size_t i) {
+        const size_t j = bucket[i];
+        const HypernodeID hn = _active_nodes[j];
+        if ( !phg.isBorderNode(hn) ) {
+          return;
+        }
+        const Move best_move = _gain.computeMaxGainMove(phg, hn, false, false, unconstrained);
+        const size_t current_bucket = GainBuckets::bucketOf(-best_move.gain);
+        if ( current_bucket < b ) {
+          _gain_buckets.insertIntoBucket(current_bucket, j);
+        } else if ( performMove<unconstrained>(phg, hn, best_move, next_active_nodes, objective_delta) ) {
+          if (should_mark_nodes) { _active_node_was_moved[j] = uint8_t(true); }
+        }
+      });
+    }
+    ASSERT(_gain_buckets.size() == 0);
+  }
+
+  template <typename GraphAndGainTypes>
+  template<bool unconstrained>
+  Gain LabelPropagationRefiner<GraphAndGainTypes>::approximateGain(const PartitionedHypergraph& phg,
+                                                                const HypernodeID hn) {
+    // Note that the gain cache uses positive gains for improvements,
+    // whereas the gain computation uses negative gains.
+    if ( _gain_cache.isInitialized() ) {
+      const PartitionID from = phg.partID(hn);
+      Gain max_gain = std::numeric_limits<Gain>::min();
+      for ( PartitionID to = 0; to < _context.partition.k; ++to ) {
+        if ( to != from ) {
+          max_gain = std::max(max_gain, static_cast<Gain>(_gain_cache.gain(hn, from, to)));
+        }
+      }
+      return max_gain;
+    }
+    return -_gain.computeMaxGainMove(phg, hn, false, false, unconstrained).gain;
+  }
+
   template <typename GraphAndGainTypes>
   bool LabelPropagationRefiner<GraphAndGainTypes>::applyRebalancing(PartitionedHypergraph& hypergraph,
                                                                  Metrics& best_metrics,
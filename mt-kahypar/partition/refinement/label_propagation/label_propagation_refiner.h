@@ -29,6 +29,7 @@
 
 #include "kahypar-resources/datastructure/fast_reset_flag_array.h"
 
+#include "mt-kahypar/datastructures/concurrent_gain_buckets.h"
 #include "mt-kahypar/datastructures/streaming_vector.h"
 #include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
@@ -49,6 +50,7 @@ class LabelPropagationRefiner final : public IRefiner {
   using GainCalculator = typename GraphAndGainTypes::GainComputation;
   using ActiveNodes = parallel::scalable_vector<HypernodeID>;
   using NextActiveNodes = ds::StreamingVector<HypernodeID>;
+  using GainBuckets = ds::ConcurrentGainBuckets<HypernodeID>;
 
   static constexpr bool debug = false;
   static constexpr bool enable_heavy_assert = false;
@@ -73,6 +75,8 @@ class LabelPropagationRefiner final : public IRefiner {
     _old_part_is_initialized(_context.refinement.label_propagation.unconstrained ? num_hypernodes : 0),
     _next_active(num_hypernodes),
     _visited_he(Hypergraph::is_graph ? 0 : num_hyperedges),
+    _gain_buckets(),
+    _popped_buckets(),
     _rebalancer(rb) { }
 
   explicit LabelPropagationRefiner(const HypernodeID num_hypernodes,
@@ -89,6 +93,12 @@ class LabelPropagationRefiner final : public IRefiner {
   LabelPropagationRefiner & operator= (const LabelPropagationRefiner &) = delete;
   LabelPropagationRefiner & operator= (LabelPropagationRefiner &&) = delete;
 
+  // ! Only for testing: Gain buckets from which the nodes were popped in the last
+  // ! round of priority-ordered label propagation (only recorded in sequential mode)
+  const vec<size_t>& poppedBuckets() const {
+    return _popped_buckets;
+  }
+
  private:
   bool refineImpl(mt_kahypar_partitioned_hypergraph_t& hypergraph,
                   const parallel::scalable_vector<HypernodeID>& refinement_nodes,
@@ -106,6 +116,15 @@ class LabelPropagationRefiner final : public IRefiner {
   template<bool unconstrained>
   void moveActiveNodes(PartitionedHypergraph& hypergraph, NextActiveNodes& next_active_nodes);
 
+  template<bool unconstrained, typename F>
+  void moveActiveNodesByPriority(PartitionedHypergraph& hypergraph,
+                                 NextActiveNodes& next_active_nodes,
+                                 const F& objective_delta,
+                                 const bool should_mark_nodes);
+
+  template<bool unconstrained>
+  Gain approximateGain(const PartitionedHypergraph& hypergraph, const HypernodeID hn);
+
   bool applyRebalancing(PartitionedHypergraph& hypergraph,
                         Metrics& best_metrics,
                         Metrics& current_metrics,
@@ -120,6 +139,13 @@ class LabelPropagationRefiner final : public IRefiner {
                   NextActiveNodes& next_active_nodes,
                   const F& objective_delta);
 
+  template<bool unconstrained, typename F>
+  bool performMove(PartitionedHypergraph& hypergraph,
+                   const HypernodeID hn,
+                   const Move& best_move,
+                   NextActiveNodes& next_active_nodes,
+                   const F& objective_delta);
+
   void initializeActiveNodes(PartitionedHypergraph& hypergraph,
                              const parallel::scalable_vector<HypernodeID>& refinement_nodes);
 
@@ -209,6 +235,8 @@ class LabelPropagationRefiner final : public IRefiner {
   kahypar::ds::FastResetFlagArray<> _old_part_is_initialized;
   ds::ThreadSafeFastResetFlagArray<> _next_active;
   kahypar::ds::FastResetFlagArray<> _visited_he;
+  GainBuckets _gain_buckets;
+  vec<size_t> _popped_buckets;
   IRebalancer& _rebalancer;
 };
 
@@ -28,6 +28,7 @@
 #include "register_memory_pool.h"
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/level_arena.h"
 #include "mt-kahypar/datastructures/sparse_pin_counts.h"
 #include "mt-kahypar/datastructures/pin_count_in_part.h"
 #include "mt-kahypar/datastructures/connectivity_set.h"
@@ -103,29 +104,29 @@ namespace mt_kahypar {
 
       pool.register_memory_group("Coarsening", 2);
       if ( !context.isNLevelPartitioning() ) {
+        // Contraction buffers are bump-allocated from one level arena (see ds::LevelArena)
+        size_t contraction_buffer_size = 0;
         if (Hypergraph::is_graph) {
-          pool.register_memory_chunk("Coarsening", "mapping", num_hypernodes, sizeof(HypernodeID));
-          pool.register_memory_chunk("Coarsening", "tmp_nodes", num_hypernodes, Hypergraph::SIZE_OF_HYPERNODE);
-          pool.register_memory_chunk("Coarsening", "node_sizes", num_hypernodes, sizeof(HyperedgeID));
-          pool.register_memory_chunk("Coarsening", "tmp_num_incident_edges",
-                                     num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<HyperedgeID>));
-          pool.register_memory_chunk("Coarsening", "node_weights",
-                                     num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<HypernodeWeight>));
-          pool.register_memory_chunk("Coarsening", "tmp_edges", num_hyperedges, Hypergraph::SIZE_OF_HYPEREDGE);
-          pool.register_memory_chunk("Coarsening", "edge_id_mapping", num_hyperedges / 2, sizeof(HyperedgeID));
+          contraction_buffer_size =
+            ds::LevelArena::reservedBytes(num_hypernodes, sizeof(HypernodeID)) +
+            ds::LevelArena::reservedBytes(num_hypernodes, Hypergraph::SIZE_OF_HYPERNODE) +
+            ds::LevelArena::reservedBytes(num_hypernodes, sizeof(HyperedgeID)) +
+            ds::LevelArena::reservedBytes(num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<HyperedgeID>)) +
+            ds::LevelArena::reservedBytes(num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<HypernodeWeight>)) +
+            ds::LevelArena::reservedBytes(num_hyperedges, Hypergraph::SIZE_OF_HYPEREDGE) +
+            ds::LevelArena::reservedBytes(num_hyperedges / 2, sizeof(HyperedgeID));
         } else {
-          pool.register_memory_chunk("Coarsening", "mapping", num_hypernodes, sizeof(size_t));
-          pool.register_memory_chunk("Coarsening", "tmp_hypernodes", num_hypernodes, Hypergraph::SIZE_OF_HYPERNODE);
-          pool.register_memory_chunk("Coarsening", "tmp_incident_nets", num_pins, sizeof(HyperedgeID));
-          pool.register_memory_chunk("Coarsening", "tmp_num_incident_nets",
-                                    num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<size_t>));
-          pool.register_memory_chunk("Coarsening", "hn_weights",
-                                    num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<HypernodeWeight>));
-          pool.register_memory_chunk("Coarsening", "tmp_hyperedges", num_hyperedges, Hypergraph::SIZE_OF_HYPEREDGE);
-          pool.register_memory_chunk("Coarsening", "tmp_incidence_array", num_pins, sizeof(HypernodeID));
-          pool.register_memory_chunk("Coarsening", "he_sizes", num_hyperedges, sizeof(size_t));
-          pool.register_memory_chunk("Coarsening", "valid_hyperedges", num_hyperedges, sizeof(size_t));
+          contraction_buffer_size =
+            ds::LevelArena::reservedBytes(num_hypernodes, sizeof(size_t)) +
+            ds::LevelArena::reservedBytes(num_hypernodes, Hypergraph::SIZE_OF_HYPERNODE) +
+            ds::LevelArena::reservedBytes(num_pins, sizeof(HyperedgeID)) +
+            ds::LevelArena::reservedBytes(num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<size_t>)) +
+            ds::LevelArena::reservedBytes(num_hypernodes, sizeof(parallel::IntegralAtomicWrapper<HypernodeWeight>)) +
+            ds::LevelArena::reservedBytes(num_hyperedges, Hypergraph::SIZE_OF_HYPEREDGE) +
+            ds::LevelArena::reservedBytes(num_pins, sizeof(HypernodeID)) +
+            2 * ds::LevelArena::reservedBytes(num_hyperedges, sizeof(size_t));
         }
+        pool.register_memory_chunk("Coarsening", "contraction_buffer", contraction_buffer_size, sizeof(char));
       }
 
       // ########## Refinement Memory ##########
@@ -143,7 +144,8 @@ namespace mt_kahypar {
         }
       } else {
         const HypernodeID max_he_size = hypergraph.maxEdgeSize();
-        if ( context.partition.preset_type == PresetType::large_k ) {
+        if ( context.partition.preset_type == PresetType::large_k ||
+             context.partition.use_sparse_connectivity ) {
           pool.register_memory_chunk("Refinement", "pin_count_in_part",
                                     ds::SparsePinCounts::num_elements(num_hyperedges, context.partition.k, max_he_size),
                                     sizeof(ds::SparsePinCounts::Value));
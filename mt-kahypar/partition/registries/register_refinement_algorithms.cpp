@@ -37,6 +37,7 @@
 #include "mt-kahypar/partition/refinement/do_nothing_refiner.h"
 #include "mt-kahypar/partition/refinement/label_propagation/label_propagation_refiner.h"
 #include "mt-kahypar/partition/refinement/deterministic/deterministic_label_propagation.h"
+#include "mt-kahypar/partition/refinement/deterministic/deterministic_fm.h"
 #include "mt-kahypar/partition/refinement/fm/multitry_kway_fm.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/gain_cache_strategy.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/unconstrained_strategy.h"
@@ -66,6 +67,11 @@ using DefaultFMDispatcher = kahypar::meta::StaticMultiDispatchFactory<
 
 using UnconstrainedFMDispatcher = DefaultFMDispatcher;
 
+using DeterministicFMDispatcher = kahypar::meta::StaticMultiDispatchFactory<
+                                  DeterministicFMRefiner,
+                                  IRefiner,
+                                  kahypar::meta::Typelist<GraphAndGainTypesList>>;
+
 using GainCacheFMStrategyDispatcher = kahypar::meta::StaticMultiDispatchFactory<
                                       GainCacheStrategy,
                                       IFMStrategy,
@@ -227,6 +233,9 @@ void register_refinement_algorithms() {
   REGISTER_DISPATCHED_FM_REFINER(FMAlgorithm::unconstrained_fm,
                                 UnconstrainedFMDispatcher,
                                 getGraphAndGainTypesPolicy(context.partition.partition_type, context.partition.gain_policy));
+  REGISTER_DISPATCHED_FM_REFINER(FMAlgorithm::deterministic,
+                                DeterministicFMDispatcher,
+                                getGraphAndGainTypesPolicy(context.partition.partition_type, context.partition.gain_policy));
   REGISTER_FM_REFINER(FMAlgorithm::do_nothing, DoNothingRefiner, 3);
 
   REGISTER_DISPATCHED_FM_STRATEGY(FMAlgorithm::kway_fm,
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/time_budget.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar {
+
+namespace {
+  static constexpr bool debug = false;
+}
+
+void adapt_initial_partitioning_to_time_limit(Context& context) {
+  if ( context.isTimeLimitExceeded() ) {
+    // Only one cheap run, such that we obtain a valid partition as fast as possible
+    context.initial_partitioning.runs = 1;
+    context.initial_partitioning.min_adaptive_ip_runs = 1;
+    context.initial_partitioning.perform_refinement_on_best_partitions = false;
+    return;
+  } else if ( !context.hasTimeLimit() ) {
+    return;
+  }
+
+  const double remaining_fraction = context.remainingTime() / context.partition.time_limit;
+  const size_t runs = std::max(UL(1), static_cast<size_t>(
+    std::ceil(remaining_fraction * context.initial_partitioning.runs)));
+  DBG << "Remaining time =" << context.remainingTime() << "s"
+      << ", initial partitioning runs =" << runs
+      << "( before:" << context.initial_partitioning.runs << ")";
+  if ( runs < context.initial_partitioning.runs ) {
+    context.initial_partitioning.runs = runs;
+    context.initial_partitioning.min_adaptive_ip_runs =
+      std::min(context.initial_partitioning.min_adaptive_ip_runs, runs);
+  }
+}
+
+double refinement_time_limit_for_level(const Context& context,
+                                       const double time_limit,
+                                       const size_t num_remaining_levels) {
+  if ( !context.hasTimeLimit() ) {
+    return time_limit;
+  }
+  // Note that FM switches to a light-weight configuration once it reaches its time limit
+  // and aborts after twice the time limit. Thus, we only pass half of the available time.
+  const double level_time = context.remainingTime() / std::max(num_remaining_levels, UL(1));
+  return std::min(time_limit, 0.5 * level_time);
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Adapts the effort of the next phase to the remaining time budget (--time-limit).
+ * The time budget is started via Context::startTimeBudget() at the beginning of
+ * each partitioning call. All functions do nothing if no time limit is set and
+ * the partitioning call was not cancelled (see Context::cancel()).
+ */
+
+// ! Reduces the number of initial partitioning runs proportionally
+// ! to the fraction of the time budget that is still available
+void adapt_initial_partitioning_to_time_limit(Context& context);
+
+// ! Returns the time limit for the refinement of the current level, such that
+// ! the remaining time is distributed evenly over the remaining levels
+double refinement_time_limit_for_level(const Context& context,
+                                       const double time_limit,
+                                       const size_t num_remaining_levels);
+
+}  // namespace mt_kahypar
@@ -54,6 +54,10 @@ class MemoryTreeNode {
 
   void finalize();
 
+  size_t size() const {
+    return _size_in_bytes;
+  }
+
  private:
 
   void dfs(std::ostream& str, const size_t parent_size_in_bytes, int level) const ;
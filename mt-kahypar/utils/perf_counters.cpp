@@ -0,0 +1,243 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/utils/perf_counters.h"
+
+#include <atomic>
+#include <functional>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar::utils {
+
+  namespace {
+    #ifdef __linux__
+    struct CounterConfig {
+      uint32_t type;
+      uint64_t config;
+    };
+
+    constexpr std::array<CounterConfig, NUM_PERF_COUNTERS> COUNTER_CONFIGS = {
+      CounterConfig { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+      CounterConfig { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+      CounterConfig { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                                          (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+      CounterConfig { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+      CounterConfig { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES }
+    };
+
+    int openCounter(const CounterConfig& config, const int group_fd) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(perf_event_attr));
+      attr.size = sizeof(perf_event_attr);
+      attr.type = config.type;
+      attr.config = config.config;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP |
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      // pid = 0 and cpu = -1 counts the calling thread on any CPU
+      return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+    #endif
+
+    // Generation of the perf counters the calling thread is registered for
+    thread_local size_t registered_generation = 0;
+    std::atomic<size_t> current_generation(0);
+  }
+
+  struct PerfCounters::ThreadCounters {
+    ThreadCounters() :
+      group_fd(-1),
+      fds(),
+      position() {
+      fds.fill(-1);
+      position.fill(-1);
+    }
+
+    ~ThreadCounters() {
+      #ifdef __linux__
+      for ( const int fd : fds ) {
+        if ( fd != -1 ) {
+          close(fd);
+        }
+      }
+      #endif
+    }
+
+    PerfCounterValues read() const {
+      PerfCounterValues result;
+      #ifdef __linux__
+      // Layout: nr, time_enabled, time_running, values[nr]
+      std::array<uint64_t, 3 + NUM_PERF_COUNTERS> buffer = { };
+      if ( group_fd != -1 && ::read(group_fd, buffer.data(), sizeof(buffer)) > 0 ) {
+        const uint64_t time_enabled = buffer[1];
+        const uint64_t time_running = buffer[2];
+        // If the PMU is overcommitted, the counters are multiplexed and we scale them
+        const double scaling = time_running > 0 && time_running < time_enabled ?
+          static_cast<double>(time_enabled) / time_running : 1.0;
+        for ( size_t i = 0; i < NUM_PERF_COUNTERS; ++i ) {
+          if ( position[i] != -1 && static_cast<uint64_t>(position[i]) < buffer[0] ) {
+            result.values[i] = static_cast<uint64_t>(scaling * buffer[3 + position[i]]);
+          }
+        }
+      }
+      #endif
+      return result;
+    }
+
+    int group_fd;
+    std::array<int, NUM_PERF_COUNTERS> fds;
+    // Position of each counter in the group (-1, if not available)
+    std::array<int, NUM_PERF_COUNTERS> position;
+  };
+
+  namespace {
+    class PerfCounterObserver : public tbb::task_scheduler_observer {
+     public:
+      explicit PerfCounterObserver(std::function<void()> on_entry) :
+        tbb::task_scheduler_observer(),
+        _on_entry(std::move(on_entry)) {
+        observe(true);
+      }
+
+      ~PerfCounterObserver() {
+        observe(false);
+      }
+
+      void on_scheduler_entry(bool) override {
+        _on_entry();
+      }
+
+     private:
+      std::function<void()> _on_entry;
+    };
+  }
+
+  PerfCounters::PerfCounters() :
+    _is_enabled(false),
+    _mutex(),
+    _threads(),
+    _observer(nullptr) { }
+
+  PerfCounters::~PerfCounters() {
+    disable();
+  }
+
+  bool PerfCounters::enable() {
+    #ifdef __linux__
+    if ( _is_enabled ) {
+      return true;
+    }
+    ++current_generation;
+    registerCurrentThread();
+    if ( _threads.empty() ) {
+      // Opening the counters failed (e.g., perf_event_paranoid or missing perf access)
+      return false;
+    }
+    _is_enabled = true;
+    _observer = std::make_unique<PerfCounterObserver>([&] { registerCurrentThread(); });
+    return true;
+    #else
+    return false;
+    #endif
+  }
+
+  void PerfCounters::disable() {
+    _observer.reset();
+    std::lock_guard<std::mutex> lock(_mutex);
+    _threads.clear();
+    _is_enabled = false;
+  }
+
+  PerfCounterValues PerfCounters::read() const {
+    PerfCounterValues result;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for ( const auto& thread : _threads ) {
+      result += thread->read();
+    }
+    return result;
+  }
+
+  std::vector<PerfCounterValues> PerfCounters::readPerThread() const {
+    std::vector<PerfCounterValues> result;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for ( const auto& thread : _threads ) {
+      result.push_back(thread->read());
+    }
+    return result;
+  }
+
+  const char* PerfCounters::name(const PerfCounter counter) {
+    switch ( counter ) {
+      case PerfCounter::cycles: return "cycles";
+      case PerfCounter::instructions: return "instructions";
+      case PerfCounter::l1d_misses: return "l1d_misses";
+      case PerfCounter::llc_misses: return "llc_misses";
+      case PerfCounter::branch_misses: return "branch_misses";
+      case PerfCounter::NUM_COUNTERS: break;
+    }
+    return "UNDEFINED";
+  }
+
+  void PerfCounters::registerCurrentThread() {
+    #ifdef __linux__
+    const size_t generation = current_generation.load(std::memory_order_relaxed);
+    if ( registered_generation == generation ) {
+      return;
+    }
+    registered_generation = generation;
+
+    auto counters = std::make_unique<ThreadCounters>();
+    int num_opened = 0;
+    for ( size_t i = 0; i < NUM_PERF_COUNTERS; ++i ) {
+      const int fd = openCounter(COUNTER_CONFIGS[i], counters->group_fd);
+      if ( fd == -1 ) {
+        if ( counters->group_fd == -1 ) {
+          // Without cycles, we do not count anything
+          return;
+        }
+        continue;
+      }
+      if ( counters->group_fd == -1 ) {
+        counters->group_fd = fd;
+      }
+      counters->fds[i] = fd;
+      counters->position[i] = num_opened++;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _threads.push_back(std::move(counters));
+    #endif
+  }
+
+} // namespace mt_kahypar::utils
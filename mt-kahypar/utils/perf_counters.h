@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <tbb/task_scheduler_observer.h>
+
+namespace mt_kahypar {
+namespace utils {
+
+enum class PerfCounter : uint8_t {
+  cycles,
+  instructions,
+  l1d_misses,
+  llc_misses,
+  branch_misses,
+  NUM_COUNTERS
+};
+
+static constexpr size_t NUM_PERF_COUNTERS = static_cast<size_t>(PerfCounter::NUM_COUNTERS);
+
+struct PerfCounterValues {
+  std::array<uint64_t, NUM_PERF_COUNTERS> values = { };
+
+  uint64_t operator[] (const PerfCounter counter) const {
+    return values[static_cast<size_t>(counter)];
+  }
+
+  PerfCounterValues& operator+= (const PerfCounterValues& other) {
+    for ( size_t i = 0; i < NUM_PERF_COUNTERS; ++i ) {
+      values[i] += other.values[i];
+    }
+    return *this;
+  }
+
+  PerfCounterValues operator- (const PerfCounterValues& other) const {
+    PerfCounterValues result;
+    for ( size_t i = 0; i < NUM_PERF_COUNTERS; ++i ) {
+      result.values[i] = values[i] >= other.values[i] ? values[i] - other.values[i] : 0;
+    }
+    return result;
+  }
+
+  double ipc() const {
+    const uint64_t num_cycles = (*this)[PerfCounter::cycles];
+    return num_cycles > 0 ? static_cast<double>((*this)[PerfCounter::instructions]) / num_cycles : 0.0;
+  }
+};
+
+/*!
+ * Hardware performance counters based on perf_event_open (Linux only).
+ * Once enabled, each thread that enters the TBB scheduler opens its own group
+ * of counters (cycles, instructions, L1d misses, LLC misses, branch misses),
+ * which counts the user-space events of that thread. read() sums up the
+ * counters of all registered threads, which allows to attribute events to the
+ * phases of the (sequential) timer hierarchy, including the work done by TBB
+ * worker threads.
+ *
+ * If perf events are not available (e.g., no perf access in containers or
+ * on non-Linux systems), enable() returns false and all operations are no-ops.
+ */
+class PerfCounters {
+
+  struct ThreadCounters;
+
+ public:
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters & operator= (const PerfCounters &) = delete;
+
+  PerfCounters(PerfCounters&&) = delete;
+  PerfCounters & operator= (PerfCounters &&) = delete;
+
+  ~PerfCounters();
+
+  static PerfCounters& instance() {
+    static PerfCounters instance;
+    return instance;
+  }
+
+  bool isEnabled() const {
+    return _is_enabled;
+  }
+
+  // ! Opens the counters for the calling thread and starts observing TBB threads.
+  // ! Returns false, if hardware counters are not available.
+  bool enable();
+
+  // ! Stops observing TBB threads and closes all counters
+  void disable();
+
+  // ! Sum of the counters of all registered threads
+  PerfCounterValues read() const;
+
+  // ! Counters of each registered thread
+  std::vector<PerfCounterValues> readPerThread() const;
+
+  static const char* name(const PerfCounter counter);
+
+ private:
+  PerfCounters();
+
+  void registerCurrentThread();
+
+  bool _is_enabled;
+  mutable std::mutex _mutex;
+  std::vector<std::unique_ptr<ThreadCounters>> _threads;
+  std::unique_ptr<tbb::task_scheduler_observer> _observer;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
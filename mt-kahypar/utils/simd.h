@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MT_KAHYPAR_HAS_X86_SIMD_DISPATCH 1
+#include <immintrin.h>
+#else
+#define MT_KAHYPAR_HAS_X86_SIMD_DISPATCH 0
+#endif
+
+namespace mt_kahypar::utils {
+
+enum class SIMDInstructionSet : uint8_t {
+  scalar,
+  avx2,
+  avx512
+};
+
+inline const char* simdInstructionSetName(const SIMDInstructionSet instruction_set) {
+  switch ( instruction_set ) {
+    case SIMDInstructionSet::avx512: return "avx512";
+    case SIMDInstructionSet::avx2: return "avx2";
+    case SIMDInstructionSet::scalar: return "scalar";
+  }
+  return "scalar";
+}
+
+// ! Returns the widest instruction set supported by the CPU we are running on
+inline SIMDInstructionSet detectSIMDInstructionSet() {
+  #if MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("avx512f") ) {
+    return SIMDInstructionSet::avx512;
+  } else if ( __builtin_cpu_supports("avx2") ) {
+    return SIMDInstructionSet::avx2;
+  }
+  #endif
+  return SIMDInstructionSet::scalar;
+}
+
+namespace simd {
+
+inline SIMDInstructionSet& instructionSetSlot() {
+  static SIMDInstructionSet instruction_set = detectSIMDInstructionSet();
+  return instruction_set;
+}
+
+// ! Instruction set used by the kernels in this file (detected once at runtime)
+inline SIMDInstructionSet instructionSet() {
+  return instructionSetSlot();
+}
+
+// ! Overrides the detected instruction set (e.g., to compare kernels in benchmarks).
+// ! Requesting an instruction set that is not supported by the CPU falls back to scalar code.
+// ! Note, this function is not thread-safe.
+inline void setInstructionSet(const SIMDInstructionSet instruction_set) {
+  const SIMDInstructionSet supported = detectSIMDInstructionSet();
+  instructionSetSlot() = static_cast<uint8_t>(instruction_set) <= static_cast<uint8_t>(supported) ?
+    instruction_set : SIMDInstructionSet::scalar;
+}
+
+template<typename T>
+inline void gather_scalar(const T* indices, const size_t n, const T* table, T* out) {
+  for ( size_t i = 0; i < n; ++i ) {
+    out[i] = table[indices[i]];
+  }
+}
+
+#if MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+__attribute__((target("avx2")))
+inline void gather_avx2(const uint32_t* indices, const size_t n, const uint32_t* table, uint32_t* out) {
+  size_t i = 0;
+  for ( ; i + 8 <= n; i += 8 ) {
+    const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+    const __m256i values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), idx, 4);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+  }
+  gather_scalar(indices + i, n - i, table, out + i);
+}
+
+__attribute__((target("avx512f")))
+inline void gather_avx512(const uint32_t* indices, const size_t n, const uint32_t* table, uint32_t* out) {
+  size_t i = 0;
+  for ( ; i + 16 <= n; i += 16 ) {
+    const __m512i idx = _mm512_loadu_si512(reinterpret_cast<const void*>(indices + i));
+    const __m512i values = _mm512_i32gather_epi32(idx, reinterpret_cast<const void*>(table), 4);
+    _mm512_storeu_si512(reinterpret_cast<void*>(out + i), values);
+  }
+  gather_scalar(indices + i, n - i, table, out + i);
+}
+#endif
+
+/*!
+ * Computes out[i] = table[indices[i]] for all i < n. For 32-bit IDs, the
+ * gather is executed with AVX2 or AVX-512 instructions if supported by the CPU.
+ * The vector gather instructions interpret indices as signed 32-bit integers,
+ * which is why table_size must be smaller than 2^31 to use them.
+ */
+template<typename T>
+inline void gather(const T* indices, const size_t n, const T* table, const size_t table_size, T* out) {
+  #if MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+  if constexpr ( sizeof(T) == sizeof(uint32_t) ) {
+    if ( table_size <= static_cast<size_t>(std::numeric_limits<int32_t>::max()) ) {
+      const uint32_t* idx = reinterpret_cast<const uint32_t*>(indices);
+      const uint32_t* tbl = reinterpret_cast<const uint32_t*>(table);
+      uint32_t* res = reinterpret_cast<uint32_t*>(out);
+      switch ( instructionSet() ) {
+        case SIMDInstructionSet::avx512: gather_avx512(idx, n, tbl, res); return;
+        case SIMDInstructionSet::avx2: gather_avx2(idx, n, tbl, res); return;
+        case SIMDInstructionSet::scalar: break;
+      }
+    }
+  }
+  #endif
+  (void) table_size;
+  gather_scalar(indices, n, table, out);
+}
+
+} // namespace simd
+} // namespace mt_kahypar::utils
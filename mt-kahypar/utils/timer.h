@@ -36,6 +36,8 @@
 #include <tbb/enumerable_thread_specific.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/memory_accounting.h"
+#include "mt-kahypar/utils/perf_counters.h"
 
 namespace mt_kahypar {
 namespace utils {
@@ -74,14 +76,31 @@ class Timer {
     ActiveTiming() :
       _key(""),
       _description(""),
-      _start() { }
+      _start(),
+      _has_counters(false),
+      _counters(),
+      _peak_memory_tracker(parallel::MemoryAccounting::kNoPeakTracker) { }
 
     ActiveTiming(const std::string& key,
                  const std::string& description,
                  const HighResClockTimepoint& start) :
       _key(key),
       _description(description),
-      _start(start) { }
+      _start(start),
+      _has_counters(false),
+      _counters(),
+      _peak_memory_tracker(parallel::MemoryAccounting::kNoPeakTracker) { }
+
+    ActiveTiming(const std::string& key,
+                 const std::string& description,
+                 const HighResClockTimepoint& start,
+                 const PerfCounterValues& counters) :
+      _key(key),
+      _description(description),
+      _start(start),
+      _has_counters(true),
+      _counters(counters),
+      _peak_memory_tracker(parallel::MemoryAccounting::kNoPeakTracker) { }
 
     std::string key() const {
       return _key;
@@ -95,10 +114,35 @@ class Timer {
       return _start;
     }
 
+    bool hasCounters() const {
+      return _has_counters;
+    }
+
+    const PerfCounterValues& counters() const {
+      return _counters;
+    }
+
+    bool tracksPeakMemory() const {
+      return _peak_memory_tracker != parallel::MemoryAccounting::kNoPeakTracker;
+    }
+
+    size_t peakMemoryTracker() const {
+      return _peak_memory_tracker;
+    }
+
+    void setPeakMemoryTracker(const size_t tracker) {
+      _peak_memory_tracker = tracker;
+    }
+
    private:
     std::string _key;
     std::string _description;
     HighResClockTimepoint _start;
+    // Hardware counters at the start of the timing (only for sequential timings)
+    bool _has_counters;
+    PerfCounterValues _counters;
+    // Tracks the high-water mark of the memory usage (only for sequential timings)
+    size_t _peak_memory_tracker;
   };
 
   class Timing {
@@ -111,7 +155,11 @@ class Timer {
       _description(description),
       _parent(parent),
       _order(order),
-      _timing(0.0) { }
+      _timing(0.0),
+      _has_counters(false),
+      _counters(),
+      _has_peak_memory(false),
+      _peak_memory(0) { }
 
     std::string key() const {
       return _key;
@@ -141,12 +189,43 @@ class Timer {
       _timing += timing;
     }
 
+    bool has_counters() const {
+      return _has_counters;
+    }
+
+    const PerfCounterValues& counters() const {
+      return _counters;
+    }
+
+    void add_counters(const PerfCounterValues& counters) {
+      _has_counters = true;
+      _counters += counters;
+    }
+
+    bool has_peak_memory() const {
+      return _has_peak_memory;
+    }
+
+    size_t peak_memory() const {
+      return _peak_memory;
+    }
+
+    void add_peak_memory(const size_t peak_memory) {
+      _has_peak_memory = true;
+      _peak_memory = std::max(_peak_memory, peak_memory);
+    }
+
    private:
     std::string _key;
     std::string _description;
     std::string _parent;
     int _order;
     double _timing;
+    bool _has_counters;
+    PerfCounterValues _counters;
+    // High-water mark of the memory usage (only for sequential timings)
+    bool _has_peak_memory;
+    size_t _peak_memory;
   };
 
   using ActiveTimingStack = std::vector<ActiveTiming>;
@@ -212,6 +291,11 @@ class Timer {
   void clear() {
     std::lock_guard<std::mutex> lock(_timing_mutex);
     _timings.clear();
+    for (const ActiveTiming& timing : _active_timings) {
+      if (timing.tracksPeakMemory()) {
+        parallel::MemoryAccounting::instance().stopPeakTracking(timing.peakMemoryTracker());
+      }
+    }
     _active_timings.clear();
     _index = 0;
   }
@@ -224,9 +308,20 @@ class Timer {
       std::lock_guard<std::mutex> lock(_timing_mutex);
       if (force || is_parallel_context) {
         _local_active_timings.local().emplace_back(key, description, std::chrono::high_resolution_clock::now());
+        return;
+      }
+
+      if (PerfCounters::instance().isEnabled()) {
+        // Hardware counters are summed up over all threads, which is
+        // only meaningful for timings in a sequential context
+        _active_timings.emplace_back(key, description,
+          std::chrono::high_resolution_clock::now(), PerfCounters::instance().read());
       } else {
         _active_timings.emplace_back(key, description, std::chrono::high_resolution_clock::now());
       }
+      // Each sequential timing tracks the high-water mark of the memory usage
+      _active_timings.back().setPeakMemoryTracker(
+        parallel::MemoryAccounting::instance().startPeakTracking());
     }
   }
 
@@ -273,6 +368,14 @@ class Timer {
       }
       double time = std::chrono::duration<double>(end - current_timing.start()).count();
       _timings.at(timing_key).add_timing(time);
+      if (current_timing.hasCounters() && PerfCounters::instance().isEnabled()) {
+        _timings.at(timing_key).add_counters(
+          PerfCounters::instance().read() - current_timing.counters());
+      }
+      if (current_timing.tracksPeakMemory()) {
+        _timings.at(timing_key).add_peak_memory(
+          parallel::MemoryAccounting::instance().stopPeakTracking(current_timing.peakMemoryTracker()));
+      }
     }
   }
 
@@ -315,6 +418,14 @@ class Timer {
 
   friend std::ostream & operator<< (std::ostream& str, const Timer& timer);
 
+  // ! Prints the hardware performance counters of all timings
+  // ! that were measured in a sequential context
+  void printPerfCounters(std::ostream& str) const;
+
+  // ! Prints the high-water mark of the memory usage of all timings
+  // ! that were measured in a sequential context
+  void printPeakMemory(std::ostream& str) const;
+
   double get(std::string key) const {
     for (const auto& x : _timings) {
       // unfortunately it has to be linear search because the parent (which we can't lookup at this stage) is part of the map key
@@ -394,5 +505,101 @@ inline std::ostream & operator<< (std::ostream& str, const Timer& timer) {
   return str;
 }
 
+inline void Timer::printPerfCounters(std::ostream& str) const {
+  std::vector<Timing> timings;
+  for (const auto& timing : _timings) {
+    timings.emplace_back(timing.second);
+  }
+  std::sort(timings.begin(), timings.end(),
+            [&](const Timing& lhs, const Timing& rhs) {
+        return lhs.order() < rhs.order();
+      });
+
+  auto print = [&](const Timing& timing, int level) {
+                 if (!timing.has_counters()) {
+                   return;
+                 }
+                 const PerfCounterValues& counters = timing.counters();
+                 std::string prefix = std::string(TOP_LEVEL_PREFIX, TOP_LEVEL_PREFIX_LENGTH);
+                 prefix += std::string(SUB_LEVEL_PREFIX_LENGTH * level, ' ');
+                 size_t length = prefix.size() + timing.description().size();
+                 str << prefix << timing.description();
+                 if (length < MAX_LINE_LENGTH) {
+                   str << std::string(MAX_LINE_LENGTH - length, ' ');
+                 }
+                 str << " IPC = " << counters.ipc()
+                     << ", " << PerfCounters::name(PerfCounter::instructions) << " = " << counters[PerfCounter::instructions]
+                     << ", " << PerfCounters::name(PerfCounter::l1d_misses) << " = " << counters[PerfCounter::l1d_misses]
+                     << ", " << PerfCounters::name(PerfCounter::llc_misses) << " = " << counters[PerfCounter::llc_misses]
+                     << ", " << PerfCounters::name(PerfCounter::branch_misses) << " = " << counters[PerfCounter::branch_misses]
+                     << "\n";
+               };
+
+  std::function<void(const Timing&, int)> dfs = [&](const Timing& parent, int level) {
+    if ( static_cast<size_t>(level) <= _max_output_depth ) {
+      for (const Timing& timing : timings) {
+        if (timing.parent() == parent.key()) {
+          print(timing, level);
+          dfs(timing, level + 1);
+        }
+      }
+    }
+  };
+
+  for (const Timing& timing : timings) {
+    if (timing.is_root()) {
+      print(timing, 0);
+      if (_show_detailed_timings) {
+        dfs(timing, 1);
+      }
+    }
+  }
+}
+
+inline void Timer::printPeakMemory(std::ostream& str) const {
+  std::vector<Timing> timings;
+  for (const auto& timing : _timings) {
+    timings.emplace_back(timing.second);
+  }
+  std::sort(timings.begin(), timings.end(),
+            [&](const Timing& lhs, const Timing& rhs) {
+        return lhs.order() < rhs.order();
+      });
+
+  auto print = [&](const Timing& timing, int level) {
+                 if (!timing.has_peak_memory()) {
+                   return;
+                 }
+                 std::string prefix = std::string(TOP_LEVEL_PREFIX, TOP_LEVEL_PREFIX_LENGTH);
+                 prefix += std::string(SUB_LEVEL_PREFIX_LENGTH * level, ' ');
+                 size_t length = prefix.size() + timing.description().size();
+                 str << prefix << timing.description();
+                 if (length < MAX_LINE_LENGTH) {
+                   str << std::string(MAX_LINE_LENGTH - length, ' ');
+                 }
+                 str << " = " << static_cast<double>(timing.peak_memory()) / 1000000.0 << " MB\n";
+               };
+
+  std::function<void(const Timing&, int)> dfs = [&](const Timing& parent, int level) {
+    if ( static_cast<size_t>(level) <= _max_output_depth ) {
+      for (const Timing& timing : timings) {
+        if (timing.parent() == parent.key()) {
+          print(timing, level);
+          dfs(timing, level + 1);
+        }
+      }
+    }
+  };
+
+  for (const Timing& timing : timings) {
+    if (timing.is_root()) {
+      print(timing, 0);
+      if (_show_detailed_timings) {
+        dfs(timing, 1);
+      }
+    }
+  }
+}
+
 }  // namespace utils
 }  // namespace mt_kahypar
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/utils/tracer.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar::utils {
+
+  size_t Tracer::numDroppedEvents() const {
+    size_t num_dropped = 0;
+    for ( const ThreadBuffer& buffer : _buffers ) {
+      if ( buffer.num_recorded > buffer.records.size() ) {
+        num_dropped += buffer.num_recorded - buffer.records.size();
+      }
+    }
+    return num_dropped;
+  }
+
+  void Tracer::writeChromeTrace(const std::string& filename) const {
+    std::ofstream out(filename);
+    if ( !out ) {
+      throw InvalidInputException("Could not open trace file: " + filename);
+    }
+
+    // Timestamps and durations are given in microseconds
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&] {
+      if ( !first ) {
+        out << ",";
+      }
+      first = false;
+      out << "\n";
+    };
+
+    for ( const ThreadBuffer& buffer : _buffers ) {
+      separator();
+      out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer.thread_id
+          << ",\"args\":{\"name\":\"Thread " << buffer.thread_id << "\"}}";
+
+      // Events are written from oldest to newest
+      const size_t num_events = std::min(buffer.num_recorded, buffer.records.size());
+      const size_t first_event = buffer.num_recorded - num_events;
+      for ( size_t i = first_event; i < buffer.num_recorded; ++i ) {
+        const Record& record = buffer.records[i & (buffer.records.size() - 1)];
+        ASSERT(record.event != TraceEvent::NUM_EVENTS);
+        separator();
+        out << "{\"name\":\"" << traceEventName(record.event) << "\",\"ph\":\"X\",\"pid\":0"
+            << ",\"tid\":" << buffer.thread_id
+            << ",\"ts\":" << static_cast<double>(record.start_ns) / 1000.0
+            << ",\"dur\":" << static_cast<double>(record.duration_ns) / 1000.0 << "}";
+      }
+    }
+    out << "\n],\"otherData\":{\"dropped_events\":" << numDroppedEvents() << "}}\n";
+  }
+
+} // namespace mt_kahypar::utils
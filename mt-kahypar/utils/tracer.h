@@ -0,0 +1,260 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar {
+namespace utils {
+
+// ! Events that can be recorded by the tracer. The name of an event is
+// ! resolved via a constexpr lookup table, i.e., recording an event never
+// ! touches a string.
+enum class TraceEvent : uint8_t {
+  coarsening_pass,
+  label_propagation_round,
+  fm_round,
+  fm_localized_search,
+  fm_pq_update,
+  flow_region_growing,
+  flow_problem,
+  NUM_EVENTS
+};
+
+constexpr std::array<const char*, static_cast<size_t>(TraceEvent::NUM_EVENTS)> TRACE_EVENT_NAMES = {
+  "coarsening_pass",
+  "label_propagation_round",
+  "fm_round",
+  "fm_localized_search",
+  "fm_pq_update",
+  "flow_region_growing",
+  "flow_problem"
+};
+
+constexpr const char* traceEventName(const TraceEvent event) {
+  return TRACE_EVENT_NAMES[static_cast<size_t>(event)];
+}
+
+// ! Events of a finer level are only recorded if the tracer is enabled with
+// ! that level. Fine events occur per move and would otherwise overwrite
+// ! all other events in the ring buffers.
+enum class TraceLevel : uint8_t {
+  disabled = 0,
+  coarse = 1,
+  fine = 2
+};
+
+constexpr std::array<TraceLevel, static_cast<size_t>(TraceEvent::NUM_EVENTS)> TRACE_EVENT_LEVELS = {
+  TraceLevel::coarse, // coarsening_pass
+  TraceLevel::coarse, // label_propagation_round
+  TraceLevel::coarse, // fm_round
+  TraceLevel::coarse, // fm_localized_search
+  TraceLevel::fine,   // fm_pq_update
+  TraceLevel::coarse, // flow_region_growing
+  TraceLevel::coarse  // flow_problem
+};
+
+constexpr TraceLevel traceEventLevel(const TraceEvent event) {
+  return TRACE_EVENT_LEVELS[static_cast<size_t>(event)];
+}
+
+/*!
+ * Low-overhead event tracer. Each thread records its events into its own
+ * ring buffer, so recording requires neither locks nor atomic read-modify-write
+ * operations. If the buffer of a thread is full, its oldest events are
+ * overwritten. The recorded events can be exported in the Chrome trace
+ * event format (readable by chrome://tracing and Perfetto), which shows
+ * what each thread is doing and when it is idle.
+ *
+ * If tracing is disabled, recording an event costs a single relaxed load.
+ * The tracer must not be enabled, cleared or exported while events are recorded.
+ */
+class Tracer {
+
+  using Clock = std::chrono::steady_clock;
+
+  struct Record {
+    uint64_t start_ns;
+    uint64_t duration_ns;
+    TraceEvent event;
+  };
+
+  struct ThreadBuffer {
+    ThreadBuffer() :
+      thread_id(0),
+      num_recorded(0),
+      records() { }
+
+    uint32_t thread_id;
+    // ! Total number of recorded events (can be larger than the buffer size)
+    size_t num_recorded;
+    std::vector<Record> records;
+  };
+
+ public:
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 1UL << 18;
+
+  Tracer(const Tracer&) = delete;
+  Tracer & operator= (const Tracer &) = delete;
+
+  Tracer(Tracer&&) = delete;
+  Tracer & operator= (Tracer &&) = delete;
+
+  static Tracer& instance() {
+    static Tracer instance;
+    return instance;
+  }
+
+  bool isEnabled() const {
+    return _level.load(std::memory_order_relaxed) != TraceLevel::disabled;
+  }
+
+  // ! Returns whether or not events of the given type are recorded
+  bool isEnabled(const TraceEvent event) const {
+    return static_cast<uint8_t>(_level.load(std::memory_order_relaxed)) >=
+      static_cast<uint8_t>(traceEventLevel(event));
+  }
+
+  // ! Enables tracing of all events up to the given level. The buffer size is
+  // ! the number of events per thread and is rounded up to the next power of two.
+  void enable(const size_t buffer_size = DEFAULT_BUFFER_SIZE,
+              const TraceLevel level = TraceLevel::coarse) {
+    ASSERT(level != TraceLevel::disabled);
+    size_t size = 1;
+    while ( size < buffer_size ) {
+      size <<= 1;
+    }
+    _buffer_mask = size - 1;
+    _epoch = Clock::now();
+    _level.store(level, std::memory_order_relaxed);
+  }
+
+  void disable() {
+    _level.store(TraceLevel::disabled, std::memory_order_relaxed);
+  }
+
+  void clear() {
+    for ( ThreadBuffer& buffer : _buffers ) {
+      buffer.num_recorded = 0;
+    }
+  }
+
+  Clock::time_point now() const {
+    return Clock::now();
+  }
+
+  void record(const TraceEvent event,
+              const Clock::time_point& start,
+              const Clock::time_point& end) {
+    ThreadBuffer& buffer = localBuffer();
+    Record& entry = buffer.records[buffer.num_recorded & _buffer_mask];
+    entry.start_ns = nanosecondsSinceEpoch(start);
+    entry.duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    entry.event = event;
+    ++buffer.num_recorded;
+  }
+
+  // ! Number of events that were overwritten since they did not fit into
+  // ! the ring buffer of their thread
+  size_t numDroppedEvents() const;
+
+  // ! Writes all recorded events in the Chrome trace event format
+  void writeChromeTrace(const std::string& filename) const;
+
+ private:
+  explicit Tracer() :
+    _level(TraceLevel::disabled),
+    _buffer_mask(DEFAULT_BUFFER_SIZE - 1),
+    _epoch(Clock::now()),
+    _next_thread_id(0),
+    _buffers() { }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE ThreadBuffer& localBuffer() {
+    bool exists = false;
+    ThreadBuffer& buffer = _buffers.local(exists);
+    if ( !exists || buffer.records.size() != _buffer_mask + 1 ) {
+      if ( !exists ) {
+        buffer.thread_id = _next_thread_id.fetch_add(1, std::memory_order_relaxed);
+      }
+      buffer.records.assign(_buffer_mask + 1, Record { 0, 0, TraceEvent::NUM_EVENTS });
+      buffer.num_recorded = 0;
+    }
+    return buffer;
+  }
+
+  uint64_t nanosecondsSinceEpoch(const Clock::time_point& time) const {
+    return time > _epoch ? std::chrono::duration_cast<std::chrono::nanoseconds>(time - _epoch).count() : 0;
+  }
+
+  std::atomic<TraceLevel> _level;
+  size_t _buffer_mask;
+  Clock::time_point _epoch;
+  std::atomic<uint32_t> _next_thread_id;
+  tbb::enumerable_thread_specific<ThreadBuffer> _buffers;
+};
+
+/*!
+ * Records the lifetime of the scope as an event, if tracing is enabled.
+ */
+class TraceScope {
+ public:
+  explicit TraceScope(const TraceEvent event) :
+    _event(event),
+    _is_active(Tracer::instance().isEnabled(event)),
+    _start() {
+    if ( _is_active ) {
+      _start = Tracer::instance().now();
+    }
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope & operator= (const TraceScope &) = delete;
+
+  TraceScope(TraceScope&&) = delete;
+  TraceScope & operator= (TraceScope &&) = delete;
+
+  ~TraceScope() {
+    if ( _is_active ) {
+      Tracer::instance().record(_event, _start, Tracer::instance().now());
+    }
+  }
+
+ private:
+  const TraceEvent _event;
+  const bool _is_active;
+  std::chrono::steady_clock::time_point _start;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
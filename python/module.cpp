@@ -34,6 +34,7 @@
 #include <tbb/parallel_for.h>
 
 #include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -116,6 +117,8 @@ PYBIND11_MODULE(mtkahypar, m) {
 
   auto context_class = py::class_<Context>(m, "Context");
 
+  auto session_class = py::class_<lib::Session>(m, "Session");
+
   auto hg_class = py::class_<mt_kahypar_hypergraph_t,
     std::unique_ptr<mt_kahypar_hypergraph_t, HypergraphDeleter>>(m, "Hypergraph");
 
@@ -153,6 +156,27 @@ PYBIND11_MODULE(mtkahypar, m) {
     .value("CONDUCTANCE_LOCAL", Objective::conductance_local)
     .value("CONDUCTANCE_GLOBAL", Objective::conductance_global);
 
+  py::enum_<mt_kahypar_progress_phase_t>(m, "ProgressPhase", py::module_local())
+    .value("COARSENING", PROGRESS_COARSENING)
+    .value("INITIAL_PARTITIONING", PROGRESS_INITIAL_PARTITIONING)
+    .value("REFINEMENT", PROGRESS_REFINEMENT)
+    .value("VCYCLE", PROGRESS_VCYCLE);
+
+  py::class_<mt_kahypar_progress_t>(m, "Progress", py::module_local())
+    .def_readonly("phase", &mt_kahypar_progress_t::phase)
+    .def_readonly("level", &mt_kahypar_progress_t::level,
+      "Number of levels between the current and the input hypergraph (0 = input hypergraph)")
+    .def_readonly("num_nodes", &mt_kahypar_progress_t::num_nodes,
+      "Number of nodes of the hypergraph on the current level")
+    .def_readonly("objective", &mt_kahypar_progress_t::objective,
+      "Objective of the current partition (zero after coarsening)")
+    .def_readonly("imbalance", &mt_kahypar_progress_t::imbalance,
+      "Imbalance of the current partition (zero after coarsening)")
+    .def_readonly("conductance", &mt_kahypar_progress_t::conductance,
+      "Conductance of the current partition (only for conductance objectives)")
+    .def_readonly("elapsed_seconds", &mt_kahypar_progress_t::elapsed_seconds,
+      "Elapsed time in seconds since the start of the partitioning call");
+
   // ####################### Exceptions #######################
 
   py::register_exception<InvalidInputException>(m, "InvalidInputError", PyExc_ValueError);
@@ -344,7 +368,32 @@ Construct a target graph.
             io::readInputFile<ds::StaticGraph>(file_name, file_format, true))),
             STATIC_GRAPH };
       }, "Reads a target graph from a file (supported file formats are METIS and HMETIS)",
-      py::arg("filename"), py::arg("context"), py::arg("format") = FileFormat::Metis);
+      py::arg("filename"), py::arg("context"), py::arg("format") = FileFormat::Metis)
+    .def("partition_batch",
+      [](Initializer&,
+         const std::vector<mt_kahypar_hypergraph_t>& hypergraphs,
+         const std::vector<Context>& contexts) {
+        std::vector<const Context*> batch_contexts;
+        for ( const Context& context : contexts ) {
+          batch_contexts.push_back(&context);
+        }
+        // Callbacks of the contexts acquire the GIL when they are invoked from worker threads
+        py::gil_scoped_release release;
+        return lib::partition_batch(hypergraphs, batch_contexts);
+      }, R"pbdoc(
+Partitions a batch of (hyper)graphs concurrently. The i-th hypergraph is partitioned with the
+i-th context. Returns the partitioned hypergraphs in the same order.
+          )pbdoc",
+      py::arg("hypergraphs"), py::arg("contexts"))
+    .def("create_session",
+      [](Initializer&, const Context& context) {
+        return std::make_unique<lib::Session>(context);
+      }, R"pbdoc(
+Creates a session that partitions many (hyper)graphs with the given context. The session
+validates the context only once and reuses its timer and statistic objects.
+Note that later changes to the context are not visible to the session.
+          )pbdoc",
+      py::arg("context"));
 
 
   // ####################### Context #######################
@@ -399,6 +448,47 @@ Construct a target graph.
       }, [](Context& context, const size_t num_vcycles) {
         context.partition.num_vcycles = num_vcycles;
       }, "Sets the number of V-cycles")
+    .def_property("time_limit",
+      [](const Context& context) {
+        return context.partition.time_limit;
+      }, [](Context& context, const double time_limit) {
+        context.partition.time_limit = time_limit;
+      }, "Wall-clock time limit in seconds (0 = no limit)")
+    .def("set_best_partition_callback",
+      [](Context& context, py::function callback) {
+        // The python function must only be copied and destroyed while holding the GIL
+        std::shared_ptr<py::function> function(new py::function(std::move(callback)), [](py::function* f) {
+          py::gil_scoped_acquire acquire;
+          delete f;
+        });
+        context.partition.best_partition_callback = [function](const vec<PartitionID>& partition,
+                                                               const HyperedgeWeight objective,
+                                                               const double elapsed_seconds) {
+          py::gil_scoped_acquire acquire;
+          (*function)(std::vector<PartitionID>(partition.begin(), partition.end()), objective, elapsed_seconds);
+        };
+      }, R"pbdoc(
+Sets a function that is called with each new best partition (list of block IDs), its objective and
+the elapsed time in seconds, i.e., after the first multilevel cycle and after each improving V-cycle.
+        )pbdoc",
+      py::arg("callback"))
+    .def("set_progress_callback",
+      [](Context& context, py::function callback) {
+        // The python function must only be copied and destroyed while holding the GIL
+        std::shared_ptr<py::function> function(new py::function(std::move(callback)), [](py::function* f) {
+          py::gil_scoped_acquire acquire;
+          delete f;
+        });
+        context.partition.progress_callback = [function](const mt_kahypar_progress_t& progress) {
+          py::gil_scoped_acquire acquire;
+          return static_cast<bool>(py::bool_((*function)(progress)));
+        };
+      }, R"pbdoc(
+Sets a function that is called with the progress of the partitioning call (see Progress) after
+coarsening, initial partitioning, each uncoarsening level and each V-cycle. If the function returns
+True, the partitioner skips all remaining refinement and V-cycles and returns as fast as possible.
+        )pbdoc",
+      py::arg("callback"))
     .def_property("logging",
       [](const Context& context) {
         return context.partition.verbose_output;
@@ -440,6 +530,20 @@ If indiviual target weights are set, these are used for the calculation instead.
       }, "Print partitioning configuration");
 
 
+  // ####################### Session #######################
+
+  session_class
+    .def("partition",
+      [&](lib::Session& session, mt_kahypar_hypergraph_t hypergraph) {
+        vec<PartitionID> partition(lib::num_nodes<true>(hypergraph), kInvalidPartition);
+        session.partition(hypergraph, partition.data());
+        return partition;
+      }, "Partitions the hypergraph and returns the block ID of each node",
+      py::arg("hypergraph"))
+    .def("num_calls", &lib::Session::numCalls,
+      "Number of (hyper)graphs partitioned within this session");
+
+
   // ####################### Hypergraph and Graph #######################
 
   hg_class
@@ -686,6 +790,48 @@ Construct a partitioned hypergraph from this hypergraph.
         lib::improve_mapping(phg, target_graph, context, num_vcycles);
       }, "Improves a mapping onto a graph using the iterated multilevel cycle technique (V-cycles)",
       py::arg("target_graph"), py::arg("context"), py::arg("num_vcycles"))
+    .def("update_partition",
+      [&](mt_kahypar_partitioned_hypergraph_t phg,
+          mt_kahypar_hypergraph_t hypergraph,
+          const Context& context,
+          const std::vector<HypernodeWeight>& added_node_weights,
+          const std::vector<HypernodeID>& removed_nodes,
+          const std::vector<std::vector<HypernodeID>>& added_hyperedges,
+          const std::vector<HyperedgeWeight>& added_hyperedge_weights,
+          const std::vector<HyperedgeID>& removed_hyperedges,
+          const std::vector<std::pair<HyperedgeID, HypernodeID>>& added_pins,
+          const std::vector<std::pair<HyperedgeID, HypernodeID>>& removed_pins,
+          const std::vector<std::pair<HypernodeID, HypernodeWeight>>& node_weight_changes,
+          const std::vector<std::pair<HyperedgeID, HyperedgeWeight>>& hyperedge_weight_changes) {
+        HypergraphDelta delta;
+        delta.added_nodes.assign(added_node_weights.begin(), added_node_weights.end());
+        delta.removed_nodes.assign(removed_nodes.begin(), removed_nodes.end());
+        for ( const auto& pins : added_hyperedges ) {
+          delta.added_edges.emplace_back(pins.begin(), pins.end());
+        }
+        delta.added_edge_weights.assign(added_hyperedge_weights.begin(), added_hyperedge_weights.end());
+        delta.removed_edges.assign(removed_hyperedges.begin(), removed_hyperedges.end());
+        delta.added_pins.assign(added_pins.begin(), added_pins.end());
+        delta.removed_pins.assign(removed_pins.begin(), removed_pins.end());
+        delta.node_weight_changes.assign(node_weight_changes.begin(), node_weight_changes.end());
+        delta.edge_weight_changes.assign(hyperedge_weight_changes.begin(), hyperedge_weight_changes.end());
+        lib::update_partition(hypergraph, phg, delta, context);
+      }, R"pbdoc(
+        Applies the given changes to the hypergraph and the partition in place and refines the
+        partition around the changed region. All IDs refer to the hypergraph before the update,
+        except that the i-th added node (hyperedge) gets ID n + i (m + i). Pins are given as
+        (hyperedge, node) pairs and weight changes as (ID, new weight) pairs.
+        )pbdoc",
+      py::arg("hypergraph"), py::arg("context"),
+      py::arg("added_node_weights") = std::vector<HypernodeWeight>(),
+      py::arg("removed_nodes") = std::vector<HypernodeID>(),
+      py::arg("added_hyperedges") = std::vector<std::vector<HypernodeID>>(),
+      py::arg("added_hyperedge_weights") = std::vector<HyperedgeWeight>(),
+      py::arg("removed_hyperedges") = std::vector<HyperedgeID>(),
+      py::arg("added_pins") = std::vector<std::pair<HyperedgeID, HypernodeID>>(),
+      py::arg("removed_pins") = std::vector<std::pair<HyperedgeID, HypernodeID>>(),
+      py::arg("node_weight_changes") = std::vector<std::pair<HypernodeID, HypernodeWeight>>(),
+      py::arg("hyperedge_weight_changes") = std::vector<std::pair<HyperedgeID, HyperedgeWeight>>())
     .def("connectivity_set",
       [&](mt_kahypar_partitioned_hypergraph_t p, HyperedgeID he) {
         return lib::switch_phg<py::iterator, true>(p, [=](const auto& phg) {
@@ -1072,5 +1072,83 @@ class MainTest(unittest.TestCase):
     partitioner.partition()
     partitioner.improvePartition(1)
 
+  def test_partitions_a_batch_of_hypergraphs(self):
+    hg_context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    hg_context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    hg_context.logging = logging
+    graph_context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    graph_context.set_partitioning_parameters(8, 0.03, mtkahypar.Objective.CUT)
+    graph_context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", hg_context)
+    graph = mtk.graph_from_file(mydir + "/test_instances/delaunay_n15.graph", graph_context)
+    partitioned_hgs = mtk.partition_batch([hypergraph, graph], [hg_context, graph_context])
+    self.assertEqual(len(partitioned_hgs), 2)
+    self.assertEqual(partitioned_hgs[0].num_blocks(), 4)
+    self.assertEqual(partitioned_hgs[1].num_blocks(), 8)
+    self.assertLessEqual(partitioned_hgs[0].imbalance(hg_context), 0.03)
+    self.assertLessEqual(partitioned_hgs[1].imbalance(graph_context), 0.03)
+
+  def test_partitions_several_hypergraphs_within_a_session(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    session = mtk.create_session(context)
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    graph = mtk.graph_from_file(mydir + "/test_instances/delaunay_n15.graph", context)
+    for instance in [hypergraph, graph, hypergraph]:
+      partition = session.partition(instance)
+      self.assertEqual(len(partition), instance.num_nodes())
+      partitioned_hg = instance.create_partitioned_hypergraph(4, context, partition)
+      self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+    self.assertEqual(session.num_calls(), 3)
+
+  def test_updates_a_hypergraph_partition_after_hypergraph_changes(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    num_nodes = hypergraph.num_nodes()
+    partitioned_hg = hypergraph.partition(context)
+    partitioned_hg.update_partition(hypergraph, context,
+      added_node_weights = [1, 1],
+      removed_nodes = [42],
+      added_hyperedges = [[num_nodes, 0, 1], [num_nodes + 1, 2, 3]],
+      added_pins = [(0, 100)],
+      node_weight_changes = [(1, 5)])
+    self.assertEqual(hypergraph.num_nodes(), num_nodes + 1)
+    self.assertEqual(hypergraph.node_weight(1), 5)
+    self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+    self.assertEqual(sum(partitioned_hg.block_weight(i) for i in range(4)), hypergraph.total_weight())
+
+  def test_reports_best_partitions_within_time_limit(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    context.time_limit = 1.0
+    objectives = []
+    def on_best_partition(partition, objective, elapsed_seconds):
+      self.assertEqual(len(partition), hypergraph.num_nodes())
+      objectives.append(objective)
+    context.set_best_partition_callback(on_best_partition)
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    partitioned_hg = hypergraph.partition(context)
+    self.assertGreaterEqual(len(objectives), 1)
+    self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+
+  def test_reports_progress_and_cancels_partitioning(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    reports = []
+    def on_progress(progress):
+      reports.append(progress.phase)
+      return progress.phase == mtkahypar.ProgressPhase.INITIAL_PARTITIONING
+    context.set_progress_callback(on_progress)
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+    partitioned_hg = hypergraph.partition(context)
+    self.assertEqual(reports, [mtkahypar.ProgressPhase.COARSENING,
+                               mtkahypar.ProgressPhase.INITIAL_PARTITIONING])
+    self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+
 if __name__ == '__main__':
   unittest.main()
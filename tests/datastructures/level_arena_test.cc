@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/datastructures/level_arena.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace ds {
+
+TEST(ALevelArena, AllocatesAlignedBuffers) {
+  LevelArena arena("Test", "arena", LevelArena::reservedBytes(10, sizeof(int)) +
+    LevelArena::reservedBytes(10, sizeof(size_t)));
+  LevelArena::Level level(arena);
+  int* ints = arena.allocate<int>(10);
+  size_t* sizes = arena.allocate<size_t>(10);
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ints) % 64);
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(sizes) % 64);
+  ASSERT_LE(reinterpret_cast<char*>(ints + 10), reinterpret_cast<char*>(sizes));
+}
+
+TEST(ALevelArena, RecyclesMemoryOfPreviousLevel) {
+  LevelArena arena("Test", "arena", LevelArena::reservedBytes(100, sizeof(int)));
+  int* first = nullptr;
+  {
+    LevelArena::Level level(arena);
+    first = arena.allocate<int>(100);
+  }
+  {
+    LevelArena::Level level(arena);
+    ASSERT_EQ(first, arena.allocate<int>(50));
+  }
+  ASSERT_EQ(2, arena.stats().num_levels);
+  ASSERT_EQ(150 * sizeof(int), arena.stats().requested_bytes);
+  ASSERT_EQ(100 * sizeof(int), arena.stats().peak_used_bytes);
+  ASSERT_EQ(LevelArena::reservedBytes(100, sizeof(int)), arena.stats().reserved_bytes);
+}
+
+TEST(ALevelArena, AddsBlockIfLevelExceedsReservedMemory) {
+  LevelArena arena("Test", "arena", LevelArena::reservedBytes(10, sizeof(int)));
+  {
+    LevelArena::Level level(arena);
+    int* ints = arena.allocate<int>(10);
+    int* other_ints = arena.allocate<int>(1000);
+    for ( int i = 0; i < 10; ++i ) {
+      ints[i] = i;
+    }
+    for ( int i = 0; i < 1000; ++i ) {
+      other_ints[i] = -i;
+    }
+    for ( int i = 0; i < 10; ++i ) {
+      ASSERT_EQ(i, ints[i]);
+    }
+  }
+  const size_t reserved_bytes = arena.stats().reserved_bytes;
+  ASSERT_GE(reserved_bytes, 1010 * sizeof(int));
+  {
+    // Second level is served by the retained blocks
+    LevelArena::Level level(arena);
+    arena.allocate<int>(10);
+    arena.allocate<int>(1000);
+  }
+  ASSERT_EQ(reserved_bytes, arena.stats().reserved_bytes);
+}
+
+TEST(ALevelArena, BindsBuffersToArrays) {
+  LevelArena arena("Test", "arena", LevelArena::reservedBytes(256, sizeof(int)));
+  Array<int> vec;
+  for ( size_t n : { 256, 128 } ) {
+    LevelArena::Level level(arena);
+    arena.allocate(vec, n);
+    ASSERT_EQ(n, vec.size());
+    vec.assign(n, 42);
+    for ( size_t i = 0; i < n; ++i ) {
+      ASSERT_EQ(42, vec[i]);
+    }
+  }
+}
+
+TEST(ALevelArena, ReportsRecycledMemory) {
+  LevelArena arena("Test", "arena", LevelArena::reservedBytes(100, sizeof(int)));
+  for ( size_t n : { 100, 50, 25 } ) {
+    LevelArena::Level level(arena);
+    arena.allocate<int>(n);
+  }
+  ASSERT_EQ(175 * sizeof(int) - arena.stats().reserved_bytes, arena.stats().savedBytes());
+}
+
+}  // namespace ds
+}  // namespace mt_kahypar
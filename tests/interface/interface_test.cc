@@ -27,13 +27,17 @@
 
 #include "gmock/gmock.h"
 
+#include <algorithm>
 #include <thread>
+#include <unordered_map>
 
 #include <tbb/parallel_invoke.h>
 
 #include "mtkahypar.h"
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 
 using ::testing::Test;
@@ -79,6 +83,7 @@ namespace mt_kahypar {
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, NUM_VCYCLES, "0", &error));
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, NUM_VCYCLES, "3", &error));
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, VERBOSE, "1", &error));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, TIME_LIMIT, "2.5", &error));
 
     ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_set_context_parameter(context, NUM_BLOCKS, "x", &error));
     check_error_status();
@@ -90,6 +95,8 @@ namespace mt_kahypar {
     check_error_status();
     ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_set_context_parameter(context, VERBOSE, "2", &error));
     check_error_status();
+    ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_set_context_parameter(context, TIME_LIMIT, "one", &error));
+    check_error_status();
 
     Context& c = *reinterpret_cast<Context*>(context);
     ASSERT_EQ(4, c.partition.k);
@@ -97,6 +104,7 @@ namespace mt_kahypar {
     ASSERT_EQ(Objective::km1, c.partition.objective);
     ASSERT_EQ(3, c.partition.num_vcycles);
     ASSERT_TRUE(c.partition.verbose_output);
+    ASSERT_EQ(2.5, c.partition.time_limit);
 
     mt_kahypar_free_context(context);
   }
@@ -861,6 +869,29 @@ namespace mt_kahypar {
       hypergraph = mt_kahypar_read_hypergraph_from_file(filename, context, format, &error);
     }
 
+    // Loads a hypergraph that consists of two disjoint copies of the given hypergraph
+    void LoadTwoDisjointCopies(const char* filename,
+                               const mt_kahypar_file_format_type_t format) {
+      Load(filename, format);
+      const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+      const mt_kahypar_hyperedge_id_t num_edges = mt_kahypar_num_hyperedges(hypergraph);
+      std::vector<size_t> hyperedge_indices = { 0 };
+      std::vector<mt_kahypar_hypernode_id_t> hyperedges;
+      std::vector<mt_kahypar_hypernode_id_t> pins(num_nodes);
+      for ( const mt_kahypar_hypernode_id_t offset : { mt_kahypar_hypernode_id_t(0), num_nodes } ) {
+        for ( mt_kahypar_hyperedge_id_t he = 0; he < num_edges; ++he ) {
+          const mt_kahypar_hypernode_id_t size = mt_kahypar_get_hyperedge_pins(hypergraph, he, pins.data());
+          for ( mt_kahypar_hypernode_id_t i = 0; i < size; ++i ) {
+            hyperedges.push_back(offset + pins[i]);
+          }
+          hyperedge_indices.push_back(hyperedges.size());
+        }
+      }
+      mt_kahypar_free_hypergraph(hypergraph);
+      hypergraph = mt_kahypar_create_hypergraph(context, 2 * num_nodes, 2 * num_edges,
+        hyperedge_indices.data(), hyperedges.data(), nullptr, nullptr, &error);
+    }
+
     void SetUpContext(const mt_kahypar_preset_type_t preset,
                       const mt_kahypar_partition_id_t num_blocks,
                       const double epsilon,
@@ -1085,6 +1116,132 @@ namespace mt_kahypar {
     });
   }
 
+  TEST_F(APartitioner, PartitionsABatchOfHypergraphs) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    mt_kahypar_context_t* graph_context = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(graph_context, 8, 0.03, CUT);
+    mt_kahypar_set_context_parameter(graph_context, VERBOSE, "0", &error);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    mt_kahypar_hypergraph_t graph = mt_kahypar_read_hypergraph_from_file(GRAPH_FILE, graph_context, METIS, &error);
+    mt_kahypar_hypergraph_t graph_2 = mt_kahypar_read_hypergraph_from_file(GRAPH_FILE, graph_context, METIS, &error);
+
+    const std::vector<mt_kahypar_hypergraph_t> hypergraphs = { hypergraph, graph, graph_2 };
+    const std::vector<const mt_kahypar_context_t*> contexts = { context, graph_context, graph_context };
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(3);
+    ASSERT_EQ(mt_kahypar_partition_batch(hypergraphs.data(), contexts.data(), 3, phgs.data(), &error), SUCCESS);
+
+    // results are returned in input order
+    ASSERT_EQ(4, mt_kahypar_num_blocks(phgs[0]));
+    ASSERT_EQ(8, mt_kahypar_num_blocks(phgs[1]));
+    ASSERT_EQ(8, mt_kahypar_num_blocks(phgs[2]));
+    for ( size_t i = 0; i < phgs.size(); ++i ) {
+      ASSERT_LE(mt_kahypar_imbalance(phgs[i], contexts[i]), 0.03);
+      mt_kahypar_free_partitioned_hypergraph(phgs[i]);
+    }
+
+    mt_kahypar_free_hypergraph(graph);
+    mt_kahypar_free_hypergraph(graph_2);
+    mt_kahypar_free_context(graph_context);
+  }
+
+  TEST_F(APartitioner, BatchPartitioningFailsIfOneInstanceIsIncompatible) {
+    SetUpContext(HIGHEST_QUALITY, 4, 0.03, KM1);
+    mt_kahypar_context_t* c = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(c, 4, 0.03, KM1);
+    mt_kahypar_hypergraph_t hg = mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, c, HMETIS, &error);
+    Load(HYPERGRAPH_FILE, HMETIS);
+
+    // the static hypergraph can not be partitioned with the HIGHEST_QUALITY preset
+    const std::vector<mt_kahypar_hypergraph_t> hypergraphs = { hypergraph, hg };
+    const std::vector<const mt_kahypar_context_t*> contexts = { context, context };
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(2);
+    mt_kahypar_error_t batch_error{};
+    ASSERT_EQ(mt_kahypar_partition_batch(hypergraphs.data(), contexts.data(), 2, phgs.data(), &batch_error),
+              UNSUPPORTED_OPERATION);
+    mt_kahypar_free_error_content(&batch_error);
+
+    mt_kahypar_free_hypergraph(hg);
+    mt_kahypar_free_context(c);
+  }
+
+  TEST_F(APartitioner, PartitionsSeveralHypergraphsWithinASession) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DETERMINISTIC, 4, 0.03, KM1, false);
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    std::vector<mt_kahypar_partition_id_t> expected(num_nodes);
+    mt_kahypar_get_partition(partitioned_hg, expected.data());
+
+    mt_kahypar_session_t* session = mt_kahypar_create_session(context, &error);
+    ASSERT_NE(session, nullptr);
+    mt_kahypar_context_t* graph_context = mt_kahypar_context_from_preset(DETERMINISTIC);
+    mt_kahypar_hypergraph_t graph = mt_kahypar_read_hypergraph_from_file(GRAPH_FILE, graph_context, METIS, &error);
+    std::vector<mt_kahypar_partition_id_t> graph_partition(mt_kahypar_num_hypernodes(graph), -1);
+
+    std::vector<mt_kahypar_partition_id_t> partition(num_nodes, -1);
+    ASSERT_EQ(mt_kahypar_session_partition(session, hypergraph, partition.data(), &error), SUCCESS);
+    ASSERT_EQ(expected, partition);
+    ASSERT_EQ(mt_kahypar_session_partition(session, graph, graph_partition.data(), &error), SUCCESS);
+    for ( const mt_kahypar_partition_id_t block : graph_partition ) {
+      ASSERT_GE(block, 0);
+      ASSERT_LT(block, 4);
+    }
+    std::fill(partition.begin(), partition.end(), -1);
+    ASSERT_EQ(mt_kahypar_session_partition(session, hypergraph, partition.data(), &error), SUCCESS);
+    ASSERT_EQ(expected, partition);
+
+    mt_kahypar_free_session(session);
+    mt_kahypar_free_hypergraph(graph);
+    mt_kahypar_free_context(graph_context);
+  }
+
+  TEST_F(APartitioner, PartitionsConcurrentlyWithinTwoSessions) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DETERMINISTIC, 4, 0.03, KM1, false);
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    std::vector<mt_kahypar_partition_id_t> expected(num_nodes);
+    mt_kahypar_get_partition(partitioned_hg, expected.data());
+
+    mt_kahypar_session_t* session = mt_kahypar_create_session(context, &error);
+    mt_kahypar_session_t* other_session = mt_kahypar_create_session(context, &error);
+    ASSERT_NE(session, nullptr);
+    ASSERT_NE(other_session, nullptr);
+    mt_kahypar_hypergraph_t other_hg = mt_kahypar_read_hypergraph_from_file(
+      HYPERGRAPH_FILE, context, HMETIS, &error);
+
+    std::vector<mt_kahypar_partition_id_t> partition(num_nodes, -1);
+    std::vector<mt_kahypar_partition_id_t> other_partition(num_nodes, -1);
+    mt_kahypar_status_t other_status = SUCCESS;
+    std::thread other([&] {
+      mt_kahypar_error_t other_error{};
+      for ( size_t i = 0; i < 3 && other_status == SUCCESS; ++i ) {
+        other_status = mt_kahypar_session_partition(
+          other_session, other_hg, other_partition.data(), &other_error);
+      }
+      mt_kahypar_free_error_content(&other_error);
+    });
+    mt_kahypar_status_t status = SUCCESS;
+    for ( size_t i = 0; i < 3 && status == SUCCESS; ++i ) {
+      status = mt_kahypar_session_partition(session, hypergraph, partition.data(), &error);
+    }
+    other.join();
+
+    ASSERT_EQ(SUCCESS, status);
+    ASSERT_EQ(SUCCESS, other_status);
+    ASSERT_EQ(expected, partition);
+    ASSERT_EQ(expected, other_partition);
+
+    mt_kahypar_free_session(other_session);
+    mt_kahypar_free_session(session);
+    mt_kahypar_free_hypergraph(other_hg);
+  }
+
+  TEST_F(APartitioner, SessionFailsIfContextIsIncomplete) {
+    mt_kahypar_context_t* c = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_error_t session_error{};
+    ASSERT_EQ(mt_kahypar_create_session(c, &session_error), nullptr);
+    ASSERT_EQ(session_error.status, INVALID_INPUT);
+    mt_kahypar_free_error_content(&session_error);
+    mt_kahypar_free_context(c);
+  }
+
   TEST_F(APartitioner, ChecksIfDeterministicPresetProducesSameResultsForHypergraphs) {
     Partition(HYPERGRAPH_FILE, HMETIS, DETERMINISTIC, 8, 0.03, KM1, false);
     const double objective_1 = mt_kahypar_km1(partitioned_hg);
@@ -1137,6 +1294,263 @@ namespace mt_kahypar {
     ImprovePartition(DEFAULT, 4, 0.03, CUT, 3, false);
   }
 
+  TEST_F(APartitioner, UsesLouvainCommunitiesAsClustering) {
+    SetUpContext(CLUSTER, 1000, 0.03, CONDUCTANCE_LOCAL, false);
+    Context& c = *reinterpret_cast<Context*>(context);
+    c.preprocessing.use_communities_as_clustering = true;
+    c.preprocessing.communities_as_clustering_max_conductance = 1.0;
+    // Without label propagation, the clustering must be exactly the community structure
+    c.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::do_nothing;
+    Load(HYPERGRAPH_FILE, HMETIS);
+    partitioned_hg = mt_kahypar_partition(hypergraph, context, &error);
+    ASSERT_NE(nullptr, partitioned_hg.partitioned_hg);
+
+    // The partitioner stores the Louvain communities as community IDs of the hypergraph
+    const ds::StaticHypergraph& hg = utils::cast<ds::StaticHypergraph>(hypergraph);
+    std::vector<mt_kahypar_partition_id_t> partition(hg.initialNumNodes());
+    mt_kahypar_get_partition(partitioned_hg, partition.data());
+    std::unordered_map<PartitionID, PartitionID> community_to_block;
+    std::unordered_map<PartitionID, PartitionID> block_to_community;
+    for ( const HypernodeID& hn : hg.nodes() ) {
+      // Degree-zero nodes are removed before community detection
+      if ( hg.nodeDegree(hn) > 0 ) {
+        const PartitionID community = hg.communityID(hn);
+        const PartitionID block = partition[hn];
+        ASSERT_EQ(block, community_to_block.emplace(community, block).first->second);
+        ASSERT_EQ(community, block_to_community.emplace(block, community).first->second);
+      }
+    }
+    ASSERT_GE(community_to_block.size(), 2);
+    ASSERT_EQ(community_to_block.size(), static_cast<size_t>(mt_kahypar_num_blocks(partitioned_hg)));
+  }
+
+  struct BestPartitions {
+    mt_kahypar_hypernode_id_t num_nodes = 0;
+    std::vector<mt_kahypar_hyperedge_weight_t> objectives;
+    std::vector<double> elapsed_seconds;
+    std::vector<std::vector<mt_kahypar_partition_id_t>> partitions;
+    bool all_partitions_valid = true;
+  };
+
+  TEST_F(APartitioner, ReportsBestPartitionsWithinTimeLimit) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1, false);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, TIME_LIMIT, "1", &error));
+    BestPartitions best_partitions;
+    mt_kahypar_set_best_partition_callback(context,
+      [](const mt_kahypar_partition_id_t* partition, mt_kahypar_hypernode_id_t num_nodes,
+         mt_kahypar_hyperedge_weight_t objective, double elapsed_seconds, void* user_data) {
+        BestPartitions& best = *static_cast<BestPartitions*>(user_data);
+        best.all_partitions_valid &= num_nodes == best.num_nodes &&
+          std::all_of(partition, partition + num_nodes, [](const mt_kahypar_partition_id_t block) {
+            return block >= 0 && block < 4;
+          });
+        best.objectives.push_back(objective);
+        best.elapsed_seconds.push_back(elapsed_seconds);
+        best.partitions.emplace_back(partition, partition + num_nodes);
+      }, &best_partitions);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    best_partitions.num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    PartitionNoSetup(4, 0.03);
+
+    ASSERT_GE(best_partitions.objectives.size(), 1);
+    ASSERT_TRUE(best_partitions.all_partitions_valid);
+    std::vector<bool> is_balanced;
+    for ( const std::vector<mt_kahypar_partition_id_t>& partition : best_partitions.partitions ) {
+      mt_kahypar_partitioned_hypergraph_t phg = mt_kahypar_create_partitioned_hypergraph(
+        hypergraph, context, 4, partition.data(), &error);
+      is_balanced.push_back(mt_kahypar_imbalance(phg, context) <= 0.03);
+      mt_kahypar_free_partitioned_hypergraph(phg);
+    }
+    for ( size_t i = 1; i < best_partitions.objectives.size(); ++i ) {
+      // A balanced partition replaces an imbalanced one even if its objective is worse
+      ASSERT_TRUE(is_balanced[i] || !is_balanced[i - 1]);
+      if ( is_balanced[i] == is_balanced[i - 1] ) {
+        ASSERT_LT(best_partitions.objectives[i], best_partitions.objectives[i - 1]);
+      }
+      ASSERT_GE(best_partitions.elapsed_seconds[i], best_partitions.elapsed_seconds[i - 1]);
+    }
+  }
+
+  struct ProgressReports {
+    std::vector<mt_kahypar_progress_t> reports;
+    bool cancel = false;
+  };
+
+  bool storeProgress(const mt_kahypar_progress_t* progress, void* user_data) {
+    ProgressReports& progress_reports = *static_cast<ProgressReports*>(user_data);
+    progress_reports.reports.push_back(*progress);
+    return progress_reports.cancel;
+  }
+
+  TEST_F(APartitioner, ReportsProgressAfterEachPhaseAndLevel) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1, false);
+    ProgressReports progress_reports;
+    mt_kahypar_set_progress_callback(context, storeProgress, &progress_reports);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    PartitionNoSetup(4, 0.03);
+
+    const std::vector<mt_kahypar_progress_t>& reports = progress_reports.reports;
+    ASSERT_GE(reports.size(), 3);
+    ASSERT_EQ(PROGRESS_COARSENING, reports[0].phase);
+    ASSERT_EQ(PROGRESS_INITIAL_PARTITIONING, reports[1].phase);
+    ASSERT_EQ(reports[0].level, reports[1].level);
+    for ( size_t i = 2; i < reports.size(); ++i ) {
+      ASSERT_EQ(PROGRESS_REFINEMENT, reports[i].phase);
+      ASSERT_EQ(reports[1].level + 2 - i, reports[i].level);
+      ASSERT_GE(reports[i].num_nodes, reports[i - 1].num_nodes);
+      ASSERT_GE(reports[i].elapsed_seconds, reports[i - 1].elapsed_seconds);
+    }
+    ASSERT_EQ(0, reports.back().level);
+    ASSERT_EQ(mt_kahypar_num_hypernodes(hypergraph), reports.back().num_nodes);
+  }
+
+  TEST_F(APartitioner, CancelsPartitioningViaProgressCallback) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1, false);
+    mt_kahypar_set_context_parameter(context, NUM_VCYCLES, "3", &error);
+    ProgressReports progress_reports;
+    progress_reports.cancel = true;
+    mt_kahypar_set_progress_callback(context, storeProgress, &progress_reports);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    // Still returns a valid and balanced partition
+    PartitionNoSetup(4, 0.03);
+
+    ASSERT_EQ(1, progress_reports.reports.size());
+    ASSERT_EQ(PROGRESS_COARSENING, progress_reports.reports[0].phase);
+  }
+
+  TEST_F(APartitioner, UpdatesHypergraphPartitionAfterHypergraphChanges) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    const mt_kahypar_hyperedge_id_t num_edges = mt_kahypar_num_hyperedges(hypergraph);
+
+    // Add ten nodes, each connected to three existing nodes by a new hyperedge
+    std::vector<mt_kahypar_hypernode_weight_t> added_node_weights(10, 1);
+    std::vector<size_t> added_hyperedge_indices = { 0 };
+    std::vector<mt_kahypar_hypernode_id_t> added_hyperedges;
+    for ( mt_kahypar_hypernode_id_t i = 0; i < 10; ++i ) {
+      added_hyperedges.push_back(num_nodes + i);
+      added_hyperedges.push_back(3 * i);
+      added_hyperedges.push_back(3 * i + 1);
+      added_hyperedges.push_back(3 * i + 2);
+      added_hyperedge_indices.push_back(added_hyperedges.size());
+    }
+    std::vector<mt_kahypar_hypernode_id_t> removed_nodes = { 42 };
+    std::vector<mt_kahypar_hyperedge_id_t> removed_hyperedges = { 7 };
+    std::vector<mt_kahypar_hyperedge_id_t> added_pin_hyperedges = { 0, num_edges };
+    std::vector<mt_kahypar_hypernode_id_t> added_pin_nodes = { 100, num_nodes + 1 };
+    std::vector<mt_kahypar_hypernode_id_t> weight_changed_nodes = { 1, 2 };
+    std::vector<mt_kahypar_hypernode_weight_t> new_node_weights = { 5, 3 };
+
+    mt_kahypar_hypergraph_delta_t delta{};
+    delta.added_node_weights = added_node_weights.data();
+    delta.num_added_nodes = added_node_weights.size();
+    delta.removed_nodes = removed_nodes.data();
+    delta.num_removed_nodes = removed_nodes.size();
+    delta.added_hyperedge_indices = added_hyperedge_indices.data();
+    delta.added_hyperedges = added_hyperedges.data();
+    delta.num_added_hyperedges = 10;
+    delta.removed_hyperedges = removed_hyperedges.data();
+    delta.num_removed_hyperedges = removed_hyperedges.size();
+    delta.added_pin_hyperedges = added_pin_hyperedges.data();
+    delta.added_pin_nodes = added_pin_nodes.data();
+    delta.num_added_pins = added_pin_nodes.size();
+    delta.weight_changed_nodes = weight_changed_nodes.data();
+    delta.new_node_weights = new_node_weights.data();
+    delta.num_node_weight_changes = weight_changed_nodes.size();
+
+    ASSERT_EQ(mt_kahypar_update_partition(hypergraph, partitioned_hg, &delta, context, &error), SUCCESS);
+    ASSERT_EQ(num_nodes + 9, mt_kahypar_num_hypernodes(hypergraph));
+    ASSERT_LE(mt_kahypar_num_hyperedges(hypergraph), num_edges + 9);
+    ASSERT_EQ(5, mt_kahypar_hypernode_weight(hypergraph, 1));
+    ASSERT_EQ(3, mt_kahypar_hypernode_weight(hypergraph, 2));
+    ASSERT_LE(mt_kahypar_imbalance(partitioned_hg, context), 0.03);
+
+    // Verify Block Weights
+    std::vector<mt_kahypar_partition_id_t> partition(mt_kahypar_num_hypernodes(hypergraph));
+    mt_kahypar_get_partition(partitioned_hg, partition.data());
+    std::vector<mt_kahypar_hypernode_weight_t> expected_block_weights(4, 0);
+    for ( mt_kahypar_hypernode_id_t hn = 0; hn < partition.size(); ++hn ) {
+      ASSERT_GE(partition[hn], 0);
+      ASSERT_LT(partition[hn], 4);
+      expected_block_weights[partition[hn]] += mt_kahypar_hypernode_weight(hypergraph, hn);
+    }
+    std::vector<mt_kahypar_hypernode_weight_t> block_weights(4);
+    mt_kahypar_get_block_weights(partitioned_hg, block_weights.data());
+    ASSERT_EQ(expected_block_weights, block_weights);
+  }
+
+  TEST_F(APartitioner, KeepsBlocksOfNodesFarFromTheHypergraphDelta) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1, false);
+    LoadTwoDisjointCopies(HYPERGRAPH_FILE, HMETIS);
+    PartitionNoSetup(4, 0.03);
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    std::vector<mt_kahypar_partition_id_t> partition_before(num_nodes);
+    mt_kahypar_get_partition(partitioned_hg, partition_before.data());
+
+    // All changes are located in the first copy of the hypergraph
+    std::vector<size_t> added_hyperedge_indices = { 0 };
+    std::vector<mt_kahypar_hypernode_id_t> added_hyperedges;
+    for ( mt_kahypar_hypernode_id_t i = 0; i < 10; ++i ) {
+      added_hyperedges.push_back(i);
+      added_hyperedges.push_back(i + 100);
+      added_hyperedges.push_back(i + 200);
+      added_hyperedge_indices.push_back(added_hyperedges.size());
+    }
+    std::vector<mt_kahypar_hyperedge_weight_t> added_hyperedge_weights(10, 5);
+    mt_kahypar_hypergraph_delta_t delta{};
+    delta.added_hyperedge_indices = added_hyperedge_indices.data();
+    delta.added_hyperedges = added_hyperedges.data();
+    delta.added_hyperedge_weights = added_hyperedge_weights.data();
+    delta.num_added_hyperedges = 10;
+
+    ASSERT_EQ(mt_kahypar_update_partition(hypergraph, partitioned_hg, &delta, context, &error), SUCCESS);
+    std::vector<mt_kahypar_partition_id_t> partition_after(num_nodes);
+    mt_kahypar_get_partition(partitioned_hg, partition_after.data());
+    // Localized refinement can not reach the second copy
+    for ( mt_kahypar_hypernode_id_t hn = num_nodes / 2; hn < num_nodes; ++hn ) {
+      ASSERT_EQ(partition_before[hn], partition_after[hn]) << V(hn);
+    }
+  }
+
+  TEST_F(APartitioner, UpdatedPartitionIsNotWorseThanThePartitionBeforeTheUpdate) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    std::vector<mt_kahypar_partition_id_t> partition_before(num_nodes);
+    mt_kahypar_get_partition(partitioned_hg, partition_before.data());
+
+    // Heavy hyperedges between nodes of different blocks
+    std::vector<size_t> added_hyperedge_indices = { 0 };
+    std::vector<mt_kahypar_hypernode_id_t> added_hyperedges;
+    for ( mt_kahypar_hypernode_id_t hn = 0; hn < 1000; hn += 10 ) {
+      added_hyperedges.push_back(hn);
+      added_hyperedges.push_back(num_nodes - hn - 1);
+      added_hyperedge_indices.push_back(added_hyperedges.size());
+    }
+    const size_t num_added_hyperedges = added_hyperedge_indices.size() - 1;
+    std::vector<mt_kahypar_hyperedge_weight_t> added_hyperedge_weights(num_added_hyperedges, 10);
+    mt_kahypar_hypergraph_delta_t delta{};
+    delta.added_hyperedge_indices = added_hyperedge_indices.data();
+    delta.added_hyperedges = added_hyperedges.data();
+    delta.added_hyperedge_weights = added_hyperedge_weights.data();
+    delta.num_added_hyperedges = num_added_hyperedges;
+
+    ASSERT_EQ(mt_kahypar_update_partition(hypergraph, partitioned_hg, &delta, context, &error), SUCCESS);
+    // The node IDs are unchanged, i.e., the previous partition is a
+    // valid partition of the updated hypergraph
+    mt_kahypar_partitioned_hypergraph_t previous_phg = mt_kahypar_create_partitioned_hypergraph(
+      hypergraph, context, 4, partition_before.data(), &error);
+    ASSERT_LE(mt_kahypar_km1(partitioned_hg), mt_kahypar_km1(previous_phg));
+    ASSERT_LE(mt_kahypar_imbalance(partitioned_hg, context), 0.03);
+    mt_kahypar_free_partitioned_hypergraph(previous_phg);
+  }
+
+  TEST_F(APartitioner, UpdatePartitionFailsForGraphs) {
+    Partition(GRAPH_FILE, METIS, DEFAULT, 4, 0.03, CUT, false);
+    mt_kahypar_hypergraph_delta_t delta{};
+    ASSERT_EQ(mt_kahypar_update_partition(hypergraph, partitioned_hg, &delta, context, &error), UNSUPPORTED_OPERATION);
+    mt_kahypar_free_error_content(&error);
+  }
+
   TEST_F(APartitioner, PartitionsHypergraphWithIndividualBlockWeightsAndVCycle) {
     // Setup Individual Block Weights
     SetUpContext(DEFAULT, 4, 0.03, KM1, false);
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/parallel/memory_accounting.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/utils/timer.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace parallel {
+
+// Allocations are flushed to the global counter in batches of at most 1 MB per thread
+static constexpr size_t TOLERANCE = 2 * 1000000;
+static constexpr size_t NUM_ELEMENTS = 4000000;
+static constexpr size_t SIZE_IN_BYTES = NUM_ELEMENTS * sizeof(size_t);
+
+TEST(AMemoryAccounting, TracksAllocationsOfScalableVectors) {
+  MemoryAccounting& accounting = MemoryAccounting::instance();
+  const size_t before = accounting.currentBytes();
+  {
+    scalable_vector<size_t> vec(NUM_ELEMENTS, 0);
+    ASSERT_GE(accounting.currentBytes() + TOLERANCE, before + SIZE_IN_BYTES);
+    ASSERT_GE(accounting.peakBytes() + TOLERANCE, before + SIZE_IN_BYTES);
+  }
+  ASSERT_LE(accounting.currentBytes(), before + TOLERANCE);
+}
+
+TEST(AMemoryAccounting, TracksAllocationsOfArrays) {
+  MemoryAccounting& accounting = MemoryAccounting::instance();
+  const size_t before = accounting.currentBytes();
+  {
+    ds::Array<size_t> array(NUM_ELEMENTS, 0);
+    ASSERT_GE(accounting.currentBytes() + TOLERANCE, before + SIZE_IN_BYTES);
+  }
+  ASSERT_LE(accounting.currentBytes(), before + TOLERANCE);
+}
+
+TEST(AMemoryAccounting, TracksHighWaterMarkOfPhases) {
+  MemoryAccounting& accounting = MemoryAccounting::instance();
+  const size_t before = accounting.currentBytes();
+  const size_t outer = accounting.startPeakTracking();
+  const size_t inner = accounting.startPeakTracking();
+  ASSERT_NE(outer, inner);
+  {
+    scalable_vector<size_t> vec(NUM_ELEMENTS, 0);
+  }
+  const size_t inner_peak = accounting.stopPeakTracking(inner);
+  {
+    scalable_vector<size_t> vec(NUM_ELEMENTS / 2, 0);
+  }
+  const size_t outer_peak = accounting.stopPeakTracking(outer);
+  ASSERT_GE(inner_peak + TOLERANCE, before + SIZE_IN_BYTES);
+  ASSERT_GE(outer_peak, inner_peak);
+  ASSERT_LE(accounting.currentBytes(), before + TOLERANCE);
+}
+
+TEST(AMemoryAccounting, TracksPeaksOfInterleavedPhasesIndependently) {
+  // Phases of concurrent partitioning calls are not nested
+  MemoryAccounting& accounting = MemoryAccounting::instance();
+  const size_t before = accounting.currentBytes();
+  const size_t first = accounting.startPeakTracking();
+  {
+    scalable_vector<size_t> vec(NUM_ELEMENTS, 0);
+  }
+  const size_t second = accounting.startPeakTracking();
+  const size_t first_peak = accounting.stopPeakTracking(first);
+  {
+    scalable_vector<size_t> vec(NUM_ELEMENTS / 4, 0);
+  }
+  const size_t second_peak = accounting.stopPeakTracking(second);
+  ASSERT_GE(first_peak + TOLERANCE, before + SIZE_IN_BYTES);
+  // The second phase started after the large allocation was freed
+  ASSERT_LE(second_peak, before + SIZE_IN_BYTES / 4 + 2 * TOLERANCE);
+}
+
+TEST(AMemoryAccounting, TracksPeakMemoryOfEachTimer) {
+  MemoryAccounting& accounting = MemoryAccounting::instance();
+  const size_t before = accounting.currentBytes();
+  utils::Timer first_timer;
+  utils::Timer second_timer;
+  // The timings are not nested, e.g., timings of concurrent partitioning calls
+  first_timer.start_timer("first", "First");
+  {
+    scalable_vector<size_t> vec(NUM_ELEMENTS, 0);
+  }
+  second_timer.start_timer("second", "Second");
+  first_timer.stop_timer("first");
+  {
+    scalable_vector<size_t> vec(NUM_ELEMENTS / 4, 0);
+  }
+  second_timer.stop_timer("second");
+  auto peak_memory_in_bytes = [&](const utils::Timer& timer, const std::string& description) {
+    std::stringstream out;
+    timer.printPeakMemory(out);
+    const std::string line = out.str();
+    EXPECT_THAT(line, ::testing::HasSubstr(description));
+    return static_cast<size_t>(std::stod(line.substr(line.find("= ") + 2)) * 1000000.0);
+  };
+  const size_t first_peak = peak_memory_in_bytes(first_timer, "First");
+  const size_t second_peak = peak_memory_in_bytes(second_timer, "Second");
+  ASSERT_GE(first_peak + TOLERANCE, before + SIZE_IN_BYTES);
+  ASSERT_LE(second_peak, before + SIZE_IN_BYTES / 4 + 2 * TOLERANCE);
+}
+
+TEST(AMemoryAccounting, ComputesRemainingMemoryBudget) {
+  MemoryAccounting& accounting = MemoryAccounting::instance();
+  ASSERT_FALSE(accounting.hasMemoryLimit());
+  accounting.setMemoryLimit(accounting.currentBytes() + SIZE_IN_BYTES);
+  ASSERT_TRUE(accounting.hasMemoryLimit());
+  ASSERT_TRUE(accounting.fitsIntoMemoryLimit(SIZE_IN_BYTES - TOLERANCE));
+  ASSERT_FALSE(accounting.fitsIntoMemoryLimit(SIZE_IN_BYTES + TOLERANCE));
+  {
+    scalable_vector<size_t> vec(NUM_ELEMENTS, 0);
+    ASSERT_LE(accounting.remainingBytes(), TOLERANCE);
+  }
+  accounting.setMemoryLimit(MemoryAccounting::kNoMemoryLimit);
+  ASSERT_FALSE(accounting.hasMemoryLimit());
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/numa_placement.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace parallel {
+
+class ANumaPlacement : public Test {
+ public:
+  ANumaPlacement() :
+    placement(NumaPlacement::instance()) {
+    // Three NUMA nodes with 2, 1 and 1 threads
+    placement.enableWithoutHardwareBinding({ 2, 1, 1 });
+  }
+
+  ~ANumaPlacement() {
+    placement.disable();
+  }
+
+  NumaPlacement& placement;
+};
+
+TEST_F(ANumaPlacement, SplitsRangeProportionalToNumberOfThreads) {
+  ASSERT_TRUE(placement.isEnabled());
+  ASSERT_EQ(UL(3), placement.numNumaNodes());
+  ASSERT_THAT(placement.rangeBounds(100), ::testing::ElementsAre(0, 50, 75, 100));
+}
+
+TEST_F(ANumaPlacement, ComputesOwnerOfEachID) {
+  const size_t n = 10;
+  const std::vector<size_t> bounds = placement.rangeBounds(n);
+  for ( size_t id = 0; id < n; ++id ) {
+    const size_t owner = placement.owner(id, n);
+    ASSERT_LE(bounds[owner], id);
+    ASSERT_LT(id, bounds[owner + 1]);
+  }
+  ASSERT_EQ(UL(0), placement.owner(4, n));
+  ASSERT_EQ(UL(1), placement.owner(5, n));
+  ASSERT_EQ(UL(2), placement.owner(9, n));
+}
+
+TEST_F(ANumaPlacement, AssignsAllPinsOfAHyperedgeToItsOwner) {
+  // Hyperedges of very different sizes, i.e., splitting the incidence array
+  // by pin position would separate pins from the owner of their hyperedge
+  ds::StaticHypergraph hypergraph = ds::StaticHypergraphFactory::construct(
+    12, 4, { { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }, { 0, 11 }, { 1, 2 }, { 3, 4, 5 } });
+  std::vector<size_t> first_entry(hypergraph.initialNumEdges() + 1, 0);
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    first_entry[he + 1] = first_entry[he] + hypergraph.edgeSize(he);
+  }
+  const std::vector<size_t> bounds = placement.entryBounds(hypergraph.initialNumPins(),
+    hypergraph.initialNumEdges(), [&](const size_t he) { return first_entry[he]; });
+  ASSERT_THAT(bounds, ::testing::ElementsAre(0, 13, 15, 18));
+  ASSERT_NE(placement.rangeBounds(hypergraph.initialNumPins()), bounds);
+
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    const size_t owner = placement.owner(he, hypergraph.initialNumEdges());
+    ASSERT_LE(bounds[owner], first_entry[he]);
+    ASSERT_LE(first_entry[he + 1], bounds[owner + 1]);
+  }
+}
+
+TEST_F(ANumaPlacement, HandlesMoreNumaNodesThanIDs) {
+  // Only two IDs for three NUMA nodes => the second NUMA node owns no entries
+  const std::vector<size_t> bounds = placement.entryBounds(5, 2, [](const size_t id) {
+    return id == 0 ? UL(0) : UL(3);
+  });
+  ASSERT_THAT(bounds, ::testing::ElementsAre(0, 3, 3, 5));
+}
+
+TEST_F(ANumaPlacement, ProcessesAllIDsInParallelFor) {
+  std::vector<uint8_t> visited(1000, 0);
+  placement.parallel_for(visited.size(), [&](const size_t id) {
+    ++visited[id];
+  });
+  for ( const uint8_t count : visited ) {
+    ASSERT_EQ(1, count);
+  }
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
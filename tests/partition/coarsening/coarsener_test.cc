@@ -93,6 +93,45 @@ TEST_F(AMultilevelCoarsener, ProjectsPartitionBackToOriginalHypergraph) {
   }
 }
 
+TEST_F(AMultilevelCoarsener, ProjectsPartitionBackToOriginalHypergraphWithDroppedLevels) {
+  using PartitionedHypergraph = typename StaticHypergraphTypeTraits::PartitionedHypergraph;
+  context.coarsening.contraction_limit = 4;
+  context.coarsening.maximum_shrink_factor = 2.0;
+  context.coarsening.hierarchy_memory_budget = 1;
+  context.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::do_nothing;
+  context.refinement.fm.algorithm = FMAlgorithm::do_nothing;
+  context.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+  context.type = ContextType::initial_partitioning;
+  doCoarsening();
+  ASSERT_GT(uncoarseningData->hierarchy.size(), UL(1));
+  ASSERT_GT(uncoarseningData->numDroppedLevels(), UL(0));
+  ASSERT_TRUE(uncoarseningData->hierarchy.back().isMaterialized());
+
+  // Without a budget, the block of a vertex is the block of
+  // its representative in the coarsest hypergraph
+  PartitionedHypergraph& coarsest_partitioned_hypergraph =
+    utils::cast<PartitionedHypergraph>(coarsener->coarsestPartitionedHypergraph());
+  for ( const HypernodeID& hn : coarsest_partitioned_hypergraph.nodes() ) {
+    coarsest_partitioned_hypergraph.setNodePart(hn, hn % context.partition.k);
+  }
+  vec<PartitionID> expected_part_ids(hypergraph.initialNumNodes(), kInvalidPartition);
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    HypernodeID coarse_hn = hn;
+    for ( const auto& level : uncoarseningData->hierarchy ) {
+      coarse_hn = level.mapToContractedHypergraph(coarse_hn);
+    }
+    expected_part_ids[hn] = coarsest_partitioned_hypergraph.partID(coarse_hn);
+  }
+
+  PartitionedHypergraph partitioned_hypergraph = uncoarsener->uncoarsen();
+  ASSERT_EQ(uncoarseningData->numRestoredLevels(), uncoarseningData->numDroppedLevels());
+  ASSERT_GT(partitioned_hypergraph.partWeight(0), 0);
+  ASSERT_GT(partitioned_hypergraph.partWeight(1), 0);
+  for ( const HypernodeID& hn : partitioned_hypergraph.nodes() ) {
+    ASSERT_EQ(expected_part_ids[hn], partitioned_hypergraph.partID(hn));
+  }
+}
+
 #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
 using ANLevelCoarsener = ACoarsener<DynamicHypergraphTypeTraits,
                                     NLevelCoarsener,
@@ -146,6 +185,36 @@ TEST_F(ANLevelCoarsener, ProjectsPartitionBackToOriginalHypergraph) {
     ASSERT_EQ(part_id, partitioned_hypergraph.partID(hn));
   }
 }
+
+TEST_F(ANLevelCoarsener, RemovesHyperedgesOfSizeOneWithRoundBasedRegistration) {
+  using Hypergraph = typename DynamicHypergraphTypeTraits::Hypergraph;
+  context.coarsening.contraction_limit = 4;
+  context.coarsening.nlevel_registration_sub_rounds = 2;
+  doCoarsening();
+  auto& hypergraph = utils::cast<Hypergraph>(coarsener->coarsestHypergraph());
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    ASSERT_GE(hypergraph.edgeSize(he), 2);
+  }
+}
+
+TEST_F(ANLevelCoarsener, ProjectsPartitionBackToOriginalHypergraphWithRoundBasedRegistration) {
+  using PartitionedHypergraph = typename DynamicHypergraphTypeTraits::PartitionedHypergraph;
+  context.coarsening.contraction_limit = 4;
+  context.coarsening.nlevel_registration_sub_rounds = 2;
+  context.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::do_nothing;
+  context.refinement.fm.algorithm = FMAlgorithm::do_nothing;
+  context.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+  context.type = ContextType::initial_partitioning;
+  doCoarsening();
+  PartitionedHypergraph& coarsest_partitioned_hypergraph =
+    utils::cast<PartitionedHypergraph>(coarsener->coarsestPartitionedHypergraph());
+  assignPartitionIDs(coarsest_partitioned_hypergraph);
+  PartitionedHypergraph partitioned_hypergraph = uncoarsener->uncoarsen();
+  for ( const HypernodeID& hn : partitioned_hypergraph.nodes() ) {
+    PartitionID part_id = 0;
+    ASSERT_EQ(part_id, partitioned_hypergraph.partID(hn));
+  }
+}
 #endif
 
 }  // namespace mt_kahypar
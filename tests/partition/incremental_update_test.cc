@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/incremental_update.h"
+#include "mt-kahypar/utils/exception.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+}
+
+class AnIncrementalUpdate : public Test {
+ public:
+  AnIncrementalUpdate() :
+    hypergraph(HypergraphFactory::construct(
+      7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} }, nullptr, nullptr, true)),
+    partitioned_hg(2, hypergraph, parallel_tag_t { }) {
+    const vec<PartitionID> partition = { 0, 0, 0, 1, 1, 1, 1 };
+    for ( HypernodeID hn = 0; hn < 7; ++hn ) {
+      partitioned_hg.setOnlyNodePart(hn, partition[hn]);
+    }
+    partitioned_hg.initializePartition();
+  }
+
+  vec<HypernodeID> applyDelta(const HypergraphDelta& delta) {
+    return IncrementalUpdate<TypeTraits>::applyDelta(partitioned_hg, delta);
+  }
+
+  Hypergraph hypergraph;
+  PartitionedHypergraph partitioned_hg;
+};
+
+TEST_F(AnIncrementalUpdate, KeepsBlocksOfExistingNodes) {
+  HypergraphDelta delta;
+  delta.added_nodes = { 1 };
+  delta.added_edges = { { 7, 0 } };
+  applyDelta(delta);
+  ASSERT_EQ(8, partitioned_hg.initialNumNodes());
+  const vec<PartitionID> expected = { 0, 0, 0, 1, 1, 1, 1 };
+  for ( HypernodeID hn = 0; hn < 7; ++hn ) {
+    ASSERT_EQ(expected[hn], partitioned_hg.partID(hn));
+  }
+}
+
+TEST_F(AnIncrementalUpdate, ReturnsOnlyNodesAroundTheChangedRegion) {
+  HypergraphDelta delta;
+  delta.edge_weight_changes = { { 0, 5 } };
+  const vec<HypernodeID> refinement_nodes = applyDelta(delta);
+  ASSERT_THAT(refinement_nodes, ::testing::ElementsAre(0, 2));
+}
+
+TEST_F(AnIncrementalUpdate, CountsEachBlockOfAnIncidentHyperedge) {
+  // Node 7 is contained in a hyperedge with pins in both blocks (weight 2)
+  // and in a hyperedge with a pin in block 0 (weight 1). The first pin of
+  // the heavier hyperedge is in block 1, but block 0 is connected stronger.
+  HypergraphDelta delta;
+  delta.added_nodes = { 1 };
+  delta.added_edges = { { 3, 0, 7 }, { 1, 7 } };
+  delta.added_edge_weights = { 2, 1 };
+  applyDelta(delta);
+  ASSERT_EQ(0, partitioned_hg.partID(7));
+}
+
+TEST_F(AnIncrementalUpdate, RejectsDuplicatePinsInAddedHyperedges) {
+  HypergraphDelta delta;
+  delta.added_edges = { { 0, 5, 0 } };
+  ASSERT_THROW(applyDelta(delta), InvalidInputException);
+}
+
+}  // namespace mt_kahypar
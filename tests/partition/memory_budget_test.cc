@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/parallel/memory_accounting.h"
+#include "mt-kahypar/partition/memory_budget.h"
+#include "mt-kahypar/utils/cast.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class AMemoryBudget : public Test {
+ public:
+  AMemoryBudget() :
+    context() {
+    context.partition.k = 8;
+    context.partition.objective = Objective::km1;
+    context.partition.preset_type = PresetType::default_preset;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = MULTILEVEL_HYPERGRAPH_PARTITIONING;
+    context.partition.verbose_output = false;
+    context.initial_partitioning.population_size = 16;
+    context.refinement.flows.algorithm = FlowAlgorithm::flow_cutter;
+    context.refinement.flows.num_parallel_searches = 32;
+    context.refinement.flows.max_num_pins = 1000;
+  }
+
+  ~AMemoryBudget() {
+    parallel::MemoryAccounting::instance().setMemoryLimit(
+      parallel::MemoryAccounting::kNoMemoryLimit);
+  }
+
+  // ! Leaves exactly the given number of bytes until the memory limit is reached
+  void leaveRemainingBytes(const size_t remaining_bytes) {
+    auto& accounting = parallel::MemoryAccounting::instance();
+    accounting.setMemoryLimit(accounting.currentBytes() + remaining_bytes);
+  }
+
+  Context context;
+};
+
+TEST_F(AMemoryBudget, KeepsPopulationSizeWithoutMemoryLimit) {
+  adapt_initial_partitioning_to_memory_limit(1000, context);
+  ASSERT_EQ(16, context.initial_partitioning.population_size);
+}
+
+TEST_F(AMemoryBudget, ReducesPopulationSizeOfInitialPartitioningPool) {
+  leaveRemainingBytes(5 * 1000 * sizeof(PartitionID));
+  adapt_initial_partitioning_to_memory_limit(1000, context);
+  ASSERT_EQ(5, context.initial_partitioning.population_size);
+}
+
+TEST_F(AMemoryBudget, KeepsAtLeastOnePartitionInInitialPartitioningPool) {
+  leaveRemainingBytes(0);
+  adapt_initial_partitioning_to_memory_limit(1000, context);
+  ASSERT_EQ(1, context.initial_partitioning.population_size);
+}
+
+TEST_F(AMemoryBudget, KeepsNumberOfParallelFlowSearchesIfTheyFitIntoMemoryLimit) {
+  leaveRemainingBytes(64 * 1000 * 64);
+  adapt_flows_to_memory_limit(100000, context);
+  ASSERT_EQ(32, context.refinement.flows.num_parallel_searches);
+}
+
+TEST_F(AMemoryBudget, ReducesNumberOfParallelFlowSearches) {
+  // Each search requires at most 1000 pins * 64 bytes
+  leaveRemainingBytes(4 * 1000 * 64);
+  adapt_flows_to_memory_limit(100000, context);
+  ASSERT_EQ(4, context.refinement.flows.num_parallel_searches);
+}
+
+TEST_F(AMemoryBudget, BoundsSizeOfFlowSearchesByNumberOfPins) {
+  // The hypergraph has less pins than the maximum size of a flow problem
+  leaveRemainingBytes(4 * 1000 * 64);
+  adapt_flows_to_memory_limit(500, context);
+  ASSERT_EQ(8, context.refinement.flows.num_parallel_searches);
+}
+
+TEST_F(AMemoryBudget, RunsAtLeastOneFlowSearch) {
+  leaveRemainingBytes(0);
+  adapt_flows_to_memory_limit(100000, context);
+  ASSERT_EQ(1, context.refinement.flows.num_parallel_searches);
+}
+
+TEST_F(AMemoryBudget, DoesNotAdaptFlowsIfFlowsAreDisabled) {
+  context.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+  leaveRemainingBytes(0);
+  adapt_flows_to_memory_limit(100000, context);
+  ASSERT_EQ(32, context.refinement.flows.num_parallel_searches);
+}
+
+#ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+TEST_F(AMemoryBudget, KeepsDenseConnectivityInformationWithoutMemoryLimit) {
+  context.partition.k = 1024;
+  ds::StaticHypergraph hypergraph = io::readInputFile<ds::StaticHypergraph>(
+    "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+  adapt_connectivity_to_memory_limit(utils::hypergraph_cast(hypergraph), context);
+  ASSERT_FALSE(context.partition.use_sparse_connectivity);
+  ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, context.partition.partition_type);
+}
+
+TEST_F(AMemoryBudget, SwitchesToSparseConnectivityInformation) {
+  context.partition.k = 1024;
+  ds::StaticHypergraph hypergraph = io::readInputFile<ds::StaticHypergraph>(
+    "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+  leaveRemainingBytes(0);
+  adapt_connectivity_to_memory_limit(utils::hypergraph_cast(hypergraph), context);
+  ASSERT_TRUE(context.partition.use_sparse_connectivity);
+  ASSERT_EQ(LARGE_K_PARTITIONING, context.partition.partition_type);
+}
+
+TEST_F(AMemoryBudget, KeepsDenseConnectivityInformationForSteinerTreeObjective) {
+  context.partition.k = 1024;
+  context.partition.objective = Objective::steiner_tree;
+  ds::StaticHypergraph hypergraph = io::readInputFile<ds::StaticHypergraph>(
+    "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+  leaveRemainingBytes(0);
+  adapt_connectivity_to_memory_limit(utils::hypergraph_cast(hypergraph), context);
+  ASSERT_FALSE(context.partition.use_sparse_connectivity);
+  ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, context.partition.partition_type);
+}
+#endif
+
+}  // namespace mt_kahypar
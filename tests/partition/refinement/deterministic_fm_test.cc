@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <tbb/task_arena.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/refinement/deterministic/deterministic_fm.h"
+#include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
+#include "mt-kahypar/partition/initial_partitioning/bfs_initial_partitioner.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+template <typename TypeTraitsT, PartitionID k>
+struct TestConfig {
+  using TypeTraits = TypeTraitsT;
+  static constexpr PartitionID K = k;
+};
+
+template<typename Config>
+class DeterministicFMTest : public Test {
+
+ public:
+  using TypeTraits = typename Config::TypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using Refiner = DeterministicFMRefiner<GraphAndGainTypes<TypeTraits, Km1GainTypes>>;
+
+  DeterministicFMTest() :
+          hypergraph(),
+          partitioned_hypergraph(),
+          context(),
+          gain_cache(),
+          refiner(nullptr),
+          metrics() {
+    TBBInitializer::instance(std::thread::hardware_concurrency());
+    context.partition.graph_filename = "../tests/instances/contracted_ibm01.hgr";
+    context.partition.graph_community_filename = "../tests/instances/contracted_ibm01.hgr.community";
+    context.partition.mode = Mode::direct;
+    context.partition.epsilon = 0.25;
+    context.partition.k = Config::K;
+    context.partition.preset_type = PresetType::deterministic;
+    context.partition.deterministic = true;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = PartitionedHypergraph::TYPE;
+    context.partition.verbose_output = false;
+
+    // Shared Memory
+    context.shared_memory.original_num_threads = std::thread::hardware_concurrency();
+    context.shared_memory.num_threads = std::thread::hardware_concurrency();
+
+    // Initial Partitioning
+    context.initial_partitioning.mode = Mode::deep_multilevel;
+    context.initial_partitioning.runs = 1;
+
+    context.refinement.fm.algorithm = FMAlgorithm::deterministic;
+    context.refinement.fm.multitry_rounds = 10;
+    context.refinement.fm.num_seed_nodes = 5;
+    context.refinement.fm.rollback_balance_violation_factor = 1.0;
+    context.refinement.deterministic_refinement.num_sub_rounds_fm = 4;
+
+    context.partition.objective = Objective::km1;
+    context.partition.gain_policy = GainPolicy::km1;
+
+    // Read hypergraph
+    hypergraph = io::readInputFile<Hypergraph>(
+      "../tests/instances/contracted_unweighted_ibm01.hgr", FileFormat::hMetis, true);
+    partitioned_hypergraph = PartitionedHypergraph(
+            context.partition.k, hypergraph, parallel_tag_t());
+    context.setupPartWeights(hypergraph.totalWeight());
+    initialPartition();
+
+    refiner = std::make_unique<Refiner>(hypergraph.initialNumNodes(),
+      hypergraph.initialNumEdges(), context, gain_cache);
+    mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hypergraph);
+    refiner->initialize(phg);
+  }
+
+  void initialPartition() {
+    Context ip_context(context);
+    ip_context.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::do_nothing;
+    ip_context.refinement.fm.algorithm = FMAlgorithm::do_nothing;
+    InitialPartitioningDataContainer<TypeTraits> ip_data(partitioned_hypergraph, ip_context);
+    ip_data_container_t* ip_data_ptr = ip::to_pointer(ip_data);
+    BFSInitialPartitioner<TypeTraits> initial_partitioner(
+      InitialPartitioningAlgorithm::bfs, ip_data_ptr, ip_context, 420, 0);
+    initial_partitioner.partition();
+    ip_data.apply();
+    metrics.quality = metrics::quality(partitioned_hypergraph, context);
+    metrics.imbalance = metrics::imbalance(partitioned_hypergraph, context);
+  }
+
+  // ! Refines a copy of the initial partition with the given number of threads
+  vec<PartitionID> refineWithNumberOfThreads(const int num_threads) {
+    PartitionedHypergraph phg(context.partition.k, hypergraph, parallel_tag_t());
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      phg.setOnlyNodePart(hn, partitioned_hypergraph.partID(hn));
+    }
+    phg.initializePartition();
+
+    Km1GainCache local_gain_cache;
+    Refiner local_refiner(hypergraph.initialNumNodes(),
+      hypergraph.initialNumEdges(), context, local_gain_cache);
+    Metrics local_metrics = metrics;
+    tbb::task_arena arena(num_threads);
+    arena.execute([&] {
+      mt_kahypar_partitioned_hypergraph_t hg = utils::partitioned_hg_cast(phg);
+      local_refiner.initialize(hg);
+      local_refiner.refine(hg, {}, local_metrics, std::numeric_limits<double>::max());
+    });
+
+    vec<PartitionID> partition(hypergraph.initialNumNodes(), kInvalidPartition);
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      partition[hn] = phg.partID(hn);
+    }
+    return partition;
+  }
+
+  Hypergraph hypergraph;
+  PartitionedHypergraph partitioned_hypergraph;
+  Context context;
+  Km1GainCache gain_cache;
+  std::unique_ptr<Refiner> refiner;
+  Metrics metrics;
+};
+
+typedef ::testing::Types<TestConfig<StaticHypergraphTypeTraits, 2>,
+                         TestConfig<StaticHypergraphTypeTraits, 4>,
+                         TestConfig<StaticHypergraphTypeTraits, 8>,
+                         TestConfig<StaticHypergraphTypeTraits, 128> > TestConfigs;
+
+TYPED_TEST_SUITE(DeterministicFMTest, TestConfigs);
+
+TYPED_TEST(DeterministicFMTest, DoesNotViolateBalanceConstraint) {
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_LE(this->metrics.imbalance, this->context.partition.epsilon);
+  ASSERT_DOUBLE_EQ(metrics::imbalance(this->partitioned_hypergraph, this->context), this->metrics.imbalance);
+}
+
+TYPED_TEST(DeterministicFMTest, UpdatesMetricsCorrectly) {
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context.partition.objective),
+            this->metrics.quality);
+}
+
+TYPED_TEST(DeterministicFMTest, DoesNotWorsenSolutionQuality) {
+  HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_LE(this->metrics.quality, objective_before);
+}
+
+TYPED_TEST(DeterministicFMTest, ComputesSamePartitionIndependentOfNumberOfThreads) {
+  const vec<PartitionID> sequential_partition = this->refineWithNumberOfThreads(1);
+  const int max_threads = std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
+  for ( const int num_threads : { 2, max_threads } ) {
+    const vec<PartitionID> parallel_partition = this->refineWithNumberOfThreads(num_threads);
+    ASSERT_EQ(sequential_partition, parallel_partition) << V(num_threads);
+  }
+}
+
+}  // namespace mt_kahypar
@@ -174,7 +174,7 @@ class AGainCache : public Test {
     });
   }
 
-  void moveAllNodesAtRandomOnDeltaPartition() {
+  void moveAllNodesAtRandomOnDeltaPartition(const bool graph_specialized_updates = false) {
     auto update_delta_gain_cache = [&](const SynchronizedEdgeUpdate& sync_update) {
       delta_gain_cache->deltaGainUpdate(*delta_phg, sync_update);
     };
@@ -186,11 +186,19 @@ class AGainCache : public Test {
         const PartitionID from = delta_phg->partID(hn);
         const PartitionID to = rand.getRandomInt(0, k - 1, THREAD_ID);
         if ( from != to && was_moved.compare_and_set_to_true(hn) ) {
+          if constexpr ( GainCache::TYPE == GainPolicy::cut_for_graphs ) {
+            if ( graph_specialized_updates ) {
+              delta_phg->changeNodePart(hn, from, to, std::numeric_limits<HyperedgeWeight>::max());
+              delta_gain_cache->deltaGainUpdateOfMovedNode(*delta_phg, hn, from, to);
+              continue;
+            }
+          }
           delta_phg->changeNodePart(hn, from, to,
             std::numeric_limits<HyperedgeWeight>::max(), update_delta_gain_cache);
         }
       }
     }
+    unused(graph_specialized_updates);
   }
 
   void moveAllNodesOfBatchAtRandom(const Batch& batch) {
@@ -470,6 +478,16 @@ TYPED_TEST(AGainCache, HasCorrectGainsAfterMovingAllNodesOnDeltaPartitionAtRando
   this->verifyGainCacheEntriesOnDeltaPartition();
 }
 
+TYPED_TEST(AGainCache, HasCorrectGainsAfterGraphSpecializedDeltaUpdates) {
+  this->initializePartition();
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->delta_gain_cache->initialize(8192);
+  // Only the cut gain cache for graphs supports graph-specialized delta updates,
+  // all other gain caches fall back to the synchronized edge updates
+  this->moveAllNodesAtRandomOnDeltaPartition(true);
+  this->verifyGainCacheEntriesOnDeltaPartition();
+}
+
 TYPED_TEST(AGainCache, ComparesGainsWithAttributedGains) {
   this->initializePartition();
   this->gain_cache.initializeGainCache(this->partitioned_hg);
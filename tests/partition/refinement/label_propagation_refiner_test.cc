@@ -213,6 +213,62 @@ TYPED_TEST(ALabelPropagationRefiner, DoesNotWorsenSolutionQuality) {
 }
 
 
+TYPED_TEST(ALabelPropagationRefiner, WorksWithParallelPriorityOrder) {
+  this->context.refinement.label_propagation.priority_ordered = true;
+  HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_LE(this->metrics.quality, objective_before);
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context.partition.objective),
+            this->metrics.quality);
+  ASSERT_LE(this->metrics.imbalance, this->context.partition.epsilon + EPS);
+}
+
+TYPED_TEST(ALabelPropagationRefiner, ProcessesNodesInPriorityOrder) {
+  this->context.refinement.label_propagation.priority_ordered = true;
+  this->context.refinement.label_propagation.execute_sequential = true;
+  this->context.refinement.label_propagation.maximum_iterations = 1;
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+
+  const vec<size_t>& popped_buckets = this->refiner->poppedBuckets();
+  ASSERT_FALSE(popped_buckets.empty());
+  for ( size_t i = 1; i < popped_buckets.size(); ++i ) {
+    ASSERT_GE(popped_buckets[i - 1], popped_buckets[i]);
+  }
+  // The initial partition is not locally optimal, so some nodes have a positive gain
+  ASSERT_GT(popped_buckets[0], UL(0));
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context.partition.objective),
+            this->metrics.quality);
+}
+
+TEST(AConcurrentGainBuckets, MapsGainsToLogarithmicBuckets) {
+  using GainBuckets = ds::ConcurrentGainBuckets<HypernodeID>;
+  ASSERT_EQ(UL(0), GainBuckets::bucketOf(-5));
+  ASSERT_EQ(UL(0), GainBuckets::bucketOf(0));
+  ASSERT_EQ(UL(1), GainBuckets::bucketOf(1));
+  ASSERT_EQ(UL(2), GainBuckets::bucketOf(2));
+  ASSERT_EQ(UL(2), GainBuckets::bucketOf(3));
+  ASSERT_EQ(UL(3), GainBuckets::bucketOf(4));
+  ASSERT_EQ(GainBuckets::NUM_BUCKETS - 1, GainBuckets::bucketOf(std::numeric_limits<Gain>::max()));
+}
+
+TEST(AConcurrentGainBuckets, ExtractsInsertedValues) {
+  ds::ConcurrentGainBuckets<HypernodeID> buckets;
+  buckets.insert(5, 0);
+  buckets.insert(7, 1);
+  buckets.insert(-1, 2);
+  ASSERT_EQ(UL(3), buckets.size());
+  ASSERT_TRUE(buckets.empty(1));
+  vec<HypernodeID> values = buckets.extract(3);
+  std::sort(values.begin(), values.end());
+  ASSERT_EQ(UL(2), values.size());
+  ASSERT_EQ(0U, values[0]);
+  ASSERT_EQ(1U, values[1]);
+  ASSERT_TRUE(buckets.empty(3));
+  ASSERT_EQ(UL(1), buckets.size());
+}
+
 TYPED_TEST(ALabelPropagationRefiner, ChangesTheNumberOfBlocks) {
   using PartitionedHypergraph = typename TestFixture::PartitionedHypergraph;
   HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
@@ -200,6 +200,60 @@ TYPED_TEST(MultiTryFMTest, AlsoWorksWithNonDefaultFeatures) {
   ASSERT_DOUBLE_EQ(metrics::imbalance(this->partitioned_hypergraph, this->context), this->metrics.imbalance);
 }
 
+TYPED_TEST(MultiTryFMTest, WorksWithAdaptiveRoundBudget) {
+  this->context.refinement.fm.adaptive_round_budget = true;
+  HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_LE(this->metrics.quality, objective_before);
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context.partition.objective),
+            this->metrics.quality);
+  ASSERT_LE(this->metrics.imbalance, this->context.partition.epsilon);
+}
+
+TYPED_TEST(MultiTryFMTest, WorksWithPipelinedLabelPropagation) {
+  this->context.refinement.fm.pipelined_label_propagation = true;
+  this->context.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::label_propagation;
+  this->context.refinement.label_propagation.maximum_iterations = 2;
+  HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_GT(this->refiner->numPipelinedLabelPropagationChunks(), UL(0));
+  ASSERT_LE(this->metrics.quality, objective_before);
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context.partition.objective),
+            this->metrics.quality);
+  ASSERT_LE(this->metrics.imbalance, this->context.partition.epsilon);
+}
+
+TYPED_TEST(MultiTryFMTest, DoesNotPipelineLabelPropagationInDeterministicMode) {
+  this->context.refinement.fm.pipelined_label_propagation = true;
+  this->context.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::label_propagation;
+  this->context.partition.deterministic = true;
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_EQ(UL(0), this->refiner->numPipelinedLabelPropagationChunks());
+}
+
+TYPED_TEST(MultiTryFMTest, DoesNotPipelineLabelPropagationIfLabelPropagationIsDisabled) {
+  this->context.refinement.fm.pipelined_label_propagation = true;
+  this->context.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::do_nothing;
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_EQ(UL(0), this->refiner->numPipelinedLabelPropagationChunks());
+}
+
+TYPED_TEST(MultiTryFMTest, RunsLocalizedSearchesSequentiallyWithASingleThread) {
+  // Small instances of a batch are partitioned with a thread budget of one
+  this->context.shared_memory.num_threads = 1;
+  HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_EQ(UL(1), this->refiner->maxNumLocalizedSearchTasks());
+  ASSERT_LE(this->metrics.quality, objective_before);
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context.partition.objective),
+            this->metrics.quality);
+}
+
 TYPED_TEST(MultiTryFMTest, WorksWithRefinementNodes) {
   parallel::scalable_vector<HypernodeID> refinement_nodes;
   for (HypernodeID u = 0; u < this->partitioned_hypergraph.initialNumNodes(); ++u) {
@@ -253,6 +307,53 @@ TYPED_TEST(MultiTryFMTest, ChangesTheNumberOfBlocks) {
             this->metrics.quality);
 }
 
+TEST(FMRoundBudgetTest, GrantsRoundsWithoutReference) {
+  FMRoundBudget budget(0.5);
+  budget.beginLevel(100);
+  budget.recordRound(10, 1.0);
+  ASSERT_TRUE(budget.continueLevel());
+}
+
+TEST(FMRoundBudgetTest, StopsLevelIfImprovementPerSecondDrops) {
+  FMRoundBudget budget(0.5);
+  budget.beginLevel(100);
+  budget.recordRound(100, 1.0);
+  budget.recordRound(60, 1.0);
+  ASSERT_TRUE(budget.continueLevel());
+  budget.recordRound(10, 1.0);
+  ASSERT_FALSE(budget.continueLevel());
+}
+
+TEST(FMRoundBudgetTest, ComparesAgainstCoarserLevels) {
+  FMRoundBudget budget(0.5);
+  budget.beginLevel(100);
+  budget.recordRound(100, 1.0);
+  budget.recordRound(100, 1.0);
+  budget.beginLevel(1000);
+  budget.recordRound(50, 10.0);
+  ASSERT_FALSE(budget.continueLevel());
+
+  ASSERT_EQ(UL(2), budget.telemetry().size());
+  ASSERT_EQ(UL(2), budget.telemetry()[0].rounds.size());
+  ASSERT_EQ(UL(1), budget.telemetry()[1].rounds.size());
+  ASSERT_EQ(1000U, budget.telemetry()[1].num_nodes);
+}
+
+TEST(FMRoundBudgetTest, MergesConsecutiveCallsOnTheSameLevel) {
+  FMRoundBudget budget(0.5);
+  // e.g., the batches of the n-level uncoarsening
+  for ( size_t batch = 0; batch < 3; ++batch ) {
+    budget.beginLevel(1000);
+    budget.recordRound(100, 1.0);
+  }
+  budget.beginLevel(2000);
+  budget.recordRound(100, 1.0);
+
+  ASSERT_EQ(UL(2), budget.telemetry().size());
+  ASSERT_EQ(UL(3), budget.telemetry()[0].rounds.size());
+  ASSERT_EQ(UL(1), budget.telemetry()[1].rounds.size());
+}
+
 TEST(UnconstrainedFMDataTest, CorrectlyComputesPenalty) {
   using TypeTraits = StaticHypergraphTypeTraits;
   using Hypergraph = typename TypeTraits::Hypergraph;
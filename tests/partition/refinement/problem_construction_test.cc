@@ -140,6 +140,32 @@ void verifyThatVertexSetAreDisjoint(const Subhypergraph& sub_hg_1, const Subhype
   }
 }
 
+TEST_F(AProblemConstruction, StoresOnlyAdjacentBlockPairsInTheQuotientGraph) {
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  qg.initialize(phg);
+
+  vec<vec<HyperedgeWeight>> expected_cut_weight(
+    context.partition.k, vec<HyperedgeWeight>(context.partition.k, 0));
+  for ( const HyperedgeID& he : phg.edges() ) {
+    for ( const PartitionID i : phg.connectivitySet(he) ) {
+      for ( const PartitionID j : phg.connectivitySet(he) ) {
+        if ( i < j ) {
+          expected_cut_weight[i][j] += phg.edgeWeight(he);
+        }
+      }
+    }
+  }
+
+  size_t num_adjacent_block_pairs = 0;
+  for ( PartitionID i = 0; i < context.partition.k; ++i ) {
+    for ( PartitionID j = i + 1; j < context.partition.k; ++j ) {
+      ASSERT_EQ(expected_cut_weight[i][j], qg.getCutHyperedgeWeightOfBlockPair(i, j));
+      num_adjacent_block_pairs += expected_cut_weight[i][j] > 0;
+    }
+  }
+  ASSERT_EQ(num_adjacent_block_pairs, qg.numStoredBlockPairs());
+}
+
 TEST_F(AProblemConstruction, GrowAnFlowProblemAroundTwoBlocks1) {
   ProblemConstruction<TypeTraits> constructor(
     hg.initialNumNodes(), hg.initialNumEdges(), context);
@@ -172,6 +198,43 @@ TEST_F(AProblemConstruction, GrowAnFlowProblemAroundTwoBlocks2) {
   verifyThatPartWeightsAreLessEqualToMaxPartWeight(sub_hg, search_id, qg);
 }
 
+TEST_F(AProblemConstruction, ReusesCachedRegionIfOnlyFewNodesMoved) {
+  context.refinement.flows.cache_constructions = true;
+  context.refinement.flows.max_changed_cached_region_fraction = 0.1;
+  ProblemConstruction<TypeTraits> constructor(
+    hg.initialNumNodes(), hg.initialNumEdges(), context);
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.shared_memory.num_threads);
+  qg.initialize(phg);
+
+  SearchID search_id = qg.requestNewSearch(refiner);
+  const Subhypergraph sub_hg = constructor.construct(search_id, qg, phg);
+  ASSERT_GT(sub_hg.nodes_of_block_0.size(), 1UL);
+  ASSERT_GT(sub_hg.nodes_of_block_1.size(), 0UL);
+
+  // Unchanged partition => cached region is returned as it is
+  const Subhypergraph cached_sub_hg = constructor.construct(search_id, qg, phg);
+  ASSERT_EQ(sub_hg.nodes_of_block_0, cached_sub_hg.nodes_of_block_0);
+  ASSERT_EQ(sub_hg.nodes_of_block_1, cached_sub_hg.nodes_of_block_1);
+  ASSERT_EQ(sub_hg.hes, cached_sub_hg.hes);
+  ASSERT_EQ(sub_hg.num_pins, cached_sub_hg.num_pins);
+
+  // A node moved to the other block of the pair switches sides
+  const HypernodeID moved_hn = sub_hg.nodes_of_block_0[0];
+  phg.changeNodePart(moved_hn, sub_hg.block_0, sub_hg.block_1);
+  const Subhypergraph patched_sub_hg = constructor.construct(search_id, qg, phg);
+  ASSERT_EQ(sub_hg.nodes_of_block_0.size() - 1, patched_sub_hg.nodes_of_block_0.size());
+  ASSERT_EQ(sub_hg.nodes_of_block_1.size() + 1, patched_sub_hg.nodes_of_block_1.size());
+  ASSERT_EQ(sub_hg.weight_of_block_0 - phg.nodeWeight(moved_hn), patched_sub_hg.weight_of_block_0);
+  ASSERT_EQ(sub_hg.weight_of_block_1 + phg.nodeWeight(moved_hn), patched_sub_hg.weight_of_block_1);
+  ASSERT_EQ(sub_hg.hes.size(), patched_sub_hg.hes.size());
+
+  const auto stats = constructor.fetchAndResetCacheStats();
+  ASSERT_EQ(2UL, stats.num_hits);
+  ASSERT_EQ(1UL, stats.num_misses);
+}
+
 TEST_F(AProblemConstruction, GrowTwoFlowProblemAroundTwoBlocksSimultanously) {
   ProblemConstruction<TypeTraits> constructor(
     hg.initialNumNodes(), hg.initialNumEdges(), context);
@@ -36,6 +36,7 @@
 #include "mt-kahypar/io/hypergraph_factory.h"
 
 #include "mt-kahypar/partition/refinement/fm/global_rollback.h"
+#include "mt-kahypar/partition/refinement/fm/best_prefix_scan.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 
 #include "mt-kahypar/partition/metrics.h"
@@ -161,4 +162,53 @@ TEST(RollbackTests, GainRecalculation2) {
   grb.verifyGains(phg, sharedData);
 }
 
+TEST(RollbackTests, BestPrefixScanMatchesSequentialScan) {
+  const PartitionID k = 4;
+  const MoveID num_moves = 100000;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<PartitionID> block_dist(0, k - 1);
+  std::uniform_int_distribution<Gain> gain_dist(-2, 3);
+  vec<HypernodeWeight> node_weights(num_moves);
+  vec<Move> moves(num_moves);
+  for ( MoveID i = 0; i < num_moves; ++i ) {
+    node_weights[i] = 1 + i % 3;
+    moves[i].node = i;
+    moves[i].from = block_dist(rng);
+    moves[i].to = ( moves[i].from + 1 ) % k;
+    moves[i].gain = gain_dist(rng);
+    if ( i % 10 == 0 ) {
+      moves[i].invalidate();
+    }
+  }
+  vec<HypernodeWeight> part_weights(k, 50000);
+  std::vector<HypernodeWeight> max_part_weights(k, 50500);
+
+  // sequential reference
+  BestPrefix expected { 0, 0, 50000 };
+  vec<HypernodeWeight> weights = part_weights;
+  Gain gain_sum = 0;
+  for ( MoveID i = 0; i < num_moves; ++i ) {
+    const Move& m = moves[i];
+    if ( m.isValid() ) {
+      weights[m.from] -= node_weights[m.node];
+      weights[m.to] += node_weights[m.node];
+      gain_sum += m.gain;
+      bool balanced = true;
+      for ( PartitionID p = 0; p < k; ++p ) {
+        balanced &= weights[p] <= max_part_weights[p];
+      }
+      if ( balanced ) {
+        expected = std::min(expected, BestPrefix { gain_sum, i + 1,
+          *std::max_element(weights.begin(), weights.end()) });
+      }
+    }
+  }
+
+  const BestPrefix actual = findBestBalancedPrefix(moves, num_moves, part_weights, max_part_weights,
+    [&](const HypernodeID u) { return node_weights[u]; });
+  ASSERT_EQ(expected.gain, actual.gain);
+  ASSERT_EQ(expected.best_index, actual.best_index);
+  ASSERT_EQ(expected.heaviest_weight, actual.heaviest_weight);
+}
+
 }   // namespace mt_kahypar
@@ -26,6 +26,8 @@
 
 #include "gmock/gmock.h"
 
+#include <tbb/task_arena.h>
+
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/hypergraph_io.h"
@@ -388,4 +390,187 @@ TEST_F(AFlowRefinementEndToEnd, SmokeTestWithFourBlocksPerRefiner) {
   }
 }
 
+TEST_F(AFlowRefinementEndToEnd, SmokeTestWithMultiwayFlowRefinement) {
+  context.refinement.flows.multiway_num_blocks = 3;
+  Km1GainCache gain_cache;
+  FlowRefinementScheduler<GraphAndGainTypes<TypeTraits, Km1GainTypes>> scheduler(
+    hg.initialNumNodes(), hg.initialNumEdges(), context, gain_cache);
+
+  Metrics metrics;
+  metrics.quality = metrics::quality(phg, context);
+  metrics.imbalance = metrics::imbalance(phg, context);
+  const HyperedgeWeight initial_quality = metrics.quality;
+
+  mt_kahypar_partitioned_hypergraph_t partitioned_hg = utils::partitioned_hg_cast(phg);
+  scheduler.initialize(partitioned_hg);
+  scheduler.refine(partitioned_hg, {}, metrics, 0.0);
+
+  // The blocks were also refined in clusters of three adjacent blocks
+  ASSERT_GT(utils::Utilities::instance().getTimer(
+    context.utility_id).get("multiway_flow_refinement"), 0.0);
+  ASSERT_LE(metrics.quality, initial_quality);
+  ASSERT_EQ(metrics::quality(phg, Objective::km1), metrics.quality);
+  ASSERT_EQ(metrics::imbalance(phg, context), metrics.imbalance);
+  for ( PartitionID i = 0; i < context.partition.k; ++i ) {
+    ASSERT_LE(phg.partWeight(i), context.partition.max_part_weights[i]);
+  }
+}
+
+TEST_F(AFlowRefinementEndToEnd, ComputesSamePartitionInDeterministicMode) {
+  context.partition.deterministic = true;
+  // As a flow refiner, each search only moves nodes between its two blocks
+  FlowRefinerMockControl::instance().refine_func = [&](const PartitionedHypergraph& phg,
+                                                       const Subhypergraph& sub_hg,
+                                                       const size_t) {
+    MoveSequence sequence { {}, 0 };
+    auto add_move = [&](const HypernodeID hn, const PartitionID from, const PartitionID to) {
+      HyperedgeWeight gain = 0;
+      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+        gain += phg.pinCountInPart(he, from) == 1 ? phg.edgeWeight(he) : 0;
+        gain -= phg.pinCountInPart(he, to) == 0 ? phg.edgeWeight(he) : 0;
+      }
+      if ( gain > 0 ) {
+        sequence.moves.push_back(Move { from, to, hn, -gain });
+        sequence.expected_improvement += gain;
+      }
+    };
+    for ( const HypernodeID& hn : sub_hg.nodes_of_block_0 ) {
+      add_move(hn, sub_hg.block_0, sub_hg.block_1);
+    }
+    for ( const HypernodeID& hn : sub_hg.nodes_of_block_1 ) {
+      add_move(hn, sub_hg.block_1, sub_hg.block_0);
+    }
+    return sequence;
+  };
+  vec<PartitionID> initial_partition(phg.initialNumNodes(), kInvalidPartition);
+  phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    initial_partition[hn] = phg.partID(hn);
+  });
+
+  auto refine = [&] {
+    phg.resetPartition();
+    phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      phg.setOnlyNodePart(hn, initial_partition[hn]);
+    });
+    phg.initializePartition();
+
+    context.refinement.flows.num_parallel_searches = context.shared_memory.num_threads;
+    Km1GainCache gain_cache;
+    FlowRefinementScheduler<GraphAndGainTypes<TypeTraits, Km1GainTypes>> scheduler(
+      hg.initialNumNodes(), hg.initialNumEdges(), context, gain_cache);
+    Metrics metrics;
+    metrics.quality = metrics::quality(phg, context);
+    metrics.imbalance = metrics::imbalance(phg, context);
+
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg = utils::partitioned_hg_cast(phg);
+    scheduler.initialize(partitioned_hg);
+    scheduler.refine(partitioned_hg, {}, metrics, 0.0);
+
+    ASSERT_EQ(metrics::quality(phg, Objective::km1), metrics.quality);
+    for ( PartitionID i = 0; i < context.partition.k; ++i ) {
+      ASSERT_LE(phg.partWeight(i), context.partition.max_part_weights[i]);
+    }
+  };
+
+  refine();
+  vec<PartitionID> first_partition(phg.initialNumNodes(), kInvalidPartition);
+  phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    first_partition[hn] = phg.partID(hn);
+  });
+
+  // Same number of threads
+  refine();
+  for ( const HypernodeID& hn : phg.nodes() ) {
+    ASSERT_EQ(first_partition[hn], phg.partID(hn));
+  }
+
+  // Different number of threads
+  context.shared_memory.num_threads = context.shared_memory.num_threads > 1 ? 1 : 2;
+  tbb::task_arena arena(context.shared_memory.num_threads);
+  arena.execute(refine);
+  for ( const HypernodeID& hn : phg.nodes() ) {
+    ASSERT_EQ(first_partition[hn], phg.partID(hn));
+  }
+}
+
+TEST_F(AFlowRefinementEndToEnd, ComputesSameCutPartitionForDifferentNumberOfThreads) {
+  context.partition.deterministic = true;
+  context.partition.objective = Objective::cut;
+  context.partition.gain_policy = GainPolicy::cut;
+  // In contrast to the km1 metric, the cut gain of a node depends on the pins
+  // of its hyperedges in other blocks, which other searches can move
+  FlowRefinerMockControl::instance().refine_func = [&](const PartitionedHypergraph& phg,
+                                                       const Subhypergraph& sub_hg,
+                                                       const size_t) {
+    MoveSequence sequence { {}, 0 };
+    auto add_move = [&](const HypernodeID hn, const PartitionID from, const PartitionID to) {
+      HyperedgeWeight gain = 0;
+      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+        const HypernodeID edge_size = phg.edgeSize(he);
+        gain += phg.pinCountInPart(he, to) == edge_size - 1 ? phg.edgeWeight(he) : 0;
+        gain -= phg.pinCountInPart(he, from) == edge_size ? phg.edgeWeight(he) : 0;
+      }
+      if ( gain > 0 ) {
+        sequence.moves.push_back(Move { from, to, hn, -gain });
+        sequence.expected_improvement += gain;
+      }
+    };
+    for ( const HypernodeID& hn : sub_hg.nodes_of_block_0 ) {
+      add_move(hn, sub_hg.block_0, sub_hg.block_1);
+    }
+    for ( const HypernodeID& hn : sub_hg.nodes_of_block_1 ) {
+      add_move(hn, sub_hg.block_1, sub_hg.block_0);
+    }
+    return sequence;
+  };
+  vec<PartitionID> initial_partition(phg.initialNumNodes(), kInvalidPartition);
+  phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    initial_partition[hn] = phg.partID(hn);
+  });
+
+  auto refine = [&](const size_t num_threads) {
+    context.shared_memory.num_threads = num_threads;
+    context.refinement.flows.num_parallel_searches = num_threads;
+    tbb::task_arena arena(num_threads);
+    arena.execute([&] {
+      phg.resetPartition();
+      phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+        phg.setOnlyNodePart(hn, initial_partition[hn]);
+      });
+      phg.initializePartition();
+
+      CutGainCache gain_cache;
+      FlowRefinementScheduler<GraphAndGainTypes<TypeTraits, CutGainTypes>> scheduler(
+        hg.initialNumNodes(), hg.initialNumEdges(), context, gain_cache);
+      Metrics metrics;
+      metrics.quality = metrics::quality(phg, context);
+      metrics.imbalance = metrics::imbalance(phg, context);
+      const HyperedgeWeight initial_quality = metrics.quality;
+
+      mt_kahypar_partitioned_hypergraph_t partitioned_hg = utils::partitioned_hg_cast(phg);
+      scheduler.initialize(partitioned_hg);
+      scheduler.refine(partitioned_hg, {}, metrics, 0.0);
+
+      ASSERT_LT(metrics.quality, initial_quality);
+      ASSERT_EQ(metrics::quality(phg, Objective::cut), metrics.quality);
+      for ( PartitionID i = 0; i < context.partition.k; ++i ) {
+        ASSERT_LE(phg.partWeight(i), context.partition.max_part_weights[i]);
+      }
+    });
+  };
+
+  refine(1);
+  vec<PartitionID> first_partition(phg.initialNumNodes(), kInvalidPartition);
+  phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    first_partition[hn] = phg.partID(hn);
+  });
+
+  for ( const size_t num_threads : { 2, 4 } ) {
+    refine(num_threads);
+    for ( const HypernodeID& hn : phg.nodes() ) {
+      ASSERT_EQ(first_partition[hn], phg.partID(hn)) << V(num_threads);
+    }
+  }
+}
+
 }
\ No newline at end of file
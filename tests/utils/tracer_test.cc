@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <regex>
+#include <sstream>
+
+#include "mt-kahypar/utils/tracer.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace utils {
+
+namespace {
+
+// Minimal recursive descent parser that checks whether a string is valid JSON
+class JsonValidator {
+ public:
+  explicit JsonValidator(const std::string& json) :
+    _json(json),
+    _pos(0) { }
+
+  bool isValid() {
+    return parseValue() && (skipWhitespace(), _pos == _json.size());
+  }
+
+ private:
+  void skipWhitespace() {
+    while ( _pos < _json.size() && std::isspace(static_cast<unsigned char>(_json[_pos])) ) {
+      ++_pos;
+    }
+  }
+
+  bool consume(const char c) {
+    skipWhitespace();
+    if ( _pos < _json.size() && _json[_pos] == c ) {
+      ++_pos;
+      return true;
+    }
+    return false;
+  }
+
+  bool parseValue() {
+    skipWhitespace();
+    if ( _pos == _json.size() ) {
+      return false;
+    }
+    switch ( _json[_pos] ) {
+      case '{': return parseObject();
+      case '[': return parseArray();
+      case '"': return parseString();
+      default: return parseNumber();
+    }
+  }
+
+  bool parseObject() {
+    consume('{');
+    if ( consume('}') ) {
+      return true;
+    }
+    do {
+      skipWhitespace();
+      if ( !parseString() || !consume(':') || !parseValue() ) {
+        return false;
+      }
+    } while ( consume(',') );
+    return consume('}');
+  }
+
+  bool parseArray() {
+    consume('[');
+    if ( consume(']') ) {
+      return true;
+    }
+    do {
+      if ( !parseValue() ) {
+        return false;
+      }
+    } while ( consume(',') );
+    return consume(']');
+  }
+
+  bool parseString() {
+    if ( _pos == _json.size() || _json[_pos] != '"' ) {
+      return false;
+    }
+    for ( ++_pos; _pos < _json.size(); ++_pos ) {
+      if ( _json[_pos] == '\\' ) {
+        ++_pos;
+      } else if ( _json[_pos] == '"' ) {
+        ++_pos;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool parseNumber() {
+    const size_t start = _pos;
+    if ( _pos < _json.size() && _json[_pos] == '-' ) {
+      ++_pos;
+    }
+    while ( _pos < _json.size() && (std::isdigit(static_cast<unsigned char>(_json[_pos])) ||
+            _json[_pos] == '.' || _json[_pos] == 'e' || _json[_pos] == 'E' || _json[_pos] == '+') ) {
+      ++_pos;
+    }
+    return _pos > start && std::isdigit(static_cast<unsigned char>(_json[_pos - 1]));
+  }
+
+  const std::string& _json;
+  size_t _pos;
+};
+
+std::string readFile(const std::string& filename) {
+  std::ifstream in(filename);
+  std::stringstream content;
+  content << in.rdbuf();
+  return content.str();
+}
+
+// Names of the complete events in the order in which they appear in the trace
+std::vector<std::string> eventNames(const std::string& trace) {
+  static const std::regex event_regex("\\{\"name\":\"([a-z_]+)\",\"ph\":\"X\"");
+  std::vector<std::string> names;
+  for ( auto it = std::sregex_iterator(trace.begin(), trace.end(), event_regex);
+        it != std::sregex_iterator(); ++it ) {
+    names.push_back((*it)[1].str());
+  }
+  return names;
+}
+
+}  // namespace
+
+class ATracer : public Test {
+ public:
+  ATracer() :
+    tracer(Tracer::instance()) {
+    tracer.clear();
+  }
+
+  ~ATracer() {
+    tracer.disable();
+    tracer.clear();
+    std::remove(TRACE_FILE);
+  }
+
+  void recordEvents(const size_t num_events) {
+    const auto start = tracer.now();
+    for ( size_t i = 0; i < num_events; ++i ) {
+      const TraceEvent event = static_cast<TraceEvent>(i % static_cast<size_t>(TraceEvent::NUM_EVENTS));
+      tracer.record(event, start + std::chrono::microseconds(i), start + std::chrono::microseconds(i + 1));
+    }
+  }
+
+  static constexpr const char* TRACE_FILE = "tracer_test.json";
+  Tracer& tracer;
+};
+
+TEST_F(ATracer, RecordsNoEventsIfDisabled) {
+  ASSERT_FALSE(tracer.isEnabled());
+  {
+    TraceScope scope(TraceEvent::fm_round);
+  }
+  tracer.enable(4);
+  tracer.writeChromeTrace(TRACE_FILE);
+  ASSERT_TRUE(eventNames(readFile(TRACE_FILE)).empty());
+}
+
+TEST_F(ATracer, RecordsEventsOfScopes) {
+  tracer.enable(4);
+  {
+    TraceScope outer(TraceEvent::fm_round);
+    TraceScope inner(TraceEvent::fm_localized_search);
+  }
+  tracer.writeChromeTrace(TRACE_FILE);
+  // The inner scope is destroyed first
+  ASSERT_THAT(eventNames(readFile(TRACE_FILE)),
+              ::testing::ElementsAre("fm_localized_search", "fm_round"));
+  ASSERT_EQ(UL(0), tracer.numDroppedEvents());
+}
+
+TEST_F(ATracer, RecordsFineEventsOnlyOnFineTraceLevel) {
+  tracer.enable(4);
+  ASSERT_TRUE(tracer.isEnabled(TraceEvent::fm_localized_search));
+  ASSERT_FALSE(tracer.isEnabled(TraceEvent::fm_pq_update));
+  {
+    TraceScope search(TraceEvent::fm_localized_search);
+    TraceScope update(TraceEvent::fm_pq_update);
+  }
+  tracer.writeChromeTrace(TRACE_FILE);
+  ASSERT_THAT(eventNames(readFile(TRACE_FILE)),
+              ::testing::ElementsAre("fm_localized_search"));
+
+  tracer.clear();
+  tracer.enable(4, TraceLevel::fine);
+  {
+    TraceScope search(TraceEvent::fm_localized_search);
+    TraceScope update(TraceEvent::fm_pq_update);
+  }
+  tracer.writeChromeTrace(TRACE_FILE);
+  ASSERT_THAT(eventNames(readFile(TRACE_FILE)),
+              ::testing::ElementsAre("fm_pq_update", "fm_localized_search"));
+}
+
+TEST_F(ATracer, OverwritesOldestEventsIfRingBufferIsFull) {
+  tracer.enable(4);
+  recordEvents(6);
+  ASSERT_EQ(UL(2), tracer.numDroppedEvents());
+
+  tracer.writeChromeTrace(TRACE_FILE);
+  // Only the four newest events remain, from oldest to newest
+  ASSERT_THAT(eventNames(readFile(TRACE_FILE)),
+              ::testing::ElementsAre(traceEventName(TraceEvent::fm_round),
+                                     traceEventName(TraceEvent::fm_localized_search),
+                                     traceEventName(TraceEvent::fm_pq_update),
+                                     traceEventName(TraceEvent::flow_region_growing)));
+}
+
+TEST_F(ATracer, RoundsBufferSizeUpToPowerOfTwo) {
+  tracer.enable(5);
+  recordEvents(8);
+  ASSERT_EQ(UL(0), tracer.numDroppedEvents());
+  recordEvents(3);
+  ASSERT_EQ(UL(3), tracer.numDroppedEvents());
+}
+
+TEST_F(ATracer, ResetsDroppedEventsOnClear) {
+  tracer.enable(4);
+  recordEvents(10);
+  ASSERT_EQ(UL(6), tracer.numDroppedEvents());
+  tracer.clear();
+  ASSERT_EQ(UL(0), tracer.numDroppedEvents());
+}
+
+TEST_F(ATracer, WritesWellFormedChromeTrace) {
+  tracer.enable(4);
+  recordEvents(7);
+  tracer.writeChromeTrace(TRACE_FILE);
+
+  const std::string trace = readFile(TRACE_FILE);
+  ASSERT_TRUE(JsonValidator(trace).isValid()) << trace;
+  ASSERT_THAT(trace, ::testing::HasSubstr("\"traceEvents\":["));
+  ASSERT_THAT(trace, ::testing::HasSubstr("\"ph\":\"M\""));
+  ASSERT_THAT(trace, ::testing::HasSubstr("\"dropped_events\":3"));
+  ASSERT_EQ(UL(4), eventNames(trace).size());
+}
+
+TEST_F(ATracer, WritesWellFormedChromeTraceWithoutEvents) {
+  tracer.enable(4);
+  tracer.writeChromeTrace(TRACE_FILE);
+  const std::string trace = readFile(TRACE_FILE);
+  ASSERT_TRUE(JsonValidator(trace).isValid()) << trace;
+  ASSERT_THAT(trace, ::testing::HasSubstr("\"dropped_events\":0"));
+}
+
+}  // namespace utils
+}  // namespace mt_kahypar
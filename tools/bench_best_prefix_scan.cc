@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+
+#include <tbb/global_control.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/partition/refinement/fm/best_prefix_scan.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+namespace {
+
+// Sequential reference implementation of the best prefix search
+BestPrefix sequentialBestPrefix(const vec<Move>& moves,
+                                const vec<HypernodeWeight>& node_weights,
+                                vec<HypernodeWeight> part_weights,
+                                const std::vector<HypernodeWeight>& max_part_weights) {
+  BestPrefix best { 0, 0, *std::max_element(part_weights.begin(), part_weights.end()) };
+  size_t overloaded = 0;
+  for ( size_t i = 0; i < part_weights.size(); ++i ) {
+    overloaded += part_weights[i] > max_part_weights[i];
+  }
+  Gain gain_sum = 0;
+  for ( size_t i = 0; i < moves.size(); ++i ) {
+    const Move& m = moves[i];
+    if ( m.isValid() ) {
+      gain_sum += m.gain;
+      const bool from_overloaded = part_weights[m.from] > max_part_weights[m.from];
+      part_weights[m.from] -= node_weights[m.node];
+      overloaded -= from_overloaded && part_weights[m.from] <= max_part_weights[m.from];
+      const bool to_overloaded = part_weights[m.to] > max_part_weights[m.to];
+      part_weights[m.to] += node_weights[m.node];
+      overloaded += !to_overloaded && part_weights[m.to] > max_part_weights[m.to];
+      if ( overloaded == 0 ) {
+        best = std::min(best, BestPrefix { gain_sum, static_cast<MoveID>(i + 1),
+          *std::max_element(part_weights.begin(), part_weights.end()) });
+      }
+    }
+  }
+  return best;
+}
+
+} // namespace
+
+/*!
+ * Micro-benchmark for the best prefix search of the global rollback.
+ * We generate a random move sequence (each node is moved at most once and
+ * a fraction of the moves is invalid, i.e. reverted locally) and compare the
+ * blocked parallel scan against a sequential scan.
+ */
+int main(int argc, char* argv[]) {
+  size_t num_threads = std::thread::hardware_concurrency();
+  size_t num_moves = 16000000;
+  PartitionID k = 8;
+  double invalid_fraction = 0.1;
+  double epsilon = 0.03;
+  size_t repetitions = 5;
+  int seed = 0;
+
+  po::options_description options("Options");
+  options.add_options()
+          ("threads,t",
+           po::value<size_t>(&num_threads)->value_name("<size_t>"),
+           "Number of Threads")
+          ("moves,m",
+           po::value<size_t>(&num_moves)->value_name("<size_t>"),
+           "Number of moves in the move sequence (default 16M)")
+          ("blocks,k",
+           po::value<PartitionID>(&k)->value_name("<int>"),
+           "Number of blocks")
+          ("invalid-fraction",
+           po::value<double>(&invalid_fraction)->value_name("<double>"),
+           "Fraction of invalid (locally reverted) moves")
+          ("epsilon,e",
+           po::value<double>(&epsilon)->value_name("<double>"),
+           "Imbalance parameter")
+          ("repetitions,r",
+           po::value<size_t>(&repetitions)->value_name("<size_t>"),
+           "Number of repetitions (the fastest run is reported)")
+          ("seed",
+           po::value<int>(&seed)->value_name("<int>"),
+           "Seed for the random move sequence");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  if ( num_moves > std::numeric_limits<MoveID>::max() || k < 2 ) {
+    std::cerr << "Invalid number of moves or blocks" << std::endl;
+    return 1;
+  }
+
+  tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+
+  // Generate a random move sequence that keeps the partition roughly balanced
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<PartitionID> block_dist(0, k - 1);
+  std::uniform_int_distribution<HypernodeWeight> weight_dist(1, 4);
+  std::uniform_int_distribution<Gain> gain_dist(-3, 4);
+  std::bernoulli_distribution invalid_dist(invalid_fraction);
+
+  vec<HypernodeWeight> node_weights(num_moves);
+  vec<Move> moves(num_moves);
+  HypernodeWeight total_weight = 0;
+  for ( size_t i = 0; i < num_moves; ++i ) {
+    node_weights[i] = weight_dist(rng);
+    total_weight += node_weights[i];
+    Move& m = moves[i];
+    m.node = i;
+    m.from = block_dist(rng);
+    m.to = ( m.from + 1 + block_dist(rng) % ( k - 1 ) ) % k;
+    m.gain = gain_dist(rng);
+    if ( invalid_dist(rng) ) {
+      m.invalidate();
+    }
+  }
+  std::shuffle(node_weights.begin(), node_weights.end(), rng);
+
+  const HypernodeWeight perfect_weight = total_weight / k + 1;
+  vec<HypernodeWeight> part_weights(k, perfect_weight);
+  std::vector<HypernodeWeight> max_part_weights(k, (1.0 + epsilon) * perfect_weight);
+
+  double sequential_time = std::numeric_limits<double>::max();
+  double parallel_time = std::numeric_limits<double>::max();
+  BestPrefix sequential_result;
+  BestPrefix parallel_result;
+  for ( size_t i = 0; i < repetitions; ++i ) {
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    sequential_result = sequentialBestPrefix(moves, node_weights, part_weights, max_part_weights);
+    HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    sequential_time = std::min(sequential_time, std::chrono::duration<double>(end - start).count());
+
+    start = std::chrono::high_resolution_clock::now();
+    parallel_result = findBestBalancedPrefix(moves, num_moves, part_weights, max_part_weights,
+      [&](const HypernodeID u) { return node_weights[u]; });
+    end = std::chrono::high_resolution_clock::now();
+    parallel_time = std::min(parallel_time, std::chrono::duration<double>(end - start).count());
+  }
+
+  const bool equal_results = sequential_result.gain == parallel_result.gain &&
+    sequential_result.best_index == parallel_result.best_index &&
+    sequential_result.heaviest_weight == parallel_result.heaviest_weight;
+  std::cout << "RESULT"
+            << " moves=" << num_moves
+            << " k=" << k
+            << " threads=" << num_threads
+            << " invalid_fraction=" << invalid_fraction
+            << " best_gain=" << parallel_result.gain
+            << " best_index=" << parallel_result.best_index
+            << " sequential_time=" << sequential_time
+            << " parallel_time=" << parallel_time
+            << " speedup=" << ( sequential_time / parallel_time )
+            << " correct=" << std::boolalpha << equal_results << std::endl;
+
+  return equal_results ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+
+#include <tbb/global_control.h>
+#include <tbb/parallel_reduce.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/static_hypergraph.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/multilevel_vertex_pair_rater.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/simd.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using Hypergraph = ds::StaticHypergraph;
+using Rater = MultilevelVertexPairRater<HeavyEdgeScore, NoWeightPenalty, BestRatingPreferringUnmatched>;
+using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
+
+/*!
+ * Micro-benchmark for the rating step of the multilevel coarsener.
+ * Each vertex of the input hypergraph is rated once (as in the first
+ * clustering pass of the coarsening phase) with every SIMD instruction
+ * set supported by the CPU. We report the fastest running time for each
+ * instruction set.
+ */
+int main(int argc, char* argv[]) {
+  Context context;
+  size_t num_threads = std::thread::hardware_concurrency();
+  size_t repetitions = 5;
+
+  po::options_description options("Options");
+  options.add_options()
+          ("hypergraph,h",
+           po::value<std::string>(&context.partition.graph_filename)->value_name("<string>")->required(),
+           "Hypergraph Filename")
+          ("threads,t",
+           po::value<size_t>(&num_threads)->value_name("<size_t>"),
+           "Number of Threads")
+          ("repetitions,r",
+           po::value<size_t>(&repetitions)->value_name("<size_t>"),
+           "Number of repetitions per instruction set (the fastest run is reported)")
+          ("c-use-adaptive-edge-size",
+           po::value<bool>(&context.coarsening.use_adaptive_edge_size)->value_name("<bool>")->default_value(true),
+           "Use the number of distinct cluster IDs of a net as edge size")
+          ("p-ignore-he-size-threshold",
+           po::value<HypernodeID>(&context.partition.ignore_hyperedge_size_threshold)->value_name(
+                   "<int>")->default_value(1000),
+           "Hyperedges larger than this threshold are ignored during rating");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+
+  // Read Hypergraph
+  mt_kahypar_hypergraph_t hypergraph =
+    mt_kahypar::io::readInputFile(
+      context.partition.graph_filename, PresetType::default_preset,
+      InstanceType::hypergraph, FileFormat::hMetis, true);
+  Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+
+  const HypernodeID num_nodes = hg.initialNumNodes();
+  parallel::scalable_vector<HypernodeID> cluster_ids(num_nodes);
+  parallel::scalable_vector<AtomicWeight> cluster_weight(num_nodes);
+  for ( const HypernodeID& hn : hg.nodes() ) {
+    cluster_ids[hn] = hn;
+    cluster_weight[hn].store(hg.nodeWeight(hn));
+  }
+  ds::FixedVertexSupport<Hypergraph> fixed_vertices = hg.copyOfFixedVertexSupport();
+  const HypernodeWeight max_allowed_node_weight = std::numeric_limits<HypernodeWeight>::max();
+
+  const utils::SIMDInstructionSet supported = utils::detectSIMDInstructionSet();
+  std::cout << "RESULT"
+            << " graph=" << context.partition.graph_filename
+            << " threads=" << num_threads
+            << " num_pins=" << hg.initialNumPins();
+  for ( const utils::SIMDInstructionSet instruction_set :
+        { utils::SIMDInstructionSet::scalar, utils::SIMDInstructionSet::avx2, utils::SIMDInstructionSet::avx512 } ) {
+    if ( static_cast<uint8_t>(instruction_set) > static_cast<uint8_t>(supported) ) {
+      continue;
+    }
+    utils::simd::setInstructionSet(instruction_set);
+    Rater rater(num_nodes, hg.maxEdgeSize(), context);
+    double best_time = std::numeric_limits<double>::max();
+    double rating_sum = 0.0;
+    for ( size_t i = 0; i < repetitions; ++i ) {
+      HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+      rating_sum = tbb::parallel_reduce(tbb::blocked_range<HypernodeID>(ID(0), num_nodes), 0.0,
+        [&](const tbb::blocked_range<HypernodeID>& range, double sum) {
+          for ( HypernodeID hn = range.begin(); hn < range.end(); ++hn ) {
+            if ( hg.nodeIsEnabled(hn) ) {
+              const auto rating = rater.template rate<false>(hg, hn, cluster_ids,
+                cluster_weight, fixed_vertices, max_allowed_node_weight);
+              sum += rating.valid ? rating.value : 0.0;
+            }
+          }
+          return sum;
+        }, std::plus<double>());
+      HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+      best_time = std::min(best_time, std::chrono::duration<double>(end - start).count());
+    }
+    std::cout << " " << utils::simdInstructionSetName(instruction_set) << "_time=" << best_time
+              << " " << utils::simdInstructionSetName(instruction_set) << "_rating_sum=" << rating_sum;
+  }
+  std::cout << std::endl;
+
+  utils::delete_hypergraph(hypergraph);
+
+  return 0;
+}
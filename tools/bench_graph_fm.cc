@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+
+#include <tbb/global_control.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/refinement/fm/multitry_kway_fm.h"
+#include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
+#include "mt-kahypar/partition/refinement/rebalancing/advanced_rebalancer.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/utils/cast.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using TypeTraits = StaticGraphTypeTraits;
+using Graph = typename TypeTraits::Hypergraph;
+using PartitionedGraph = typename TypeTraits::PartitionedHypergraph;
+using Types = GraphAndGainTypes<TypeTraits, CutGainForGraphsTypes>;
+using GainCache = typename Types::GainCache;
+
+/*!
+ * Benchmark for the graph-specialized delta gain updates of the localized FM searches.
+ * The input graph (METIS format, e.g. delaunay_n* or other mesh instances) is refined
+ * with multitry FM starting from the same initial partition, once with the generic
+ * synchronized edge updates and once with the graph-specialized delta updates.
+ * If no partition file is given, the initial partition assigns contiguous ranges of
+ * node IDs to the blocks. We report the fastest running time and the resulting cut.
+ */
+int main(int argc, char* argv[]) {
+  Context context;
+  std::string partition_file;
+  size_t num_threads = std::thread::hardware_concurrency();
+  size_t repetitions = 3;
+  context.partition.k = 8;
+  context.partition.epsilon = 0.03;
+
+  po::options_description options("Options");
+  options.add_options()
+          ("graph,g",
+           po::value<std::string>(&context.partition.graph_filename)->value_name("<string>")->required(),
+           "Graph Filename (METIS format)")
+          ("partition,p",
+           po::value<std::string>(&partition_file)->value_name("<string>"),
+           "Initial partition (optional)")
+          ("blocks,k",
+           po::value<PartitionID>(&context.partition.k)->value_name("<int>"),
+           "Number of blocks")
+          ("epsilon,e",
+           po::value<double>(&context.partition.epsilon)->value_name("<double>"),
+           "Imbalance")
+          ("threads,t",
+           po::value<size_t>(&num_threads)->value_name("<size_t>"),
+           "Number of Threads")
+          ("repetitions,r",
+           po::value<size_t>(&repetitions)->value_name("<size_t>"),
+           "Number of repetitions per variant (the fastest run is reported)")
+          ("r-fm-multitry-rounds",
+           po::value<size_t>(&context.refinement.fm.multitry_rounds)->value_name("<size_t>")->default_value(10),
+           "Number of FM rounds")
+          ("r-fm-seed-nodes",
+           po::value<size_t>(&context.refinement.fm.num_seed_nodes)->value_name("<size_t>")->default_value(25),
+           "Number of nodes to start the 'highly localized FM' with");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+  context.shared_memory.original_num_threads = num_threads;
+  context.shared_memory.num_threads = num_threads;
+  context.partition.mode = Mode::direct;
+  context.partition.objective = Objective::cut;
+  context.partition.gain_policy = GainPolicy::cut_for_graphs;
+  context.partition.instance_type = InstanceType::graph;
+  context.partition.preset_type = PresetType::default_preset;
+  context.partition.partition_type = PartitionedGraph::TYPE;
+  context.partition.verbose_output = false;
+  context.refinement.fm.algorithm = FMAlgorithm::kway_fm;
+  context.refinement.fm.rollback_balance_violation_factor = 1.0;
+
+  Graph graph = io::readInputFile<Graph>(
+    context.partition.graph_filename, FileFormat::Metis, true);
+  context.setupPartWeights(graph.totalWeight());
+
+  std::vector<PartitionID> initial_partition;
+  if ( !partition_file.empty() ) {
+    io::readPartitionFile(partition_file, graph.initialNumNodes(), initial_partition);
+  } else {
+    initial_partition.resize(graph.initialNumNodes());
+    for ( HypernodeID hn = 0; hn < graph.initialNumNodes(); ++hn ) {
+      initial_partition[hn] = std::min(context.partition.k - 1, static_cast<PartitionID>(
+        static_cast<uint64_t>(hn) * context.partition.k / graph.initialNumNodes()));
+    }
+  }
+
+  std::cout << "RESULT"
+            << " graph=" << context.partition.graph_filename
+            << " k=" << context.partition.k
+            << " threads=" << num_threads
+            << " num_nodes=" << graph.initialNumNodes()
+            << " num_edges=" << graph.initialNumEdges();
+  for ( const bool graph_specialized : { false, true } ) {
+    context.refinement.fm.graph_specialized_delta_updates = graph_specialized;
+    double best_time = std::numeric_limits<double>::max();
+    HyperedgeWeight cut = 0;
+    for ( size_t i = 0; i < repetitions; ++i ) {
+      PartitionedGraph phg(context.partition.k, graph, parallel_tag_t());
+      phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+        phg.setOnlyNodePart(hn, initial_partition[hn]);
+      });
+      phg.initializePartition();
+
+      GainCache gain_cache;
+      AdvancedRebalancer<Types> rebalancer(graph.initialNumNodes(), context, gain_cache);
+      MultiTryKWayFM<Types> refiner(graph.initialNumNodes(),
+        graph.initialNumEdges(), context, gain_cache, rebalancer);
+      mt_kahypar_partitioned_hypergraph_t partitioned_graph = utils::partitioned_hg_cast(phg);
+      rebalancer.initialize(partitioned_graph);
+      refiner.initialize(partitioned_graph);
+
+      Metrics metrics { metrics::quality(phg, context), metrics::imbalance(phg, context) };
+      HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+      refiner.refine(partitioned_graph, {}, metrics, std::numeric_limits<double>::max());
+      HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+      best_time = std::min(best_time, std::chrono::duration<double>(end - start).count());
+      cut = metrics::quality(phg, context);
+    }
+    const std::string variant = graph_specialized ? "graph_specialized" : "generic";
+    std::cout << " " << variant << "_time=" << best_time
+              << " " << variant << "_cut=" << cut;
+  }
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/coarsening_commons.h"
+#include "mt-kahypar/partition/coarsening/nlevel_coarsener.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/presets.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using TypeTraits = DynamicHypergraphTypeTraits;
+using Hypergraph = typename TypeTraits::Hypergraph;
+using Coarsener = NLevelCoarsener<TypeTraits>;
+
+/*!
+ * Thread-scaling benchmark for the n-level coarsener. For each number of
+ * threads, the input hypergraph is coarsened with locking registration of
+ * contractions (each contraction acquires the involved vertices) and with
+ * round-based registration (contractions are collected in thread-local
+ * buffers and registered without locks). We report the fastest running time
+ * of each variant.
+ */
+int main(int argc, char* argv[]) {
+  Context context(false);
+  std::vector<option> preset_options = loadPreset(PresetType::highest_quality);
+  presetToContext(context, preset_options, true);
+
+  std::vector<size_t> threads = { std::thread::hardware_concurrency() };
+  size_t repetitions = 3;
+  size_t sub_rounds = 16;
+
+  po::options_description options("Options");
+  options.add_options()
+          ("hypergraph,h",
+           po::value<std::string>(&context.partition.graph_filename)->value_name("<string>")->required(),
+           "Hypergraph Filename")
+          ("blocks,k",
+           po::value<PartitionID>(&context.partition.k)->value_name("<int>")->default_value(2),
+           "Number of Blocks (determines the contraction limit)")
+          ("threads,t",
+           po::value<std::vector<size_t>>(&threads)->value_name("<size_t>")->multitoken(),
+           "Number of Threads (multiple values are benchmarked one after another)")
+          ("repetitions,r",
+           po::value<size_t>(&repetitions)->value_name("<size_t>"),
+           "Number of repetitions per configuration (the fastest run is reported)")
+          ("sub-rounds",
+           po::value<size_t>(&sub_rounds)->value_name("<size_t>"),
+           "Number of sub-rounds used for round-based registration of contractions");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  context.partition.epsilon = 0.03;
+  context.partition.objective = Objective::km1;
+  context.partition.verbose_output = false;
+  context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+
+  // Read Hypergraph
+  mt_kahypar_hypergraph_t hypergraph =
+    mt_kahypar::io::readInputFile(
+      context.partition.graph_filename, PresetType::highest_quality,
+      InstanceType::hypergraph, FileFormat::hMetis, true);
+  Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+  context.setupPartWeights(hg.totalWeight());
+
+  for ( const size_t num_threads : threads ) {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+    context.shared_memory.num_threads = num_threads;
+    context.shared_memory.original_num_threads = num_threads;
+    context.setupContractionLimit(hg.totalWeight());
+
+    std::cout << "RESULT"
+              << " graph=" << context.partition.graph_filename
+              << " threads=" << num_threads
+              << " k=" << context.partition.k
+              << " contraction_limit=" << context.coarsening.contraction_limit;
+    for ( const size_t registration_sub_rounds : { UL(0), sub_rounds } ) {
+      context.coarsening.nlevel_registration_sub_rounds = registration_sub_rounds;
+      const std::string name = registration_sub_rounds == 0 ? "locking" : "round_based";
+      double best_time = std::numeric_limits<double>::max();
+      HypernodeID num_coarse_nodes = 0;
+      for ( size_t i = 0; i < repetitions; ++i ) {
+        Hypergraph tmp_hg = hg.copy(parallel_tag_t());
+        UncoarseningData<TypeTraits> uncoarsening_data(true, tmp_hg, context);
+        Coarsener coarsener(utils::hypergraph_cast(tmp_hg), context,
+          uncoarsening::to_pointer(uncoarsening_data));
+
+        HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+        coarsener.coarsen();
+        HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+        best_time = std::min(best_time, std::chrono::duration<double>(end - start).count());
+        const Hypergraph& coarsest_hg = utils::cast<Hypergraph>(coarsener.coarsestHypergraph());
+        num_coarse_nodes = coarsest_hg.initialNumNodes() - coarsest_hg.numRemovedHypernodes();
+      }
+      std::cout << " " << name << "_time=" << best_time
+                << " " << name << "_coarse_nodes=" << num_coarse_nodes;
+    }
+    std::cout << std::endl;
+  }
+
+  utils::delete_hypergraph(hypergraph);
+
+  return 0;
+}
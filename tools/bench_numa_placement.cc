@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/numa_placement.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
+#include "mt-kahypar/partition/refinement/label_propagation/label_propagation_refiner.h"
+#include "mt-kahypar/partition/refinement/rebalancing/advanced_rebalancer.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/utils/cast.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using TypeTraits = StaticHypergraphTypeTraits;
+using Hypergraph = typename TypeTraits::Hypergraph;
+using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+using Types = GraphAndGainTypes<TypeTraits, Km1GainTypes>;
+using GainCache = typename Types::GainCache;
+
+double elapsedSeconds(const HighResClockTimepoint& start) {
+  return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+/*!
+ * Benchmark for the NUMA-aware placement of the incidence array, the part IDs,
+ * the pin counts and the gain cache. For both variants (interleaved allocations
+ * and NUMA-aware placement), the hypergraph is read from scratch, and we measure
+ * the throughput (in pins per second) of initializing the partition, initializing
+ * the gain cache and label propagation refinement.
+ *
+ * On a single-socket machine, two NUMA nodes can be emulated, e.g., via
+ * numactl --cpunodebind=0 --membind=0,1 ./BenchNumaPlacement ... in combination
+ * with a fake NUMA topology (numa=fake=2 kernel parameter). The NUMA-aware
+ * placement requires a build with -DKAHYPAR_ENABLE_THREAD_PINNING=ON.
+ */
+int main(int argc, char* argv[]) {
+  Context context;
+  size_t num_threads = std::thread::hardware_concurrency();
+  size_t repetitions = 3;
+  context.partition.k = 8;
+  context.partition.epsilon = 0.03;
+
+  po::options_description options("Options");
+  options.add_options()
+          ("hypergraph,h",
+           po::value<std::string>(&context.partition.graph_filename)->value_name("<string>")->required(),
+           "Hypergraph Filename (hMetis format)")
+          ("blocks,k",
+           po::value<PartitionID>(&context.partition.k)->value_name("<int>"),
+           "Number of blocks")
+          ("threads,t",
+           po::value<size_t>(&num_threads)->value_name("<size_t>"),
+           "Number of Threads")
+          ("repetitions,r",
+           po::value<size_t>(&repetitions)->value_name("<size_t>"),
+           "Number of repetitions per variant (the fastest run is reported)")
+          ("r-lp-maximum-iterations",
+           po::value<size_t>(&context.refinement.label_propagation.maximum_iterations)->value_name("<size_t>")->default_value(5),
+           "Maximum number of label propagation rounds");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  TBBInitializer::instance(num_threads);
+  #ifndef KAHYPAR_DISABLE_HWLOC
+  hwloc_cpuset_t cpuset = TBBInitializer::instance().used_cpuset();
+  parallel::HardwareTopology<>::instance().activate_interleaved_membind_policy(cpuset);
+  hwloc_bitmap_free(cpuset);
+  #endif
+
+  context.shared_memory.original_num_threads = num_threads;
+  context.shared_memory.num_threads = num_threads;
+  context.partition.mode = Mode::direct;
+  context.partition.objective = Objective::km1;
+  context.partition.gain_policy = GainPolicy::km1;
+  context.partition.instance_type = InstanceType::hypergraph;
+  context.partition.preset_type = PresetType::default_preset;
+  context.partition.partition_type = PartitionedHypergraph::TYPE;
+  context.partition.verbose_output = false;
+  context.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::label_propagation;
+
+  std::cout << "RESULT"
+            << " hypergraph=" << context.partition.graph_filename
+            << " k=" << context.partition.k
+            << " threads=" << num_threads;
+  for ( const bool numa_aware : { false, true } ) {
+    if ( numa_aware ) {
+      parallel::NumaPlacement::instance().enable();
+    } else {
+      parallel::NumaPlacement::instance().disable();
+    }
+
+    // The arrays are placed when they are allocated, so we have to read the hypergraph again
+    Hypergraph hypergraph = io::readInputFile<Hypergraph>(
+      context.partition.graph_filename, FileFormat::hMetis, true);
+    context.setupPartWeights(hypergraph.totalWeight());
+    const double num_pins = hypergraph.initialNumPins();
+
+    double best_partition_time = std::numeric_limits<double>::max();
+    double best_gain_cache_time = std::numeric_limits<double>::max();
+    double best_lp_time = std::numeric_limits<double>::max();
+    for ( size_t i = 0; i < repetitions; ++i ) {
+      PartitionedHypergraph phg(context.partition.k, hypergraph, parallel_tag_t());
+      HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+      phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+        phg.setOnlyNodePart(hn, static_cast<PartitionID>(
+          (static_cast<uint64_t>(hn) * context.partition.k) / hypergraph.initialNumNodes()));
+      });
+      phg.initializePartition();
+      best_partition_time = std::min(best_partition_time, elapsedSeconds(start));
+
+      GainCache gain_cache;
+      start = std::chrono::high_resolution_clock::now();
+      gain_cache.initializeGainCache(phg);
+      best_gain_cache_time = std::min(best_gain_cache_time, elapsedSeconds(start));
+
+      AdvancedRebalancer<Types> rebalancer(hypergraph.initialNumNodes(), context, gain_cache);
+      LabelPropagationRefiner<Types> refiner(hypergraph.initialNumNodes(),
+        hypergraph.initialNumEdges(), context, gain_cache, rebalancer);
+      mt_kahypar_partitioned_hypergraph_t partitioned_hg = utils::partitioned_hg_cast(phg);
+      rebalancer.initialize(partitioned_hg);
+      refiner.initialize(partitioned_hg);
+      Metrics metrics { metrics::quality(phg, context), metrics::imbalance(phg, context) };
+      start = std::chrono::high_resolution_clock::now();
+      refiner.refine(partitioned_hg, {}, metrics, std::numeric_limits<double>::max());
+      best_lp_time = std::min(best_lp_time, elapsedSeconds(start));
+    }
+
+    const std::string variant = numa_aware ? "numa" : "interleaved";
+    std::cout << " " << variant << "_initialize_partition_pins_per_s=" << num_pins / best_partition_time
+              << " " << variant << "_initialize_gain_cache_pins_per_s=" << num_pins / best_gain_cache_time
+              << " " << variant << "_lp_pins_per_s=" << num_pins / best_lp_time;
+  }
+  std::cout << std::endl;
+  parallel::NumaPlacement::instance().disable();
+  TBBInitializer::instance().terminate();
+
+  return 0;
+}